@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_keys.h"
+
+/* ========================================================================= */
+/*                        B+ tree against binary tree                        */
+/* ========================================================================= */
+
+// range(0) random keys. Lookups go over the same keys shuffled (all hits),
+// range scans start at a random stored key and read the next kScanLength
+// elements in order
+static constexpr int kScanLength = 100;
+
+template <typename MapType>
+static void fill(MapType &map, const std::vector<int> &keys) {
+  for (int key : keys) {
+    map.insert(key, key);
+  }
+}
+
+template <typename MapType>
+static void runInsert(benchmark::State& state) {
+  const std::vector<int> keys = randomKeys(state.range(0), 1);
+
+  for (auto _ : state) {
+    MapType map;
+    fill(map, keys);
+    benchmark::DoNotOptimize(map.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename MapType>
+static void runLookup(benchmark::State& state) {
+  const std::vector<int> keys = randomKeys(state.range(0), 1);
+  const std::vector<int> probes = shuffled(keys, 3);
+  MapType map;
+  fill(map, keys);
+
+  for (auto _ : state) {
+    size_t found = 0;
+    for (int key : probes) {
+      found += map.contains(key);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+// scans start from an iterator to a stored key and walk with ++. Map has no
+// find returning an iterator, insert of a stored key gives one and changes nothing
+static s21::Map<int, int>::Iterator startAt(s21::Map<int, int> &map, int key) {
+  return map.insert(key, 0).first;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+static typename s21::BTreeMap<Key, T, NodeBytes>::Iterator startAt(s21::BTreeMap<Key, T, NodeBytes> &map, int key) {
+  return map.find(key);
+}
+
+template <typename MapType>
+static void runScan(benchmark::State& state) {
+  const std::vector<int> keys = randomKeys(state.range(0), 1);
+  const std::vector<int> starts = shuffled(keys, 3);
+  MapType map;
+  fill(map, keys);
+
+  size_t start = 0;
+  for (auto _ : state) {
+    auto it = startAt(map, starts[start]);
+    long long sum = 0;
+
+    for (int i = 0; i < kScanLength && it != map.end(); ++i, ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+
+    start = (start + 1) % starts.size();
+  }
+
+  state.SetItemsProcessed(state.iterations() * kScanLength);
+}
+
+static void BM_Map_Insert(benchmark::State& state) { runInsert<s21::Map<int, int>>(state); }
+BENCHMARK(BM_Map_Insert)->Range(1 << 10, 1 << 20);
+
+static void BM_BTreeMap_Insert(benchmark::State& state) { runInsert<s21::BTreeMap<int, int>>(state); }
+BENCHMARK(BM_BTreeMap_Insert)->Range(1 << 10, 1 << 20);
+
+static void BM_Map_Lookup(benchmark::State& state) { runLookup<s21::Map<int, int>>(state); }
+BENCHMARK(BM_Map_Lookup)->Range(1 << 10, 1 << 20);
+
+static void BM_BTreeMap_Lookup(benchmark::State& state) { runLookup<s21::BTreeMap<int, int>>(state); }
+BENCHMARK(BM_BTreeMap_Lookup)->Range(1 << 10, 1 << 20);
+
+// node size: one, two, four and eight cache lines
+static void BM_BTreeMap64_Lookup(benchmark::State& state) { runLookup<s21::BTreeMap<int, int, 64>>(state); }
+BENCHMARK(BM_BTreeMap64_Lookup)->Arg(1 << 20);
+
+static void BM_BTreeMap128_Lookup(benchmark::State& state) { runLookup<s21::BTreeMap<int, int, 128>>(state); }
+BENCHMARK(BM_BTreeMap128_Lookup)->Arg(1 << 20);
+
+static void BM_BTreeMap512_Lookup(benchmark::State& state) { runLookup<s21::BTreeMap<int, int, 512>>(state); }
+BENCHMARK(BM_BTreeMap512_Lookup)->Arg(1 << 20);
+
+static void BM_Map_RangeScan(benchmark::State& state) { runScan<s21::Map<int, int>>(state); }
+BENCHMARK(BM_Map_RangeScan)->Range(1 << 10, 1 << 20);
+
+static void BM_BTreeMap_RangeScan(benchmark::State& state) { runScan<s21::BTreeMap<int, int>>(state); }
+BENCHMARK(BM_BTreeMap_RangeScan)->Range(1 << 10, 1 << 20);
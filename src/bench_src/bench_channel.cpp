@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+/* ========================================================================= */
+/*                               Ping-pong                                   */
+/* ========================================================================= */
+
+// two parties pass a counter back and forth range(0) times, time per round
+// trip is the hand-off latency
+
+// s21::Queue guarded by a mutex, the receiving thread sleeps on a condvar
+template <typename T>
+class CondvarQueue {
+public:
+  void push(const T &value) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push(value);
+    }
+    not_empty_.notify_one();
+  }
+
+  T pop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this]() { return !queue_.empty(); });
+
+    T value = queue_.front();
+    queue_.pop();
+
+    return value;
+  }
+
+private:
+  s21::Queue<T> queue_;
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+};
+
+static void BM_CondvarQueue_PingPong(benchmark::State& state) {
+  const int rounds = state.range(0);
+
+  for (auto _ : state) {
+    CondvarQueue<int> ping;
+    CondvarQueue<int> pong;
+
+    std::thread partner([&]() {
+      for (int i = 0; i < rounds; ++i) {
+        pong.push(ping.pop() + 1);
+      }
+    });
+
+    int value = 0;
+    for (int i = 0; i < rounds; ++i) {
+      ping.push(value);
+      value = pong.pop();
+    }
+
+    partner.join();
+    benchmark::DoNotOptimize(value);
+  }
+
+  state.SetItemsProcessed(state.iterations() * rounds);
+}
+BENCHMARK(BM_CondvarQueue_PingPong)->Arg(1 << 14)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+#if __cplusplus >= 202002L && __has_include(<coroutine>)
+
+// the same on coroutines of one executor: a hand-off is a suspend and a resume
+static s21::Task pingParty(s21::Channel<int> &ping, s21::Channel<int> &pong, int rounds, int &result) {
+  int value = 0;
+
+  for (int i = 0; i < rounds; ++i) {
+    co_await ping.send(value);
+    std::optional<int> answer = co_await pong.recv();
+    value = *answer;
+  }
+
+  result = value;
+}
+
+static s21::Task pongParty(s21::Channel<int> &ping, s21::Channel<int> &pong, int rounds) {
+  for (int i = 0; i < rounds; ++i) {
+    std::optional<int> value = co_await ping.recv();
+    co_await pong.send(*value + 1);
+  }
+}
+
+static void BM_Channel_PingPong(benchmark::State& state) {
+  const int rounds = state.range(0);
+
+  for (auto _ : state) {
+    s21::Executor executor;
+    s21::Channel<int> ping(executor, 1);
+    s21::Channel<int> pong(executor, 1);
+    int result = 0;
+
+    executor.spawn(pongParty(ping, pong, rounds));
+    executor.spawn(pingParty(ping, pong, rounds, result));
+    executor.run();
+
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetItemsProcessed(state.iterations() * rounds);
+}
+BENCHMARK(BM_Channel_PingPong)->Arg(1 << 14)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+#endif
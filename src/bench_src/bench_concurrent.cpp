@@ -0,0 +1,638 @@
+#include <benchmark/benchmark.h>
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+// number of threads benchmarks scale up to (all cores of the local machine)
+static const int kMaxThreads =
+  std::thread::hardware_concurrency() == 0 ? 1 : std::thread::hardware_concurrency();
+
+// simple xorshift, every thread has its own state
+static unsigned nextRandom(unsigned &state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+/* ========================================================================= */
+/*                              Concurrent List                              */
+/* ========================================================================= */
+
+static const int kListKeys = 1024;
+
+// read-mostly workload: 90% contains, 5% insert, 5% remove
+template <typename Operations>
+static void runListWorkload(benchmark::State& state, Operations &list) {
+  unsigned random = 2463534242u + state.thread_index() * 7919u;
+
+  for (auto _ : state) {
+    unsigned r = nextRandom(random);
+    int key = r % kListKeys;
+    unsigned op = (r >> 16) % 100;
+
+    if (op < 90) {
+      benchmark::DoNotOptimize(list.contains(key));
+    } else if (op < 95) {
+      list.insert(key);
+    } else {
+      list.remove(key);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+static s21::ConcurrentList<int>& sharedConcurrentList() {
+  static s21::ConcurrentList<int> list;
+  static std::once_flag filled;
+
+  std::call_once(filled, []() {
+    for (int key = 0; key < kListKeys; key += 2) {
+      list.insert(key);
+    }
+  });
+
+  return list;
+}
+
+static void BM_ConcurrentList_ReadMostly(benchmark::State& state) {
+  runListWorkload(state, sharedConcurrentList());
+}
+BENCHMARK(BM_ConcurrentList_ReadMostly)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+// the thing we are replacing: s21::List behind a single mutex
+class LockedList {
+private:
+  std::mutex mutex_;
+  s21::List<int> list_;
+
+public:
+  bool contains(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return list_.contains(key);
+  }
+
+  void insert(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!list_.contains(key)) {
+      list_.pushBack(key);
+    }
+  }
+
+  void remove(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    list_.remove(key);
+  }
+};
+
+static LockedList& sharedLockedList() {
+  static LockedList list;
+  static std::once_flag filled;
+
+  std::call_once(filled, []() {
+    for (int key = 0; key < kListKeys; key += 2) {
+      list.insert(key);
+    }
+  });
+
+  return list;
+}
+
+static void BM_MutexList_ReadMostly(benchmark::State& state) {
+  runListWorkload(state, sharedLockedList());
+}
+BENCHMARK(BM_MutexList_ReadMostly)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+
+/* ========================================================================= */
+/*                             Concurrent Stack                              */
+/* ========================================================================= */
+
+static const int kFreeListBuffers = 64;
+
+// shared free list of buffers: every thread takes a buffer and gives it back,
+// all threads hit the top of the same stack
+template <typename FreeList>
+static void runFreeList(benchmark::State& state, FreeList &free_list) {
+  int *buffer = nullptr;
+
+  for (auto _ : state) {
+    if (free_list.pop(buffer)) {
+      benchmark::DoNotOptimize(*buffer);
+      free_list.push(buffer);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+static int free_list_buffers[kFreeListBuffers];
+
+template <typename FreeList>
+static FreeList& filledFreeList() {
+  static FreeList free_list;
+  static std::once_flag filled;
+
+  std::call_once(filled, []() {
+    for (int i = 0; i < kFreeListBuffers; ++i) {
+      free_list.push(&free_list_buffers[i]);
+    }
+  });
+
+  return free_list;
+}
+
+static void BM_ConcurrentStack_FreeList(benchmark::State& state) {
+  runFreeList(state, filledFreeList<s21::ConcurrentStack<int*>>());
+}
+BENCHMARK(BM_ConcurrentStack_FreeList)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+// the thing we are replacing: s21::Stack behind a global mutex
+class LockedStack {
+private:
+  std::mutex mutex_;
+  s21::Stack<int*> stack_;
+
+public:
+  bool push(int *buffer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(buffer);
+    return true;
+  }
+
+  bool pop(int *&out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) {
+      return false;
+    }
+    out = stack_.top();
+    stack_.pop();
+    return true;
+  }
+};
+
+static void BM_MutexStack_FreeList(benchmark::State& state) {
+  runFreeList(state, filledFreeList<LockedStack>());
+}
+BENCHMARK(BM_MutexStack_FreeList)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+
+/* ========================================================================= */
+/*                                SPSC Queue                                 */
+/* ========================================================================= */
+
+static const int kQueueItems = 1 << 20;
+static const size_t kQueueCapacity = 1024;
+
+// the thing we are replacing: s21::Queue behind a single mutex
+class LockedQueue {
+private:
+  std::mutex mutex_;
+  s21::Queue<int> queue_;
+
+public:
+  bool push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() >= kQueueCapacity) {
+      return false;
+    }
+    queue_.push(value);
+    return true;
+  }
+
+  bool pop(int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      return false;
+    }
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+};
+
+// one producer thread, the benchmark thread consumes, items per second is the throughput
+template <typename Queue>
+static void runQueueThroughput(benchmark::State& state, Queue &queue) {
+  for (auto _ : state) {
+    std::thread producer([&queue]() {
+      for (int i = 0; i < kQueueItems; ++i) {
+        while (!queue.push(i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    int value = 0;
+    for (int i = 0; i < kQueueItems; ++i) {
+      while (!queue.pop(value)) {
+        std::this_thread::yield();
+      }
+      benchmark::DoNotOptimize(value);
+    }
+
+    producer.join();
+  }
+
+  state.SetItemsProcessed(state.iterations() * kQueueItems);
+}
+
+static void BM_SpscQueue_Throughput(benchmark::State& state) {
+  s21::SpscQueue<int> queue(kQueueCapacity);
+  runQueueThroughput(state, queue);
+}
+BENCHMARK(BM_SpscQueue_Throughput)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_MutexQueue_Throughput(benchmark::State& state) {
+  LockedQueue queue;
+  runQueueThroughput(state, queue);
+}
+BENCHMARK(BM_MutexQueue_Throughput)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// batched variant, producer and consumer move 64 items per publication
+static void BM_SpscQueue_ThroughputBatched(benchmark::State& state) {
+  const int batch = 64;
+  s21::SpscQueue<int> queue(kQueueCapacity);
+
+  for (auto _ : state) {
+    std::thread producer([&queue]() {
+      int items[batch];
+      for (int i = 0; i < kQueueItems;) {
+        for (int j = 0; j < batch; ++j) {
+          items[j] = i + j;
+        }
+        size_t pushed = 0;
+        while (pushed < static_cast<size_t>(batch)) {
+          size_t n = queue.push_n(items + pushed, batch - pushed);
+          if (n == 0) {
+            std::this_thread::yield();
+          }
+          pushed += n;
+        }
+        i += batch;
+      }
+    });
+
+    int out[batch];
+    for (int received = 0; received < kQueueItems;) {
+      size_t n = queue.pop_n(out, batch);
+      if (n == 0) {
+        std::this_thread::yield();
+      }
+      benchmark::DoNotOptimize(out);
+      received += static_cast<int>(n);
+    }
+
+    producer.join();
+  }
+
+  state.SetItemsProcessed(state.iterations() * kQueueItems);
+}
+BENCHMARK(BM_SpscQueue_ThroughputBatched)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// latency: a token goes back and forth through two queues, time per round trip
+template <typename Queue>
+static void runQueuePingPong(benchmark::State& state, Queue &ping, Queue &pong) {
+  const int rounds = 10000;
+
+  for (auto _ : state) {
+    std::thread echo([&]() {
+      int value = 0;
+      for (int i = 0; i < rounds; ++i) {
+        while (!ping.pop(value)) {
+          std::this_thread::yield();
+        }
+        while (!pong.push(value)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    int value = 0;
+    for (int i = 0; i < rounds; ++i) {
+      ping.push(i);
+      while (!pong.pop(value)) {
+        std::this_thread::yield();
+      }
+    }
+
+    echo.join();
+  }
+
+  state.SetItemsProcessed(state.iterations() * rounds);
+}
+
+static void BM_SpscQueue_PingPong(benchmark::State& state) {
+  s21::SpscQueue<int> ping(kQueueCapacity);
+  s21::SpscQueue<int> pong(kQueueCapacity);
+  runQueuePingPong(state, ping, pong);
+}
+BENCHMARK(BM_SpscQueue_PingPong)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_MutexQueue_PingPong(benchmark::State& state) {
+  LockedQueue ping;
+  LockedQueue pong;
+  runQueuePingPong(state, ping, pong);
+}
+BENCHMARK(BM_MutexQueue_PingPong)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+
+/* ========================================================================= */
+/*                                MPMC Queue                                 */
+/* ========================================================================= */
+
+static const size_t kMpmcCapacity = 1024;
+
+// the thing we are replacing: s21::Queue behind a mutex and a condition variable
+class BlockingQueue {
+private:
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  s21::Queue<int> queue_;
+
+public:
+  bool push(int value) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push(value);
+    }
+    not_empty_.notify_one();
+    return true;
+  }
+
+  bool pop(int &out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this]() { return !queue_.empty(); });
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+};
+
+// every thread hands an item over and takes one back, so that all
+// threads are producers and consumers at the same time
+template <typename Queue>
+static void runHandOff(benchmark::State& state, Queue &queue) {
+  int value = state.thread_index();
+
+  for (auto _ : state) {
+    queue.push(value);
+    queue.pop(value);
+    benchmark::DoNotOptimize(value);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_MpmcQueue_HandOff(benchmark::State& state) {
+  static s21::MpmcQueue<int> queue(kMpmcCapacity);
+  runHandOff(state, queue);
+}
+BENCHMARK(BM_MpmcQueue_HandOff)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+static void BM_MutexQueue_HandOff(benchmark::State& state) {
+  static BlockingQueue queue;
+  runHandOff(state, queue);
+}
+BENCHMARK(BM_MutexQueue_HandOff)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+
+/* ========================================================================= */
+/*                                Thread Pool                                */
+/* ========================================================================= */
+
+// the thing we are replacing: workers sharing one mutex protected s21::Queue
+class CentralQueuePool {
+private:
+  using Task = std::function<void()>;
+
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  s21::Queue<Task*> queue_;
+  size_t pending_ = 0;
+  bool stop_ = false;
+  std::vector<std::thread> workers_;
+
+public:
+  explicit CentralQueuePool(size_t threads_count) {
+    for (size_t i = 0; i < threads_count; ++i) {
+      workers_.emplace_back([this]() {
+        while (true) {
+          Task *task = nullptr;
+          {
+            std::unique_lock<std::mutex> lock(mutex_);
+            changed_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) {
+              return;
+            }
+            task = queue_.front();
+            queue_.pop();
+          }
+
+          (*task)();
+          delete task;
+
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (--pending_ == 0) {
+            changed_.notify_all();
+          }
+        }
+      });
+    }
+  }
+
+  ~CentralQueuePool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    changed_.notify_all();
+    for (std::thread &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  template <typename Func>
+  void submit(Func &&func) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push(new Task(std::forward<Func>(func)));
+      ++pending_;
+    }
+    changed_.notify_all();
+  }
+
+  void wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    changed_.wait(lock, [this]() { return pending_ == 0; });
+  }
+};
+
+static const int kSpawnDepth = 12; // 2^13 - 1 tiny tasks
+
+// every task spawns two children: with a work-stealing pool children go to
+// the worker's own deque, with a central queue everyone fights for one lock
+template <typename Pool>
+static void spawnTree(Pool &pool, std::atomic<long> &counter, int depth) {
+  counter.fetch_add(1, std::memory_order_relaxed);
+
+  if (depth > 0) {
+    pool.submit([&pool, &counter, depth]() { spawnTree(pool, counter, depth - 1); });
+    pool.submit([&pool, &counter, depth]() { spawnTree(pool, counter, depth - 1); });
+  }
+}
+
+static void BM_ThreadPool_SpawnTree(benchmark::State& state) {
+  s21::ThreadPool pool(state.range(0));
+  std::atomic<long> counter{ 0 };
+
+  for (auto _ : state) {
+    pool.submit([&pool, &counter]() { spawnTree(pool, counter, kSpawnDepth); });
+    pool.wait();
+  }
+
+  state.SetItemsProcessed(counter);
+}
+BENCHMARK(BM_ThreadPool_SpawnTree)->RangeMultiplier(2)->Range(1, kMaxThreads)->UseRealTime();
+
+static void BM_CentralQueuePool_SpawnTree(benchmark::State& state) {
+  CentralQueuePool pool(state.range(0));
+  std::atomic<long> counter{ 0 };
+
+  for (auto _ : state) {
+    pool.submit([&pool, &counter]() { spawnTree(pool, counter, kSpawnDepth); });
+    pool.wait();
+  }
+
+  state.SetItemsProcessed(counter);
+}
+BENCHMARK(BM_CentralQueuePool_SpawnTree)->RangeMultiplier(2)->Range(1, kMaxThreads)->UseRealTime();
+
+// container-heavy batch job: build 256 maps of 1000 keys each
+static const size_t kBatchJobs = 256;
+
+static void buildMap(size_t job) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 1000; ++i) {
+    int key = static_cast<int>((i * 7919u + job) % 1000);
+    map.insert(key, i);
+  }
+  benchmark::DoNotOptimize(map.size());
+}
+
+static void BM_ThreadPool_ParallelForMaps(benchmark::State& state) {
+  s21::ThreadPool pool(state.range(0));
+
+  for (auto _ : state) {
+    pool.parallel_for(0, kBatchJobs, buildMap);
+  }
+
+  state.SetItemsProcessed(state.iterations() * kBatchJobs);
+}
+BENCHMARK(BM_ThreadPool_ParallelForMaps)->RangeMultiplier(2)->Range(1, kMaxThreads)
+  ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_Sequential_Maps(benchmark::State& state) {
+  for (auto _ : state) {
+    for (size_t job = 0; job < kBatchJobs; ++job) {
+      buildMap(job);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * kBatchJobs);
+}
+BENCHMARK(BM_Sequential_Maps)->Unit(benchmark::kMillisecond);
+
+
+/* ========================================================================= */
+/*                            Concurrent Hash Map                            */
+/* ========================================================================= */
+
+static const int kMapKeys = 1 << 16;
+
+// range(0) percent of lookups, the rest are writes: half insert_or_assign,
+// half erase, so the map keeps about half of the keys
+template <typename Operations>
+static void runMapWorkload(benchmark::State& state, Operations &map) {
+  const unsigned reads = static_cast<unsigned>(state.range(0));
+  unsigned random = 2463534242u + state.thread_index() * 7919u;
+  int value = 0;
+
+  for (auto _ : state) {
+    unsigned r = nextRandom(random);
+    int key = static_cast<int>(r % kMapKeys);
+    unsigned op = (r >> 16) % 100;
+
+    if (op < reads) {
+      benchmark::DoNotOptimize(map.find(key, value));
+    } else if ((op - reads) % 2 == 0) {
+      map.insert_or_assign(key, key);
+    } else {
+      map.erase(key);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename MapType>
+static MapType& sharedMap() {
+  static MapType map;
+  static std::once_flag filled;
+
+  // even keys in scrambled order, sorted inserts would make a list of Map's tree
+  std::call_once(filled, []() {
+    for (int i = 0; i < kMapKeys; ++i) {
+      int key = (i * 7919) & (kMapKeys - 1);
+      if (key % 2 == 0) {
+        map.insert_or_assign(key, key);
+      }
+    }
+  });
+
+  return map;
+}
+
+static void BM_ConcurrentHashMap_Mix(benchmark::State& state) {
+  runMapWorkload(state, sharedMap<s21::ConcurrentHashMap<int, int>>());
+}
+BENCHMARK(BM_ConcurrentHashMap_Mix)->Arg(90)->Arg(50)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+// the thing we are replacing: s21::Map behind a single mutex
+class LockedMap {
+private:
+  std::mutex mutex_;
+  s21::Map<int, int> map_;
+
+public:
+  bool find(int key, int &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!map_.contains(key)) {
+      return false;
+    }
+    out = map_.at(key);
+    return true;
+  }
+
+  void insert_or_assign(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert_or_assign(key, value);
+  }
+
+  void erase(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.remove(key);
+  }
+};
+
+static void BM_MutexMap_Mix(benchmark::State& state) {
+  runMapWorkload(state, sharedMap<LockedMap>());
+}
+BENCHMARK(BM_MutexMap_Mix)->Arg(90)->Arg(50)->ThreadRange(1, kMaxThreads)->UseRealTime();
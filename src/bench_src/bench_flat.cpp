@@ -0,0 +1,158 @@
+#include <benchmark/benchmark.h>
+
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_keys.h"
+
+/* ========================================================================= */
+/*                     Sorted vectors against the trees                      */
+/* ========================================================================= */
+
+// range(0) random keys. Tree containers are built one insert at a time, flat
+// ones in bulk (one sort and one merge) and, to show why bulk matters, one
+// insert at a time too. Lookups go over the same keys shuffled (all hits)
+static std::vector<std::pair<int, int>> randomItems(size_t n) {
+  std::vector<std::pair<int, int>> items;
+
+  for (int key : randomKeys(n, 1)) {
+    items.emplace_back(key, key);
+  }
+
+  return items;
+}
+
+template <typename MapType>
+static void fill(MapType &map, const std::vector<std::pair<int, int>> &items) {
+  for (const auto &item : items) {
+    map.insert(item);
+  }
+}
+
+template <typename SetType>
+static void fill(SetType &set, const std::vector<int> &keys) {
+  for (int key : keys) {
+    set.insert(key);
+  }
+}
+
+template <typename Key, typename T>
+static void fill(s21::FlatMap<Key, T> &map, const std::vector<std::pair<int, int>> &items) {
+  map.insert_range(items.begin(), items.end());
+}
+
+template <typename T>
+static void fill(s21::FlatSet<T> &set, const std::vector<int> &keys) {
+  set.insert_range(keys.begin(), keys.end());
+}
+
+template <typename T>
+static void fill(s21::FlatMultiset<T> &multiset, const std::vector<int> &keys) {
+  multiset.insert_range(keys.begin(), keys.end());
+}
+
+template <typename ContainerType, typename Items>
+static void runBuild(benchmark::State& state, const Items &items) {
+  for (auto _ : state) {
+    ContainerType container;
+    fill(container, items);
+    benchmark::DoNotOptimize(container.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * items.size());
+}
+
+template <typename ContainerType, typename Items>
+static void runLookup(benchmark::State& state, const Items &items) {
+  const std::vector<int> probes = shuffled(randomKeys(state.range(0), 1), 3);
+  ContainerType container;
+  fill(container, items);
+
+  for (auto _ : state) {
+    size_t found = 0;
+    for (int key : probes) {
+      found += container.contains(key);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+static void BM_Map_Build(benchmark::State& state) {
+  runBuild<s21::Map<int, int>>(state, randomItems(state.range(0)));
+}
+BENCHMARK(BM_Map_Build)->Range(1 << 10, 1 << 20);
+
+static void BM_FlatMap_Build(benchmark::State& state) {
+  runBuild<s21::FlatMap<int, int>>(state, randomItems(state.range(0)));
+}
+BENCHMARK(BM_FlatMap_Build)->Range(1 << 10, 1 << 20);
+
+// every insert shifts the tail: quadratic, kept small
+static void BM_FlatMap_BuildOneByOne(benchmark::State& state) {
+  const std::vector<std::pair<int, int>> items = randomItems(state.range(0));
+
+  for (auto _ : state) {
+    s21::FlatMap<int, int> map;
+    for (const auto &item : items) {
+      map.insert(item);
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * items.size());
+}
+BENCHMARK(BM_FlatMap_BuildOneByOne)->Range(1 << 10, 1 << 16);
+
+static void BM_Set_Build(benchmark::State& state) {
+  runBuild<s21::Set<int>>(state, randomKeys(state.range(0), 1));
+}
+BENCHMARK(BM_Set_Build)->Range(1 << 10, 1 << 20);
+
+static void BM_FlatSet_Build(benchmark::State& state) {
+  runBuild<s21::FlatSet<int>>(state, randomKeys(state.range(0), 1));
+}
+BENCHMARK(BM_FlatSet_Build)->Range(1 << 10, 1 << 20);
+
+static void BM_Multiset_Build(benchmark::State& state) {
+  runBuild<s21::Multiset<int>>(state, randomKeys(state.range(0), 1));
+}
+BENCHMARK(BM_Multiset_Build)->Range(1 << 10, 1 << 20);
+
+static void BM_FlatMultiset_Build(benchmark::State& state) {
+  runBuild<s21::FlatMultiset<int>>(state, randomKeys(state.range(0), 1));
+}
+BENCHMARK(BM_FlatMultiset_Build)->Range(1 << 10, 1 << 20);
+
+static void BM_Map_LookupHit(benchmark::State& state) {
+  runLookup<s21::Map<int, int>>(state, randomItems(state.range(0)));
+}
+BENCHMARK(BM_Map_LookupHit)->Range(1 << 10, 1 << 20);
+
+static void BM_FlatMap_LookupHit(benchmark::State& state) {
+  runLookup<s21::FlatMap<int, int>>(state, randomItems(state.range(0)));
+}
+BENCHMARK(BM_FlatMap_LookupHit)->Range(1 << 10, 1 << 20);
+
+static void BM_Set_LookupHit(benchmark::State& state) {
+  runLookup<s21::Set<int>>(state, randomKeys(state.range(0), 1));
+}
+BENCHMARK(BM_Set_LookupHit)->Range(1 << 10, 1 << 20);
+
+static void BM_FlatSet_LookupHit(benchmark::State& state) {
+  runLookup<s21::FlatSet<int>>(state, randomKeys(state.range(0), 1));
+}
+BENCHMARK(BM_FlatSet_LookupHit)->Range(1 << 10, 1 << 20);
+
+static void BM_Multiset_LookupHit(benchmark::State& state) {
+  runLookup<s21::Multiset<int>>(state, randomKeys(state.range(0), 1));
+}
+BENCHMARK(BM_Multiset_LookupHit)->Range(1 << 10, 1 << 20);
+
+static void BM_FlatMultiset_LookupHit(benchmark::State& state) {
+  runLookup<s21::FlatMultiset<int>>(state, randomKeys(state.range(0), 1));
+}
+BENCHMARK(BM_FlatMultiset_LookupHit)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_keys.h"
+
+/* ========================================================================= */
+/*                   Searches in sets that outgrow the caches                */
+/* ========================================================================= */
+
+// range(0) random keys, every iteration looks up kProbes of them picked at
+// random (all hits). Structures are built once per benchmark, so iteration
+// counts are fixed instead of being grown by the library (every regrow would
+// build 100M keys again). Set stops at 10M: 100M tree nodes do not fit in memory
+static constexpr size_t kProbes = 1 << 20;
+
+static std::vector<int> randomProbes(const std::vector<int> &keys) {
+  std::vector<int> probes(kProbes);
+  unsigned long long seed = 3;
+
+  for (int &probe : probes) {
+    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    probe = keys[(seed >> 33) % keys.size()];
+  }
+
+  return probes;
+}
+
+template <typename Search>
+static void runSearch(benchmark::State& state, const std::vector<int> &probes, Search search) {
+  for (auto _ : state) {
+    size_t found = 0;
+    for (int key : probes) {
+      found += search(key);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+static void BM_Set_Contains(benchmark::State& state) {
+  const std::vector<int> keys = randomKeys(state.range(0), 1);
+  s21::Set<int> set;
+  for (int key : keys) {
+    set.insert(key);
+  }
+
+  runSearch(state, randomProbes(keys), [&set](int key) { return set.contains(key); });
+}
+BENCHMARK(BM_Set_Contains)->Arg(1 << 20)->Arg(10 << 20)->Iterations(5);
+
+static void BM_BinarySearch_Contains(benchmark::State& state) {
+  std::vector<int> keys = randomKeys(state.range(0), 1);
+  const std::vector<int> probes = randomProbes(keys);
+  std::sort(keys.begin(), keys.end());
+
+  runSearch(state, probes, [&keys](int key) { return std::binary_search(keys.begin(), keys.end(), key); });
+}
+BENCHMARK(BM_BinarySearch_Contains)->Arg(1 << 20)->Arg(10 << 20)->Arg(100 << 20)->Iterations(5);
+
+static void BM_FlatSet_Contains(benchmark::State& state) {
+  const std::vector<int> keys = randomKeys(state.range(0), 1);
+  s21::FlatSet<int> set;
+  set.insert_range(keys.begin(), keys.end());
+
+  runSearch(state, randomProbes(keys), [&set](int key) { return set.contains(key); });
+}
+BENCHMARK(BM_FlatSet_Contains)->Arg(1 << 20)->Arg(10 << 20)->Arg(100 << 20)->Iterations(5);
+
+static void BM_FrozenSet_Contains(benchmark::State& state) {
+  const std::vector<int> keys = randomKeys(state.range(0), 1);
+  const s21::FrozenSet<int> set(keys.begin(), keys.end());
+
+  runSearch(state, randomProbes(keys), [&set](int key) { return set.contains(key); });
+}
+BENCHMARK(BM_FrozenSet_Contains)->Arg(1 << 20)->Arg(10 << 20)->Arg(100 << 20)->Iterations(5);
+
+static void BM_FrozenSet_LowerBound(benchmark::State& state) {
+  const std::vector<int> keys = randomKeys(state.range(0), 1);
+  const s21::FrozenSet<int> set(keys.begin(), keys.end());
+
+  // probes are shifted so that most of them are misses
+  std::vector<int> probes = randomProbes(keys);
+  for (int &probe : probes) {
+    probe ^= 1;
+  }
+
+  runSearch(state, probes, [&set](int key) { return set.lower_bound(key) != set.end(); });
+}
+BENCHMARK(BM_FrozenSet_LowerBound)->Arg(1 << 20)->Arg(10 << 20)->Arg(100 << 20)->Iterations(5);
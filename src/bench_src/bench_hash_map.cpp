@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <utility>
+#include <unordered_map>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_keys.h"
+
+/* ========================================================================= */
+/*                        Unordered lookups and inserts                      */
+/* ========================================================================= */
+
+// range(0) random keys, the same for every map. Lookups go over the same keys
+// shuffled (all hits, not in insertion order, so that node based maps do not
+// walk their nodes in allocation order) or over keys that were never inserted
+// (all misses)
+template <typename MapType>
+static void runInsert(benchmark::State& state) {
+  const std::vector<int> keys = randomKeys(state.range(0), 1);
+
+  for (auto _ : state) {
+    MapType map;
+    for (int key : keys) {
+      map.insert(std::make_pair(key, key));
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// lookups through contains (every map in the library has it, std one has count)
+template <typename MapType>
+static bool has(MapType &map, int key) { return map.contains(key); }
+
+static bool has(std::unordered_map<int, int> &map, int key) { return map.count(key) != 0; }
+
+template <typename MapType>
+static void runLookup(benchmark::State& state, bool hit) {
+  const std::vector<int> keys = randomKeys(state.range(0), 1);
+  const std::vector<int> probes = hit ? shuffled(keys, 3) : randomKeys(state.range(0), 2);
+  MapType map;
+
+  for (int key : keys) {
+    map.insert(std::make_pair(key, key));
+  }
+
+  for (auto _ : state) {
+    size_t found = 0;
+    for (int key : probes) {
+      found += has(map, key);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+static void BM_Map_Insert(benchmark::State& state) { runInsert<s21::Map<int, int>>(state); }
+BENCHMARK(BM_Map_Insert)->Range(1 << 10, 1 << 20);
+
+static void BM_HashMap_Insert(benchmark::State& state) { runInsert<s21::HashMap<int, int>>(state); }
+BENCHMARK(BM_HashMap_Insert)->Range(1 << 10, 1 << 20);
+
+static void BM_StdUnorderedMap_Insert(benchmark::State& state) {
+  runInsert<std::unordered_map<int, int>>(state);
+}
+BENCHMARK(BM_StdUnorderedMap_Insert)->Range(1 << 10, 1 << 20);
+
+static void BM_Map_LookupHit(benchmark::State& state) { runLookup<s21::Map<int, int>>(state, true); }
+BENCHMARK(BM_Map_LookupHit)->Range(1 << 10, 1 << 20);
+
+static void BM_HashMap_LookupHit(benchmark::State& state) { runLookup<s21::HashMap<int, int>>(state, true); }
+BENCHMARK(BM_HashMap_LookupHit)->Range(1 << 10, 1 << 20);
+
+static void BM_StdUnorderedMap_LookupHit(benchmark::State& state) {
+  runLookup<std::unordered_map<int, int>>(state, true);
+}
+BENCHMARK(BM_StdUnorderedMap_LookupHit)->Range(1 << 10, 1 << 20);
+
+static void BM_Map_LookupMiss(benchmark::State& state) { runLookup<s21::Map<int, int>>(state, false); }
+BENCHMARK(BM_Map_LookupMiss)->Range(1 << 10, 1 << 20);
+
+static void BM_HashMap_LookupMiss(benchmark::State& state) { runLookup<s21::HashMap<int, int>>(state, false); }
+BENCHMARK(BM_HashMap_LookupMiss)->Range(1 << 10, 1 << 20);
+
+static void BM_StdUnorderedMap_LookupMiss(benchmark::State& state) {
+  runLookup<std::unordered_map<int, int>>(state, false);
+}
+BENCHMARK(BM_StdUnorderedMap_LookupMiss)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+/* ========================================================================= */
+/*                   Group probing at a fixed load factor                    */
+/* ========================================================================= */
+
+// the table has range(0) slots and is filled up to range(1) / 8 of them
+// (4 is load factor 0.5, 7 is 0.875, the most the table allows). Lookups go
+// over inserted keys in shuffled order (hits) or over other keys (misses).
+// Build with -DS21_HASH_PORTABLE to compare against the portable group matching
+static const unsigned kSeed = 1;
+
+static int intKey(unsigned i) { return static_cast<int>(i * 2654435761u); }
+
+static std::string stringKey(unsigned i) { return "user:" + std::to_string(i * 2654435761u); }
+
+template <typename T, typename MakeKey>
+static std::vector<T> makeKeys(size_t first, size_t count, MakeKey make, bool shuffle) {
+  std::vector<T> keys;
+  keys.reserve(count);
+
+  for (size_t i = first; i < first + count; ++i) {
+    keys.push_back(make(static_cast<unsigned>(i)));
+  }
+
+  unsigned seed = kSeed;
+  for (size_t i = keys.size(); shuffle && i > 1; --i) {
+    seed = seed * 1103515245u + 12345u;
+    std::swap(keys[i - 1], keys[(seed >> 8) % i]);
+  }
+
+  return keys;
+}
+
+template <typename T, typename MakeKey>
+static void runLookup(benchmark::State& state, MakeKey make, bool hit) {
+  const size_t slots = state.range(0);
+  const size_t count = slots * state.range(1) / 8;
+  const std::vector<T> keys = makeKeys<T>(0, count, make, false);
+  const std::vector<T> probes = hit ? makeKeys<T>(0, count, make, true)
+                                    : makeKeys<T>(count, count, make, true);
+
+  s21::HashSet<T> set;
+  set.reserve(count);
+  for (const T &key : keys) {
+    set.insert(key);
+  }
+
+  if (set.bucket_count() != slots) {
+    state.SkipWithError("unexpected table size");
+    return;
+  }
+
+  for (auto _ : state) {
+    size_t found = 0;
+    for (const T &key : probes) {
+      found += set.contains(key);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+
+  state.counters["load"] = set.load_factor();
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+// inserts into a table that already has room, so no rehash is measured
+template <typename T, typename MakeKey>
+static void runInsert(benchmark::State& state, MakeKey make) {
+  const size_t slots = state.range(0);
+  const size_t count = slots * state.range(1) / 8;
+  const std::vector<T> keys = makeKeys<T>(0, count, make, false);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::HashSet<T> set;
+    set.reserve(count);
+    state.ResumeTiming();
+
+    for (const T &key : keys) {
+      set.insert(key);
+    }
+    benchmark::DoNotOptimize(set.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+static void loadFactors(benchmark::internal::Benchmark *benchmark) {
+  for (int slots : { 1 << 14, 1 << 20 }) {
+    for (int eighths : { 4, 7 }) {
+      benchmark->Args({ slots, eighths });
+    }
+  }
+}
+
+static void BM_HashSetInt_LookupHit(benchmark::State& state) { runLookup<int>(state, intKey, true); }
+BENCHMARK(BM_HashSetInt_LookupHit)->Apply(loadFactors);
+
+static void BM_HashSetInt_LookupMiss(benchmark::State& state) { runLookup<int>(state, intKey, false); }
+BENCHMARK(BM_HashSetInt_LookupMiss)->Apply(loadFactors);
+
+static void BM_HashSetInt_Insert(benchmark::State& state) { runInsert<int>(state, intKey); }
+BENCHMARK(BM_HashSetInt_Insert)->Apply(loadFactors);
+
+static void BM_HashSetString_LookupHit(benchmark::State& state) {
+  runLookup<std::string>(state, stringKey, true);
+}
+BENCHMARK(BM_HashSetString_LookupHit)->Apply(loadFactors);
+
+static void BM_HashSetString_LookupMiss(benchmark::State& state) {
+  runLookup<std::string>(state, stringKey, false);
+}
+BENCHMARK(BM_HashSetString_LookupMiss)->Apply(loadFactors);
+
+static void BM_HashSetString_Insert(benchmark::State& state) { runInsert<std::string>(state, stringKey); }
+BENCHMARK(BM_HashSetString_Insert)->Apply(loadFactors);
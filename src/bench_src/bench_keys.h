@@ -0,0 +1,38 @@
+#ifndef S21_BENCH_KEYS_H_
+#define S21_BENCH_KEYS_H_
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// keys shared by the benchmarks: one generator for all of them, so that the
+// containers of different files are measured on the same keys for a seed
+
+/**
+ * @brief n pseudo random non-negative keys, the same ones for the same seed
+*/
+inline std::vector<int> randomKeys(size_t n, unsigned seed) {
+  std::vector<int> keys(n);
+
+  for (size_t i = 0; i < n; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    keys[i] = static_cast<int>(seed >> 1);
+  }
+
+  return keys;
+}
+
+/**
+ * @brief The keys in a pseudo random order (Fisher-Yates), the same one for the same seed
+*/
+template <typename Key>
+std::vector<Key> shuffled(std::vector<Key> keys, unsigned seed) {
+  for (size_t i = keys.size(); i > 1; --i) {
+    seed = seed * 1103515245u + 12345u;
+    std::swap(keys[i - 1], keys[(seed >> 8) % i]);
+  }
+
+  return keys;
+}
+
+#endif  // S21_BENCH_KEYS_H_
@@ -0,0 +1,197 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "../s21_containers.h"
+
+/* ========================================================================= */
+/*                                   List                                    */
+/* ========================================================================= */
+
+// for (i: 0..n) list.get(i) used to be O(n^2), with the cursor it is linear,
+// so time per element should stay flat as the list grows
+static void BM_List_SequentialGet(benchmark::State& state) {
+  const size_t n = state.range(0);
+  s21::List<int> list(n);
+
+  for (auto _ : state) {
+    long long sum = 0;
+    for (size_t i = 0; i < n; ++i) {
+      sum += list.get(i);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetComplexityN(state.range(0));
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_List_SequentialGet)->RangeMultiplier(4)->Range(1 << 10, 1 << 18)->Complexity();
+
+static void BM_List_ReverseGet(benchmark::State& state) {
+  const size_t n = state.range(0);
+  s21::List<int> list(n);
+
+  for (auto _ : state) {
+    long long sum = 0;
+    for (size_t i = n; i > 0; --i) {
+      sum += list.get(i - 1);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetComplexityN(state.range(0));
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_List_ReverseGet)->RangeMultiplier(4)->Range(1 << 10, 1 << 18)->Complexity();
+
+// stride access still walks from the cursor, only the distance is bigger
+static void BM_List_StridedGet(benchmark::State& state) {
+  const size_t n = state.range(0);
+  const size_t stride = 16;
+  s21::List<int> list(n);
+
+  for (auto _ : state) {
+    long long sum = 0;
+    for (size_t i = 0; i < n; i += stride) {
+      sum += list.get(i);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_List_StridedGet)->RangeMultiplier(4)->Range(1 << 10, 1 << 18)->Complexity();
+
+// bulk loading: one push per element against a single block for the whole range
+static void BM_List_BulkLoad_PushBack(benchmark::State& state) {
+  const int n = state.range(0);
+
+  for (auto _ : state) {
+    s21::List<int> list;
+    for (int i = 0; i < n; ++i) {
+      list.pushBack(i);
+    }
+    benchmark::DoNotOptimize(list.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_List_BulkLoad_PushBack)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+static void BM_List_BulkLoad_RangeConstructor(benchmark::State& state) {
+  const int n = state.range(0);
+  std::vector<int> source(n);
+  for (int i = 0; i < n; ++i) {
+    source[i] = i;
+  }
+
+  for (auto _ : state) {
+    s21::List<int> list(source.begin(), source.end());
+    benchmark::DoNotOptimize(list.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_List_BulkLoad_RangeConstructor)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+static void BM_List_BulkLoad_AppendRange(benchmark::State& state) {
+  const int n = state.range(0);
+  std::vector<int> source(n / 10);
+
+  for (auto _ : state) {
+    s21::List<int> list;
+    for (int chunk = 0; chunk < 10; ++chunk) {
+      list.append_range(source);
+    }
+    benchmark::DoNotOptimize(list.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_List_BulkLoad_AppendRange)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+static void BM_List_BulkLoad_CopyConstructor(benchmark::State& state) {
+  const int n = state.range(0);
+  s21::List<int> source(n);
+
+  for (auto _ : state) {
+    s21::List<int> list(source);
+    benchmark::DoNotOptimize(list.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_List_BulkLoad_CopyConstructor)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+// filtering half of a 10M element list
+static void BM_List_Filter_RemoveIf(benchmark::State& state) {
+  const int n = state.range(0);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::List<int> list(n);
+    int i = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+      *it = i++;
+    }
+    state.ResumeTiming();
+
+    size_t removed = list.remove_if([](int x) { return x % 2 == 0; });
+    benchmark::DoNotOptimize(removed);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_List_Filter_RemoveIf)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+// the same thing done by hand through iterators and erase
+static void BM_List_Filter_IteratorErase(benchmark::State& state) {
+  const int n = state.range(0);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::List<int> list(n);
+    int i = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+      *it = i++;
+    }
+    state.ResumeTiming();
+
+    auto it = list.begin();
+    while (it != list.end()) {
+      if (*it % 2 == 0) {
+        list.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    benchmark::DoNotOptimize(list.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_List_Filter_IteratorErase)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+// remove(value) rescans from the head for every value, so it is only
+// measured on a much smaller list
+static void BM_List_Filter_RepeatedRemove(benchmark::State& state) {
+  const int n = state.range(0);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::List<int> list(n);
+    int i = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+      *it = i++;
+    }
+    state.ResumeTiming();
+
+    for (int value = 0; value < n; value += 2) {
+      list.remove(value);
+    }
+    benchmark::DoNotOptimize(list.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_List_Filter_RepeatedRemove)->Arg(20'000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+/* ========================================================================= */
+/*                     Multimap with skewed key frequencies                  */
+/* ========================================================================= */
+
+// kValues values over kKeys distinct keys. range(0) picks how keys are drawn:
+// 0 - uniform, 1 - Zipf with s = 1 (a few keys hold most values), 2 - Zipf with
+// s = 1.5 (the first key alone holds ~40% of the values). Range lookups probe
+// keys drawn the same way and sum the values of each key
+static constexpr int kKeys = 4096;
+static constexpr int kValues = 1 << 16;
+static constexpr int kProbes = 1 << 10;
+
+static std::vector<int> skewedKeys(int count, int distribution, unsigned seed) {
+  const double exponent = distribution == 1 ? 1.0 : 1.5;
+  std::vector<double> cumulative(kKeys);
+  double total = 0;
+
+  for (int key = 0; key < kKeys; ++key) {
+    total += distribution == 0 ? 1.0 : 1.0 / std::pow(key + 1, exponent);
+    cumulative[key] = total;
+  }
+
+  std::vector<int> keys(count);
+
+  for (int i = 0; i < count; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    const double point = (seed >> 8) / static_cast<double>(1u << 24) * total;
+    keys[i] = std::upper_bound(cumulative.begin(), cumulative.end(), point) - cumulative.begin();
+    keys[i] = std::min(keys[i], kKeys - 1);
+  }
+
+  return keys;
+}
+
+template <typename MapType>
+static void fill(MapType &map, const std::vector<int> &keys) {
+  for (size_t i = 0; i < keys.size(); ++i) {
+    map.insert({keys[i], static_cast<int>(i)});
+  }
+}
+
+template <typename MapType>
+static void runInsert(benchmark::State& state) {
+  const std::vector<int> keys = skewedKeys(kValues, state.range(0), 1);
+
+  for (auto _ : state) {
+    MapType map;
+    fill(map, keys);
+    benchmark::DoNotOptimize(map.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <typename MapType>
+static void runEqualRange(benchmark::State& state) {
+  const std::vector<int> keys = skewedKeys(kValues, state.range(0), 1);
+  const std::vector<int> probes = skewedKeys(kProbes, state.range(0), 7);
+  MapType map;
+  fill(map, keys);
+
+  size_t visited = 0;
+
+  for (auto _ : state) {
+    long long sum = 0;
+    for (int key : probes) {
+      auto range = map.equal_range(key);
+      for (auto it = range.first; it != range.second; ++it) {
+        sum += *it;
+        ++visited;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  // values are the work, probes of popular keys read a lot more of them
+  state.SetItemsProcessed(visited);
+}
+
+static void BM_MultimapInsert(benchmark::State& state) {
+  runInsert<s21::Multimap<int, int>>(state);
+}
+
+static void BM_StdMultimapInsert(benchmark::State& state) {
+  runInsert<std::multimap<int, int>>(state);
+}
+
+static void BM_MultimapEqualRange(benchmark::State& state) {
+  runEqualRange<s21::Multimap<int, int>>(state);
+}
+
+// std::multimap iterators dereference to the pair, sum the mapped values
+struct StdMultimap : std::multimap<int, int> {
+  struct Range {
+    struct Iterator {
+      std::multimap<int, int>::iterator it;
+      int operator*() const { return it->second; }
+      Iterator& operator++() { ++it; return *this; }
+      bool operator!=(const Iterator &other) const { return it != other.it; }
+    };
+
+    Iterator first;
+    Iterator second;
+  };
+
+  Range equal_range(int key) {
+    auto range = std::multimap<int, int>::equal_range(key);
+    return Range{ {range.first}, {range.second} };
+  }
+};
+
+static void BM_StdMultimapEqualRange(benchmark::State& state) {
+  runEqualRange<StdMultimap>(state);
+}
+
+BENCHMARK(BM_MultimapInsert)->DenseRange(0, 2);
+BENCHMARK(BM_StdMultimapInsert)->DenseRange(0, 2);
+BENCHMARK(BM_MultimapEqualRange)->DenseRange(0, 2);
+BENCHMARK(BM_StdMultimapEqualRange)->DenseRange(0, 2);
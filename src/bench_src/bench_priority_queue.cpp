@@ -0,0 +1,281 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+static std::vector<int> randomValues(size_t n) {
+  std::vector<int> values(n);
+  unsigned state = 2463534242u;
+
+  for (size_t i = 0; i < n; ++i) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    values[i] = static_cast<int>(state >> 1);
+  }
+
+  return values;
+}
+
+/* ========================================================================= */
+/*                              Push then Pop                                */
+/* ========================================================================= */
+
+template <typename Queue>
+static void runPushPop(benchmark::State& state) {
+  const std::vector<int> values = randomValues(state.range(0));
+
+  for (auto _ : state) {
+    Queue queue;
+    for (int value : values) {
+      queue.push(value);
+    }
+    while (!queue.empty()) {
+      benchmark::DoNotOptimize(queue.top());
+      queue.pop();
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PriorityQueue_Binary_PushPop(benchmark::State& state) {
+  runPushPop<s21::PriorityQueue<int, std::less<int>, 2>>(state);
+}
+BENCHMARK(BM_PriorityQueue_Binary_PushPop)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+static void BM_PriorityQueue_4ary_PushPop(benchmark::State& state) {
+  runPushPop<s21::PriorityQueue<int>>(state);
+}
+BENCHMARK(BM_PriorityQueue_4ary_PushPop)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+static void BM_StdPriorityQueue_PushPop(benchmark::State& state) {
+  runPushPop<std::priority_queue<int>>(state);
+}
+BENCHMARK(BM_StdPriorityQueue_PushPop)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+/* ========================================================================= */
+/*                                 Heapify                                   */
+/* ========================================================================= */
+
+static void BM_PriorityQueue_Heapify(benchmark::State& state) {
+  const std::vector<int> values = randomValues(state.range(0));
+
+  for (auto _ : state) {
+    s21::PriorityQueue<int> queue(values.begin(), values.end());
+    benchmark::DoNotOptimize(queue.top());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PriorityQueue_Heapify)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+static void BM_StdPriorityQueue_Heapify(benchmark::State& state) {
+  const std::vector<int> values = randomValues(state.range(0));
+
+  for (auto _ : state) {
+    std::priority_queue<int> queue(values.begin(), values.end());
+    benchmark::DoNotOptimize(queue.top());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdPriorityQueue_Heapify)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+// the thing we are replacing: a sorted s21::List with insertion by linear scan
+static void BM_SortedList_PushPop(benchmark::State& state) {
+  const std::vector<int> values = randomValues(state.range(0));
+
+  for (auto _ : state) {
+    s21::List<int> list;
+    for (int value : values) {
+      auto it = list.begin();
+      while (it != list.end() && *it > value) {
+        ++it;
+      }
+      list.insert(it, value);
+    }
+    while (!list.empty()) {
+      benchmark::DoNotOptimize(list.front());
+      list.popFront();
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SortedList_PushPop)->Range(1 << 10, 1 << 14)->Unit(benchmark::kMicrosecond);
+
+/* ========================================================================= */
+/*                         Dijkstra (decrease-key)                           */
+/* ========================================================================= */
+
+// random graph: every vertex has kDegree outgoing edges with random weights
+static const int kDegree = 8;
+
+struct Graph {
+  int vertices_;
+  std::vector<int> targets_;
+  std::vector<int> weights_;
+};
+
+static const Graph& randomGraph(int vertices) {
+  static Graph graph{ 0, {}, {} };
+
+  if (graph.vertices_ != vertices) {
+    std::vector<int> random = randomValues(static_cast<size_t>(vertices) * kDegree * 2);
+    graph.vertices_ = vertices;
+    graph.targets_.resize(static_cast<size_t>(vertices) * kDegree);
+    graph.weights_.resize(static_cast<size_t>(vertices) * kDegree);
+    for (size_t e = 0; e < graph.targets_.size(); ++e) {
+      graph.targets_[e] = random[2 * e] % vertices;
+      graph.weights_[e] = 1 + random[2 * e + 1] % 1000;
+    }
+  }
+
+  return graph;
+}
+
+struct Distance {
+  long distance_ = 0;
+  int vertex_ = 0;
+
+  bool operator>(const Distance &other) const { return distance_ > other.distance_; }
+};
+
+// decrease-key through handles, every vertex is in the queue at most once
+template <typename Queue>
+static void runDijkstra(benchmark::State& state) {
+  const Graph &graph = randomGraph(state.range(0));
+
+  for (auto _ : state) {
+    std::vector<long> distance(graph.vertices_, -1);
+    std::vector<bool> queued(graph.vertices_, false);
+    std::vector<typename Queue::Handle> handles(graph.vertices_);
+    Queue queue;
+
+    handles[0] = queue.push(Distance{ 0, 0 });
+    queued[0] = true;
+    distance[0] = 0;
+
+    while (!queue.empty()) {
+      Distance current = queue.top();
+      queue.pop();
+      queued[current.vertex_] = false;
+
+      for (int e = current.vertex_ * kDegree; e < (current.vertex_ + 1) * kDegree; ++e) {
+        int target = graph.targets_[e];
+        long candidate = current.distance_ + graph.weights_[e];
+
+        if (distance[target] == -1 || candidate < distance[target]) {
+          if (queued[target]) {
+            queue.decrease_key(handles[target], Distance{ candidate, target });
+          } else if (distance[target] == -1) {
+            handles[target] = queue.push(Distance{ candidate, target });
+            queued[target] = true;
+          }
+          distance[target] = candidate;
+        }
+      }
+    }
+
+    benchmark::DoNotOptimize(distance.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_PriorityQueue_Dijkstra(benchmark::State& state) {
+  runDijkstra<s21::PriorityQueue<Distance, std::greater<Distance>>>(state);
+}
+BENCHMARK(BM_PriorityQueue_Dijkstra)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond);
+
+// std::priority_queue has no decrease-key, so stale duplicates are pushed and skipped
+static void BM_StdPriorityQueue_Dijkstra(benchmark::State& state) {
+  const Graph &graph = randomGraph(state.range(0));
+
+  for (auto _ : state) {
+    std::vector<long> distance(graph.vertices_, -1);
+    std::priority_queue<Distance, std::vector<Distance>, std::greater<Distance>> queue;
+
+    queue.push(Distance{ 0, 0 });
+    distance[0] = 0;
+
+    while (!queue.empty()) {
+      Distance current = queue.top();
+      queue.pop();
+
+      if (current.distance_ != distance[current.vertex_]) {
+        continue; // stale entry
+      }
+
+      for (int e = current.vertex_ * kDegree; e < (current.vertex_ + 1) * kDegree; ++e) {
+        int target = graph.targets_[e];
+        long candidate = current.distance_ + graph.weights_[e];
+
+        if (distance[target] == -1 || candidate < distance[target]) {
+          distance[target] = candidate;
+          queue.push(Distance{ candidate, target });
+        }
+      }
+    }
+
+    benchmark::DoNotOptimize(distance.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdPriorityQueue_Dijkstra)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond);
+
+static void BM_PairingHeap_Dijkstra(benchmark::State& state) {
+  runDijkstra<s21::PairingHeap<Distance, std::greater<Distance>>>(state);
+}
+BENCHMARK(BM_PairingHeap_Dijkstra)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond);
+
+// distances only grow while Dijkstra runs, so they can be radix heap keys
+static void BM_RadixHeap_Dijkstra(benchmark::State& state) {
+  using Queue = s21::RadixHeap<int>;
+  const Graph &graph = randomGraph(state.range(0));
+
+  for (auto _ : state) {
+    std::vector<long> distance(graph.vertices_, -1);
+    std::vector<bool> queued(graph.vertices_, false);
+    std::vector<Queue::Handle> handles(graph.vertices_);
+    Queue queue;
+
+    handles[0] = queue.push(0, 0);
+    queued[0] = true;
+    distance[0] = 0;
+
+    while (!queue.empty()) {
+      int vertex = queue.top();
+      long current = static_cast<long>(queue.top_key());
+      queue.pop();
+      queued[vertex] = false;
+
+      for (int e = vertex * kDegree; e < (vertex + 1) * kDegree; ++e) {
+        int target = graph.targets_[e];
+        long candidate = current + graph.weights_[e];
+
+        if (distance[target] == -1 || candidate < distance[target]) {
+          if (queued[target]) {
+            queue.decrease_key(handles[target], static_cast<uint64_t>(candidate));
+          } else if (distance[target] == -1) {
+            handles[target] = queue.push(static_cast<uint64_t>(candidate), target);
+            queued[target] = true;
+          }
+          distance[target] = candidate;
+        }
+      }
+    }
+
+    benchmark::DoNotOptimize(distance.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RadixHeap_Dijkstra)->Range(1 << 12, 1 << 18)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "../s21_containers.h"
+
+/* ========================================================================= */
+/*                    Batched vs per-element consumption                     */
+/* ========================================================================= */
+
+// producer fills range(0) messages, consumer takes them either one by one
+// (front + pop, front gives a const reference, so a message is copied) or in
+// batches of kBatch with drain into a reused Vector (messages are moved).
+// Messages are longer than the small string buffer, so a copy allocates
+static const size_t kBatch = 64;
+static const std::string kMessage(48, 'x');
+
+static void BM_Queue_PopEach(benchmark::State& state) {
+  const int n = state.range(0);
+  s21::Queue<std::string> queue;
+
+  for (auto _ : state) {
+    for (int i = 0; i < n; ++i) {
+      queue.push(kMessage);
+    }
+
+    long long sum = 0;
+    while (!queue.empty()) {
+      std::string message = queue.front();
+      queue.pop();
+      sum += message.size();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Queue_PopEach)->Range(1 << 10, 1 << 18);
+
+static void BM_Queue_Drain(benchmark::State& state) {
+  const int n = state.range(0);
+  s21::Queue<std::string> queue;
+  s21::Vector<std::string> batch;
+
+  for (auto _ : state) {
+    for (int i = 0; i < n; ++i) {
+      queue.push(kMessage);
+    }
+
+    long long sum = 0;
+    while (!queue.empty()) {
+      batch.clear();
+      queue.drain(batch, kBatch);
+      for (const std::string &message : batch) {
+        sum += message.size();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Queue_Drain)->Range(1 << 10, 1 << 18);
+
+static void BM_Stack_PopEach(benchmark::State& state) {
+  const int n = state.range(0);
+  s21::Stack<std::string> stack;
+
+  for (auto _ : state) {
+    for (int i = 0; i < n; ++i) {
+      stack.push(kMessage);
+    }
+
+    long long sum = 0;
+    while (!stack.empty()) {
+      std::string message = std::move(stack.top());
+      stack.pop();
+      sum += message.size();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Stack_PopEach)->Range(1 << 10, 1 << 18);
+
+static void BM_Stack_Drain(benchmark::State& state) {
+  const int n = state.range(0);
+  s21::Stack<std::string> stack;
+  s21::Vector<std::string> batch;
+
+  for (auto _ : state) {
+    for (int i = 0; i < n; ++i) {
+      stack.push(kMessage);
+    }
+
+    long long sum = 0;
+    while (!stack.empty()) {
+      batch.clear();
+      stack.drain(batch, kBatch);
+      for (const std::string &message : batch) {
+        sum += message.size();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_Stack_Drain)->Range(1 << 10, 1 << 18);
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include <stack>
+#include <vector>
+
+#include "../s21_containers.h"
+
+/* ========================================================================= */
+/*                          DFS push/pop churn                               */
+/* ========================================================================= */
+
+// depth first walk of an implicit tree: every popped node pushes its
+// children until range(0) nodes are visited, then the rest is drained. Small
+// walks stay in the inline buffer, big ones grow the stack to about
+// 2 * range(0) elements
+static const int kFanout = 3;
+
+template <typename PushFunc, typename PopFunc, typename EmptyFunc>
+static long long walk(size_t nodes, PushFunc push, PopFunc pop, EmptyFunc empty) {
+  long long sum = 0;
+  size_t visited = 0;
+
+  push(1u);
+  while (!empty()) {
+    unsigned node = pop();
+    sum += node;
+
+    if (++visited < nodes) {
+      for (int i = 0; i < kFanout; ++i) {
+        push(node * kFanout + i);
+      }
+    }
+  }
+
+  return sum;
+}
+
+static void BM_Stack_DfsChurn(benchmark::State& state) {
+  for (auto _ : state) {
+    s21::Stack<unsigned> stack;
+    long long sum = walk(
+        state.range(0), [&](unsigned v) { stack.push(v); },
+        [&]() { unsigned v = stack.top(); stack.pop(); return v; },
+        [&]() { return stack.empty(); });
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Stack_DfsChurn)->Range(1 << 8, 1 << 18);
+
+// what Stack was before: a List underneath
+static void BM_ListAsStack_DfsChurn(benchmark::State& state) {
+  for (auto _ : state) {
+    s21::List<unsigned> list;
+    long long sum = walk(
+        state.range(0), [&](unsigned v) { list.pushBack(v); },
+        [&]() { unsigned v = list.back(); list.popBack(); return v; },
+        [&]() { return list.empty(); });
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ListAsStack_DfsChurn)->Range(1 << 8, 1 << 18);
+
+static void BM_StdStack_DfsChurn(benchmark::State& state) {
+  for (auto _ : state) {
+    std::stack<unsigned, std::vector<unsigned>> stack;
+    long long sum = walk(
+        state.range(0), [&](unsigned v) { stack.push(v); },
+        [&]() { unsigned v = stack.top(); stack.pop(); return v; },
+        [&]() { return stack.empty(); });
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdStack_DfsChurn)->Range(1 << 8, 1 << 18);
+
+/* ========================================================================= */
+/*                        Tree traversals (BaseTree)                         */
+/* ========================================================================= */
+
+// copy constructor and clear of the tree walk it with a Stack
+static void BM_Map_CopyAndClear(benchmark::State& state) {
+  s21::Map<int, int> map;
+  unsigned random = 7;
+  for (int i = 0; i < state.range(0); ++i) {
+    random = random * 1103515245u + 12345u;
+    map.insert(static_cast<int>(random >> 4), i);
+  }
+
+  for (auto _ : state) {
+    s21::Map<int, int> copy(map);
+    benchmark::DoNotOptimize(copy.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Map_CopyAndClear)->Range(1 << 6, 1 << 16);
@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+/* ========================================================================= */
+/*                        Constant opcode table lookups                      */
+/* ========================================================================= */
+
+// a table of 32 mnemonics looked up in a shuffled order. StaticMap is built by
+// the compiler, the others are built once before the timed loop; the "Build"
+// benchmarks show what a table built at startup costs
+static constexpr std::pair<std::string_view, int> kMnemonics[] = {
+  { "add", 0 },  { "sub", 1 },  { "mul", 2 },  { "div", 3 },  { "mod", 4 },  { "and", 5 },
+  { "or", 6 },   { "xor", 7 },  { "not", 8 },  { "shl", 9 },  { "shr", 10 }, { "jmp", 11 },
+  { "je", 12 },  { "jne", 13 }, { "jl", 14 },  { "jg", 15 },  { "call", 16 }, { "ret", 17 },
+  { "push", 18 }, { "pop", 19 }, { "load", 20 }, { "store", 21 }, { "mov", 22 }, { "cmp", 23 },
+  { "inc", 24 }, { "dec", 25 }, { "neg", 26 }, { "nop", 27 }, { "halt", 28 }, { "in", 29 },
+  { "out", 30 }, { "test", 31 },
+};
+
+static constexpr auto kTable = s21::make_static_map(kMnemonics);
+
+static std::vector<std::string_view> probes() {
+  std::vector<std::string_view> keys;
+  unsigned seed = 1;
+
+  for (int i = 0; i < 1024; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    keys.push_back(kMnemonics[(seed >> 8) % 32].first);
+  }
+
+  return keys;
+}
+
+template <typename Lookup>
+static void runLookup(benchmark::State& state, Lookup lookup) {
+  const std::vector<std::string_view> keys = probes();
+
+  for (auto _ : state) {
+    int sum = 0;
+    for (std::string_view key : keys) {
+      sum += lookup(key);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+static void BM_StaticMapLookup(benchmark::State& state) {
+  runLookup(state, [](std::string_view key) { return kTable.at(key); });
+}
+
+static void BM_MapLookup(benchmark::State& state) {
+  s21::Map<std::string_view, int> map;
+  for (const auto &item : kMnemonics) {
+    map.insert(item);
+  }
+
+  runLookup(state, [&map](std::string_view key) { return map.at(key); });
+}
+
+static void BM_FlatMapLookup(benchmark::State& state) {
+  s21::FlatMap<std::string_view, int> map;
+  for (const auto &item : kMnemonics) {
+    map.insert(item);
+  }
+
+  runLookup(state, [&map](std::string_view key) { return map.at(key); });
+}
+
+static void BM_StdUnorderedMapLookup(benchmark::State& state) {
+  std::unordered_map<std::string_view, int> map(std::begin(kMnemonics), std::end(kMnemonics));
+
+  runLookup(state, [&map](std::string_view key) { return map.at(key); });
+}
+
+static void BM_StaticMapBuild(benchmark::State& state) {
+  for (auto _ : state) {
+    s21::StaticMap<std::string_view, int, 32> map(kMnemonics);
+    benchmark::DoNotOptimize(map);
+  }
+}
+
+static void BM_MapBuild(benchmark::State& state) {
+  for (auto _ : state) {
+    s21::Map<std::string_view, int> map;
+    for (const auto &item : kMnemonics) {
+      map.insert(item);
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+}
+
+BENCHMARK(BM_StaticMapLookup);
+BENCHMARK(BM_MapLookup);
+BENCHMARK(BM_FlatMapLookup);
+BENCHMARK(BM_StdUnorderedMapLookup);
+BENCHMARK(BM_StaticMapBuild);
+BENCHMARK(BM_MapBuild);
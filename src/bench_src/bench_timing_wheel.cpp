@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+/* ========================================================================= */
+/*                          Connection timeouts                              */
+/* ========================================================================= */
+
+// timers are armed with deadlines spread over about an hour (in microseconds),
+// every other one is cancelled (connection answered in time), the rest expire
+// while time goes forward in steps of 100 ms. Deadlines are unique: Multiset
+// erase drops all copies of a key
+static const uint64_t kHorizon = uint64_t(1) << 32;
+static const uint64_t kStep = 100 * 1000;
+
+static std::vector<uint64_t> randomDeadlines(size_t n) {
+  std::vector<uint64_t> deadlines(n);
+
+  // multiplication by an odd number is a permutation of 32 bit values
+  for (size_t i = 0; i < n; ++i) {
+    deadlines[i] = 1 + static_cast<uint32_t>(i * 2654435761u);
+  }
+
+  return deadlines;
+}
+
+static void BM_TimingWheel_Timeouts(benchmark::State& state) {
+  using Wheel = s21::TimingWheel<uint32_t>;
+  const std::vector<uint64_t> deadlines = randomDeadlines(state.range(0));
+  std::vector<Wheel::Handle> handles(deadlines.size());
+
+  for (auto _ : state) {
+    Wheel wheel;
+    size_t fired = 0;
+
+    for (size_t i = 0; i < deadlines.size(); ++i) {
+      handles[i] = wheel.schedule(deadlines[i], static_cast<uint32_t>(i));
+    }
+
+    for (size_t i = 0; i < deadlines.size(); i += 2) {
+      wheel.cancel(handles[i]);
+    }
+
+    for (uint64_t now = 0; now <= kHorizon; now += kStep) {
+      fired += wheel.advance(now, [](uint32_t id) { benchmark::DoNotOptimize(id); });
+    }
+
+    benchmark::DoNotOptimize(fired);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TimingWheel_Timeouts)->Arg(1 << 20)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+// the way timeouts were kept before: a Multiset of deadlines, expiry pops
+// the smallest deadlines off the tree
+static void BM_Multiset_Timeouts(benchmark::State& state) {
+  const std::vector<uint64_t> deadlines = randomDeadlines(state.range(0));
+
+  for (auto _ : state) {
+    s21::Multiset<uint64_t> timers;
+    size_t fired = 0;
+
+    for (uint64_t deadline : deadlines) {
+      timers.insert(deadline);
+    }
+
+    for (size_t i = 0; i < deadlines.size(); i += 2) {
+      timers.erase(timers.find(deadlines[i]));
+    }
+
+    for (uint64_t now = 0; now <= kHorizon; now += kStep) {
+      while (!timers.empty() && *timers.begin() <= now) {
+        timers.erase(timers.begin());
+        ++fired;
+      }
+    }
+
+    benchmark::DoNotOptimize(fired);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Multiset_Timeouts)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_keys.h"
+
+/* ========================================================================= */
+/*                    Comparisons per lookup in tree maps                    */
+/* ========================================================================= */
+
+// keys share a long prefix, so every comparison reads it through before the
+// keys differ. Comparators count their calls, the count per lookup is reported
+// as the "comparisons" counter
+static size_t comparisons = 0;
+
+struct CountingLess {
+  bool operator()(const std::string &a, const std::string &b) const {
+    ++comparisons;
+    return a < b;
+  }
+};
+
+struct CountingThreeWay {
+  int operator()(const std::string &a, const std::string &b) const {
+    ++comparisons;
+    return a.compare(b);
+  }
+};
+
+static std::vector<std::string> prefixedKeys(size_t n, unsigned seed) {
+  const std::string prefix(64, 'k');
+  std::vector<std::string> keys;
+  keys.reserve(n);
+
+  for (int key : randomKeys(n, seed)) {
+    keys.push_back(prefix + std::to_string(key));
+  }
+
+  return keys;
+}
+
+template <typename MapType>
+static void fill(MapType &map, const std::vector<std::string> &keys) {
+  for (const std::string &key : keys) {
+    map.insert({key, 0});
+  }
+}
+
+template <typename MapType>
+static void runLookup(benchmark::State& state) {
+  const std::vector<std::string> keys = prefixedKeys(state.range(0), 1);
+  const std::vector<std::string> probes = shuffled(keys, 3);
+  MapType map;
+  fill(map, keys);
+
+  comparisons = 0;
+
+  for (auto _ : state) {
+    size_t found = 0;
+    for (const std::string &key : probes) {
+      found += map.count(key);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+
+  const double lookups = static_cast<double>(state.iterations() * probes.size());
+
+  state.counters["comparisons"] = comparisons / lookups;
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+static void BM_MapLookupLess(benchmark::State& state) {
+  runLookup<s21::Map<std::string, int, CountingLess>>(state);
+}
+
+static void BM_MapLookupThreeWay(benchmark::State& state) {
+  runLookup<s21::Map<std::string, int, CountingThreeWay>>(state);
+}
+
+static void BM_StdMapLookupLess(benchmark::State& state) {
+  runLookup<std::map<std::string, int, CountingLess>>(state);
+}
+
+BENCHMARK(BM_MapLookupLess)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_MapLookupThreeWay)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_StdMapLookupLess)->Arg(1 << 10)->Arg(1 << 16);
@@ -16,11 +16,11 @@ class Array : public Container {
   using size_type = size_t;
   using array_type = Array<T, N>;
 
-  Array();
-  Array(std::initializer_list<T> const &items);
-  Array(const array_type &a);
+  constexpr Array();
+  constexpr Array(std::initializer_list<T> const &items);
+  constexpr Array(const array_type &a);
   Array(array_type &&a) noexcept;
-  ~Array() {}
+  ~Array() = default; // trivial, so that arrays could be constexpr
 
   array_type &operator=(const Array &other);
   array_type &operator=(Array &&a) noexcept;
@@ -50,11 +50,11 @@ class Array : public Container {
   void fill(const_reference value);
 
  private:
-  value_type data_[N];
+  value_type data_[N]{}; // initialized, constexpr constructors need it
 };
 
 template <class T, size_t N>
-s21::Array<T, N>::Array() {
+constexpr s21::Array<T, N>::Array() {
   size_ = N;
   // constexpr T object{};
   // for (size_type i = 0; i < size_; ++i) {
@@ -63,7 +63,7 @@ s21::Array<T, N>::Array() {
 }
 
 template <typename T, size_t N>
-s21::Array<T, N>::Array(std::initializer_list<T> const &items) : Array() {
+constexpr s21::Array<T, N>::Array(std::initializer_list<T> const &items) : Array() {
   size_t i = 0;
   for (auto it = items.begin(); it != items.end() && i < N; ++it, ++i) {
     data_[i] = *it;
@@ -71,7 +71,7 @@ s21::Array<T, N>::Array(std::initializer_list<T> const &items) : Array() {
 }
 
 template <class T, size_t N>
-s21::Array<T, N>::Array(const array_type &a) : Array() {
+constexpr s21::Array<T, N>::Array(const array_type &a) : Array() {
   for (size_type i = 0; i < size_; ++i) {
     data_[i] = a.data_[i];
   }
@@ -1,6 +1,8 @@
 #ifndef S21_BASE_TREE_H_
 #define S21_BASE_TREE_H_
 
+#include <functional>
+#include <type_traits>
 #include <utility>
 #include <iostream>
 #include <vector>
@@ -16,8 +18,16 @@ namespace s21 {
 // At the moment the underlying value structure is a simple binary search tree
 // Later on this should be switched for a balanced version, like red-black tree
 // or AVL
-
-template <typename Key, typename Value>
+//
+// Keys are ordered by Compare. It is either a "less" comparator returning bool
+// or a three-way one returning a signed number (or an ordering like
+// std::strong_ordering) that is negative, zero or positive. A descent makes a
+// single comparison per level with both. With a transparent comparator (one
+// that defines is_transparent, like std::less<>) lookups accept anything
+// comparable with the key, e.g. a string_view for string keys, and no
+// temporary key is built
+
+template <typename Key, typename Value, typename Compare = std::less<Key>>
 class BaseTree : public Container {
 protected:
   // forward declarations for iterators
@@ -52,6 +62,12 @@ protected:
   };
 
   Node* root_ = nullptr;
+  Compare comp_;
+
+  // result of the comparator, bool for a "less" one
+  using Order = decltype(std::declval<const Compare&>()(std::declval<const Key&>(), std::declval<const Key&>()));
+
+  static constexpr bool kThreeWay = std::is_signed<Order>::value || !std::is_convertible<Order, bool>::value;
 
 
 /* ========================================================================= */
@@ -125,6 +141,13 @@ protected: // methods are used by the derived class
   */
   std::pair<Node*, bool> insert(const_key_reference key, const_reference value);
 
+  /**
+   * @brief Inserts a node only if there is no node with the key yet
+   * 
+   * @returns the new node and true, or the existing node and false
+  */
+  std::pair<Node*, bool> insertUnique(const_key_reference key, const_reference value);
+
   /**
    * @brief Finds an element with a specific key in the tree
    * 
@@ -133,7 +156,33 @@ protected: // methods are used by the derived class
    * 
    * @remark DONE
   */
-  Node* find(const_key_reference key) const;
+  Node* find(const_key_reference key) const { return find<Key>(key); }
+
+  /**
+   * @brief Finds an element with a key equivalent to key, which does not have to be a Key
+   * 
+   * @throws ArrayException if element with specified key is not in the tree
+  */
+  template <typename K>
+  Node* find(const K& key) const;
+
+  /**
+   * @brief Finds the first node with a key not less than key, nullptr if there is none
+  */
+  template <typename K>
+  Node* lowerNode(const K& key) const;
+
+  /**
+   * @brief Finds the first node with a key greater than key, nullptr if there is none
+  */
+  template <typename K>
+  Node* upperNode(const K& key) const;
+
+  /**
+   * @brief Finds and returns note in the tree with a given key, nullptr if there is none
+  */
+  template <typename K>
+  Node* findNode(const K& key) const;
 
 
 public: // methods are the part of the derived class interface
@@ -173,7 +222,15 @@ public: // methods are the part of the derived class interface
    * 
    * @remark DONE
   */
-  bool contains(const_key_reference key);
+  bool contains(const_key_reference key) const { return findNode(key) != nullptr; }
+
+  /**
+   * @brief Checks if the container contains an element with a key equivalent to key
+   * 
+   * @note Takes part in overload resolution only if Compare is transparent
+  */
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  bool contains(const K& key) const { return findNode(key) != nullptr; }
 
 
 /* ========================================================================= */
@@ -184,7 +241,7 @@ protected:
 
   class Iterator {
   protected:
-    const BaseTree<key_type, value_type>& tree_;
+    const BaseTree& tree_;
     Node *current_;
 
     /**
@@ -221,11 +278,11 @@ protected:
      * @brief Поиск узла, узел с заданным ключом для которого является его правым потомком
     */
     Node* findRParent(Node *node, const Key& key) const {
-        if (node == nullptr || tree_.root_->key == key) {
+        if (node == nullptr || isRoot(key)) {
             return nullptr;
         }
 
-        if (key > node->key) { // искомый предок должен быть в правом поддереве текущего узла
+        if (tree_.less(node->key, key)) { // искомый предок должен быть в правом поддереве текущего узла
             Node *r_parent = findRParent(node->right, key);
             if (r_parent != nullptr) { // мы нашли искомого предка в правом поддереве
                 return r_parent;
@@ -241,11 +298,11 @@ protected:
      * @brief Поиск узла, узел с заданным ключом для которого является его левым потомком
     */
     Node *findLParent(Node *node, const Key& key) const {
-        if (node == nullptr || tree_.root_->key == key) {
+        if (node == nullptr || isRoot(key)) {
             return nullptr;
         }
 
-        if (key < node->key) { // искомый предок должен быть в левом поддереве текущего узла
+        if (tree_.less(key, node->key)) { // искомый предок должен быть в левом поддереве текущего узла
             Node *l_parent = findLParent(node->left, key);
             if (l_parent != nullptr) { // мы нашли искомого предка в левом поддереве
                 return l_parent;
@@ -257,6 +314,13 @@ protected:
         }
     }
 
+    /**
+     * @brief Проверка, что ключ эквивалентен ключу корня
+    */
+    bool isRoot(const Key& key) const {
+        return tree_.equivalent(tree_.root_->key, key);
+    }
+
     /**
      * @brief Поиск предыдущего узла дерева (поиск узла с наибольшим ключом меньше текущего)
     */
@@ -283,12 +347,12 @@ protected:
     /**
      * @brief Iterator constructor. Sets the current position to the beginning of the tree
     */
-    Iterator(const BaseTree<Key, Value>& tree) : tree_(tree), current_(findMin(tree.root_)) {}
+    Iterator(const BaseTree& tree) : tree_(tree), current_(findMin(tree.root_)) {}
 
     /**
      * @brief Iterator constructor. Sets the current position to the given node
     */
-    Iterator(const BaseTree<Key, Value>& tree, Node* node) : tree_(tree), current_(node) {}
+    Iterator(const BaseTree& tree, Node* node) : tree_(tree), current_(node) {}
 
     /**
      * @brief Copy constructor
@@ -376,12 +440,12 @@ protected:
     /**
      * @brief Iterator constructor. Sets the current position to the beginning of the tree
     */
-    ConstIterator(const BaseTree<Key, Value>& tree) : Iterator(tree) {}
+    ConstIterator(const BaseTree& tree) : Iterator(tree) {}
 
     /**
      * @brief Iterator constructor. Sets the current position to the given node
     */
-    ConstIterator(const BaseTree<Key, Value>& tree, Node *node) : Iterator(tree, node) {}
+    ConstIterator(const BaseTree& tree, Node *node) : Iterator(tree, node) {}
 
     /**
      * @brief Copy constructor
@@ -468,9 +532,47 @@ private:
   bool removeNode(Node *current, Node *parent);
 
   /**
-   * @brief Finds and returns note in the tree with a given key
+   * @brief Walks down from the root looking for a node with a key equivalent to key
+   * 
+   * @returns the node and its parent if it is found, nullptr and the last visited
+   * node (parent of the new node with this key) otherwise
+   * 
+   * @note A three-way comparator tells apart all three cases with one call.
+   * A "less" one only answers key < node: the walk goes right otherwise and
+   * remembers the node, the last remembered one is the only candidate for
+   * equivalence and is checked once at the end
+  */
+  template <typename K>
+  std::pair<Node*, Node*> descend(const K& key) const;
+
+  /**
+   * @brief Links a new node as a child of parent (found by descend) and counts it
   */
-  Node* findNode(const_key_reference key) const;
+  Node* attach(Node* node, Node* parent);
+
+  /**
+   * @brief a < b in terms of the comparator
+  */
+  template <typename A, typename B>
+  bool less(const A& a, const B& b) const {
+    if constexpr (kThreeWay) {
+      return comp_(a, b) < 0;
+    } else {
+      return comp_(a, b);
+    }
+  }
+
+  /**
+   * @brief Neither a < b nor b < a in terms of the comparator
+  */
+  template <typename A, typename B>
+  bool equivalent(const A& a, const B& b) const {
+    if constexpr (kThreeWay) {
+      return comp_(a, b) == 0;
+    } else {
+      return !comp_(a, b) && !comp_(b, a);
+    }
+  }
 
   /**
    * @brief Recursively outputs tree structure to the console
@@ -508,15 +610,15 @@ public:
 /*                       Constructors Implementation                         */
 /* ========================================================================= */
 
-template <typename Key, typename Value>
-BaseTree<Key, Value>::BaseTree(std::initializer_list<std::pair<key_type, value_type> > const &items) {
+template <typename Key, typename Value, typename Compare>
+BaseTree<Key, Value, Compare>::BaseTree(std::initializer_list<std::pair<key_type, value_type> > const &items) {
   for (auto item: items) {
     insert(item.first, item.second);
   }
 }
 
-template <typename Key, typename Value>
-BaseTree<Key, Value>::BaseTree(const BaseTree<Key, Value>& other) {
+template <typename Key, typename Value, typename Compare>
+BaseTree<Key, Value, Compare>::BaseTree(const BaseTree<Key, Value, Compare>& other) : comp_(other.comp_) {
   if (other.root_ == nullptr) {
       return;
   }
@@ -554,8 +656,8 @@ BaseTree<Key, Value>::BaseTree(const BaseTree<Key, Value>& other) {
   this->size_ = other.size_;
 }
 
-template <typename Key, typename Value>
-BaseTree<Key, Value>::BaseTree(BaseTree<Key, Value>&& other) {
+template <typename Key, typename Value, typename Compare>
+BaseTree<Key, Value, Compare>::BaseTree(BaseTree<Key, Value, Compare>&& other) {
   if (this == &other) {
     return;
   }
@@ -563,8 +665,8 @@ BaseTree<Key, Value>::BaseTree(BaseTree<Key, Value>&& other) {
   stealResources(std::move(other));
 }
 
-template <typename Key, typename Value>
-BaseTree<Key, Value>& BaseTree<Key, Value>::operator=(BaseTree<Key, Value> &&other) {
+template <typename Key, typename Value, typename Compare>
+BaseTree<Key, Value, Compare>& BaseTree<Key, Value, Compare>::operator=(BaseTree<Key, Value, Compare> &&other) {
   if (this == &other) {
     return *this;
   }
@@ -582,8 +684,8 @@ BaseTree<Key, Value>& BaseTree<Key, Value>::operator=(BaseTree<Key, Value> &&oth
 /*                         Interface Implementation                          */
 /* ========================================================================= */
 
-template <typename Key, typename Value>
-void BaseTree<Key, Value>::clear() {
+template <typename Key, typename Value, typename Compare>
+void BaseTree<Key, Value, Compare>::clear() {
   if (root_ == nullptr) {
     return;
   }
@@ -609,48 +711,38 @@ void BaseTree<Key, Value>::clear() {
   root_ = nullptr;
 }
 
-template <typename Key, typename Value>
-std::pair<typename BaseTree<Key, Value>::Node*, bool> 
-  BaseTree<Key, Value>::insert(const key_type& key, const value_type& value) {
+template <typename Key, typename Value, typename Compare>
+std::pair<typename BaseTree<Key, Value, Compare>::Node*, bool> 
+  BaseTree<Key, Value, Compare>::insert(const key_type& key, const value_type& value) {
       
-  if (root_ == nullptr) { // дерево пустое
-    root_ = new Node(key, value, 1);
-    ++size_;
-    return std::make_pair(root_, true);
-  }
+  // ищем узел с таким же ключом или место вставки
+  std::pair<Node*, Node*> found = descend(key);
 
-  Node* current = root_;
-  Node* parent = nullptr;
-  while (current != nullptr) { // ищем место вставки
-    parent = current;
-    if (key == current->key) { // code to implement multiple insertions
-      current->count += 1;
-      ++size_;
-      return std::make_pair(current, true);
-    } else 
-    if (key < current->key) {
-      current = current->left;
-    } else {
-      current = current->right;
-    }
+  if (found.first != nullptr) { // code to implement multiple insertions
+    found.first->count += 1;
+    ++size_;
+    return std::make_pair(found.first, true);
   }
 
   // if we are here this is the first node with the specified value
-  Node* new_node = new Node(key, value, 1);
+  return std::make_pair(attach(new Node(key, value, 1), found.second), true);
+}
 
-  if (key < parent->key) { // создаем необходимые связи в дереве с новым узлом
-    parent->left = new_node;
-  } else {
-    parent->right = new_node;
-  }
+template <typename Key, typename Value, typename Compare>
+std::pair<typename BaseTree<Key, Value, Compare>::Node*, bool> 
+  BaseTree<Key, Value, Compare>::insertUnique(const key_type& key, const value_type& value) {
 
-  ++size_;
+  std::pair<Node*, Node*> found = descend(key);
 
-  return std::make_pair(new_node, true);
+  if (found.first != nullptr) {
+    return std::make_pair(found.first, false);
+  }
+
+  return std::make_pair(attach(new Node(key, value, 1), found.second), true);
 }
 
-// template <typename Key, typename Value>
-// bool BaseTree<Key, Value>::erase(Iterator pos) {
+// template <typename Key, typename Value, typename Compare>
+// bool BaseTree<Key, Value, Compare>::erase(Iterator pos) {
 //   if (pos == end()) {
 //     return false;
 //   }
@@ -666,27 +758,17 @@ std::pair<typename BaseTree<Key, Value>::Node*, bool>
 //   }
 // }
 
-template <typename Key, typename Value>
-bool BaseTree<Key, Value>::remove(const_key_reference key) {
-  Node *current = root_;
-  Node *parent = nullptr;
-
+template <typename Key, typename Value, typename Compare>
+bool BaseTree<Key, Value, Compare>::remove(const_key_reference key) {
   // Поиск удаляемого узла
-  while (current != nullptr && current->key != key) {
-      parent = current;
+  std::pair<Node*, Node*> found = descend(key);
 
-      if (key < current->key) {
-          current = current->left;
-      } else {
-          current = current->right;
-      }
-  }
-
-  return removeNode(current, parent);
+  return removeNode(found.first, found.second);
 }
 
-template <typename Key, typename Value>
-typename BaseTree<Key, Value>::Node* BaseTree<Key, Value>::find(const_key_reference key) const {
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename BaseTree<Key, Value, Compare>::Node* BaseTree<Key, Value, Compare>::find(const K& key) const {
   Node* node = findNode(key);
 
   if (node == nullptr) {
@@ -696,26 +778,21 @@ typename BaseTree<Key, Value>::Node* BaseTree<Key, Value>::find(const_key_refere
   return node;
 }
 
-template <typename Key, typename Value>
-bool BaseTree<Key, Value>::contains(const_key_reference key) {
-  return findNode(key) != nullptr;
-}
-
-template <typename Key, typename Value>
-void BaseTree<Key, Value>::swap(BaseTree& other) {
+template <typename Key, typename Value, typename Compare>
+void BaseTree<Key, Value, Compare>::swap(BaseTree& other) {
   if (this == &other) {
     return;
   }
 
-  BaseTree<Key, Value> temp{ std::move(*this) };
+  BaseTree<Key, Value, Compare> temp{ std::move(*this) };
 
   *this = std::move(other);
 
   other = std::move(temp);
 }
 
-template <typename Key, typename Value>
-void BaseTree<Key, Value>::merge(BaseTree& other) {
+template <typename Key, typename Value, typename Compare>
+void BaseTree<Key, Value, Compare>::merge(BaseTree& other) {
   Iterator it = other.begin();
 
   while (it != other.end()) {
@@ -729,11 +806,12 @@ void BaseTree<Key, Value>::merge(BaseTree& other) {
 /*                    Private Helper Methods Implementation                  */
 /* ========================================================================= */
 
-template <typename Key, typename Value>
-void BaseTree<Key, Value>::stealResources(BaseTree<Key, Value> &&other) {
+template <typename Key, typename Value, typename Compare>
+void BaseTree<Key, Value, Compare>::stealResources(BaseTree<Key, Value, Compare> &&other) {
   // steal resources from the other tree
 
   root_ = other.root_;
+  comp_ = std::move(other.comp_);
 
   this->size_ = other.size();
 
@@ -742,12 +820,18 @@ void BaseTree<Key, Value>::stealResources(BaseTree<Key, Value> &&other) {
   other.size_ = 0;
 }
 
-template <typename Key, typename Value>
-bool BaseTree<Key, Value>::removeNode(Node *current, Node *parent) {
+template <typename Key, typename Value, typename Compare>
+bool BaseTree<Key, Value, Compare>::removeNode(Node *current, Node *parent) {
   if (current == nullptr) { // элемента с заданным ключом не существует
       return false;
   }
 
+  if (current->count > 1) { // остаются дубликаты, узел остается в дереве
+      --(current->count);
+      --size_;
+      return true;
+  }
+
   // У удаляемого узла нет детей (это лист дерева)
   if (current->left == nullptr && current->right == nullptr) {
       if (current == root_) {
@@ -798,8 +882,10 @@ bool BaseTree<Key, Value>::removeNode(Node *current, Node *parent) {
       }
 
       // Копируем приемника в удаляемый узел
-      current->key = successor->key;
-      current->value = successor->value;
+      current->key = std::move(successor->key);
+      current->value = std::move(successor->value);
+      current->count = successor->count;
+      successor->count = 1; // дубликаты приемника теперь в удаляемом узле
 
       // Удаляем приемника
       if (successor == successor_parent->left) {
@@ -818,29 +904,109 @@ bool BaseTree<Key, Value>::removeNode(Node *current, Node *parent) {
   return true;
 }
 
-template <typename Key, typename Value>
-typename BaseTree<Key, Value>::Node* BaseTree<Key, Value>::findNode(const_key_reference key) const {
-    if (root_ == nullptr) {
-      return nullptr;
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename BaseTree<Key, Value, Compare>::Node* BaseTree<Key, Value, Compare>::findNode(const K& key) const {
+    return descend(key).first;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename BaseTree<Key, Value, Compare>::Node* BaseTree<Key, Value, Compare>::lowerNode(const K& key) const {
+    Node* current = root_;
+    Node* bound = nullptr;
+
+    while (current != nullptr) { // последний узел, где мы ушли влево, и есть ответ
+        if (less(current->key, key)) {
+            current = current->right;
+        } else {
+            bound = current;
+            current = current->left;
+        }
     }
 
+    return bound;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename BaseTree<Key, Value, Compare>::Node* BaseTree<Key, Value, Compare>::upperNode(const K& key) const {
     Node* current = root_;
+    Node* bound = nullptr;
 
-    while (current != nullptr) { // Поиск узла с заданным ключом
-        if (current->key == key) {
-            return current;
-        } else if (key < current->key) {
+    while (current != nullptr) {
+        if (less(key, current->key)) {
+            bound = current;
             current = current->left;
-        } else if (key > current->key) {
+        } else {
             current = current->right;
         }
     }
 
-    return nullptr;
+    return bound;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+std::pair<typename BaseTree<Key, Value, Compare>::Node*, typename BaseTree<Key, Value, Compare>::Node*>
+  BaseTree<Key, Value, Compare>::descend(const K& key) const {
+    Node* current = root_;
+    Node* parent = nullptr;
+
+    if constexpr (kThreeWay) {
+        while (current != nullptr) {
+            const auto order = comp_(key, current->key);
+
+            if (order == 0) {
+                return std::make_pair(current, parent);
+            }
+
+            parent = current;
+            current = order < 0 ? current->left : current->right;
+        }
+
+        return std::make_pair(nullptr, parent);
+    } else {
+        Node* candidate = nullptr; // узел с наибольшим ключом, не большим key
+        Node* candidate_parent = nullptr;
+
+        while (current != nullptr) {
+            if (comp_(key, current->key)) {
+                parent = current;
+                current = current->left;
+            } else {
+                candidate = current;
+                candidate_parent = parent;
+                parent = current;
+                current = current->right;
+            }
+        }
+
+        if (candidate != nullptr && !comp_(candidate->key, key)) {
+            return std::make_pair(candidate, candidate_parent);
+        }
+
+        return std::make_pair(nullptr, parent);
+    }
+}
+
+template <typename Key, typename Value, typename Compare>
+typename BaseTree<Key, Value, Compare>::Node* BaseTree<Key, Value, Compare>::attach(Node* node, Node* parent) {
+  if (parent == nullptr) { // дерево пустое
+    root_ = node;
+  } else if (less(node->key, parent->key)) { // создаем необходимые связи в дереве с новым узлом
+    parent->left = node;
+  } else {
+    parent->right = node;
+  }
+
+  ++size_;
+
+  return node;
 }
 
-template <typename Key, typename Value>
-void BaseTree<Key, Value>::show(Node* current, int level) const {
+template <typename Key, typename Value, typename Compare>
+void BaseTree<Key, Value, Compare>::show(Node* current, int level) const {
   if (current == nullptr) {
       return;
   }
@@ -861,8 +1027,8 @@ void BaseTree<Key, Value>::show(Node* current, int level) const {
 /*                    Public Helper Methods Implementation                   */
 /* ========================================================================= */
 
-template <typename Key, typename Value>
-void BaseTree<Key, Value>::print() const {
+template <typename Key, typename Value, typename Compare>
+void BaseTree<Key, Value, Compare>::print() const {
   if (root_ == nullptr) {
     std::cout << "Tree is empty" << std::endl;
   }
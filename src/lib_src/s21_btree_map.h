@@ -0,0 +1,980 @@
+#ifndef S21_BTREE_MAP_H_
+#define S21_BTREE_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_container.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a map collection on an in-memory B+ tree
+//
+// Every node takes about NodeBytes and holds as many keys as fit there, so a
+// lookup visits a few cache line sized nodes instead of one node per key
+// comparison. Elements live in leaves only, leaves are linked both ways and
+// iteration (a range scan) walks them without going back to the inner nodes.
+// Interface follows Map: dereferenced iterator gives the mapped value, key()
+// gives the key. Key and T must be default constructible (node arrays), any
+// insert or erase invalidates iterators
+
+template <typename Key, typename T, size_t NodeBytes = 256>
+class BTreeMap : public Container {
+public:
+  // forward declarations for iterators
+  class Iterator;
+  class ConstIterator;
+
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using key_type = Key;
+  using mapped_type = T;
+
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  static constexpr size_type kCacheLine = 64;
+  static constexpr size_type kMaxDepth = 64; // at least 4 children per node
+
+  /**
+   * @brief Elements per node: what fits in NodeBytes after the header, but at
+   * least 4 so that halves of a split node are never empty
+  */
+  static constexpr size_type slotsFor(size_type header, size_type slot_size) {
+    return NodeBytes > header + 4 * slot_size ? (NodeBytes - header) / slot_size : 4;
+  }
+
+  struct Node {
+    bool leaf;
+    size_type count = 0; // elements in a leaf, keys in an inner node
+
+    explicit Node(bool is_leaf) : leaf{ is_leaf } {}
+  };
+
+  static constexpr size_type kLeafSlots =
+      slotsFor(sizeof(Node) + 2 * sizeof(Node*), sizeof(Key) + sizeof(T));
+  static constexpr size_type kInnerSlots = slotsFor(sizeof(Node) + sizeof(Node*), sizeof(Key) + sizeof(Node*));
+
+  struct alignas(kCacheLine) Leaf : Node {
+    Key keys[kLeafSlots];
+    T values[kLeafSlots];
+    Leaf *prev = nullptr;
+    Leaf *next = nullptr;
+
+    Leaf() : Node(true) {}
+  };
+
+  // keys[i] separates children[i] (keys less than it) and children[i + 1]
+  struct alignas(kCacheLine) Inner : Node {
+    Key keys[kInnerSlots];
+    Node *children[kInnerSlots + 1];
+
+    Inner() : Node(false) {}
+  };
+
+  // inner nodes from the root down to a leaf and the child taken in each
+  struct Path {
+    Inner *nodes[kMaxDepth];
+    size_type children[kMaxDepth];
+    size_type depth = 0;
+  };
+
+  Node *root_ = nullptr;
+  Leaf *first_ = nullptr;
+  Leaf *last_ = nullptr;
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor, creates an empty map
+  */
+  BTreeMap() {}
+
+  /**
+   * @brief Initializer list constructor, creates the map initizialized using std::initializer_list
+  */
+  BTreeMap(std::initializer_list<value_type> const &items) {
+    for (const_reference item : items) {
+      insert(item);
+    }
+  }
+
+  /**
+   * @brief Copy constructor
+   *
+   * @note Performs deep copy of passed parameter other, leaves are linked anew
+  */
+  BTreeMap(const BTreeMap &other) {
+    if (other.root_ != nullptr) {
+      root_ = copyNode(other.root_);
+      size_ = other.size_;
+    }
+  }
+
+  /**
+   * @brief Move constructor
+  */
+  BTreeMap(BTreeMap &&other) { moveFrom(other); }
+
+  /**
+   * @brief Destructor
+  */
+  ~BTreeMap() { clear(); }
+
+  /**
+   * @brief Assignment operator overload for moving an object
+  */
+  BTreeMap& operator=(BTreeMap &&other) {
+    if (this != &other) {
+      clear();
+      moveFrom(other);
+    }
+
+    return *this;
+  }
+
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Access a specified element with bounds checking
+   *
+   * @throws ArrayException if key is not in the map
+  */
+  T& at(const Key &key);
+
+  const T& at(const Key &key) const { return *find(key); }
+
+  /**
+   * @brief Access or insert specified element
+   *
+   * @note Inserts a value initialized element if the key is not in the map
+  */
+  T& operator[](const Key &key) {
+    auto result = emplace(key, T());
+
+    return result.first.leaf_->values[result.first.index_];
+  }
+
+  /**
+   * @brief Inserts a key-value pair and returns an iterator to where the element
+   * is in the container and bool denoting whether the insertion took place
+  */
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return emplace(value.first, value.second);
+  }
+
+  /**
+   * @brief Inserts a value by key and returns an iterator to where the element
+   * is in the container and bool denoting whether the insertion took place
+  */
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return emplace(key, obj);
+  }
+
+  /**
+   * @brief Inserts an element or assigns to the current element if the key already exists
+   *
+   * @return iterator to the element and true if it was inserted, false if assigned
+  */
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    auto result = emplace(key, obj);
+
+    if (!result.second) {
+      *result.first = obj;
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Erases an element at pos in the map
+  */
+  bool erase(iterator pos) {
+    if (pos.leaf_ == nullptr) {
+      return false;
+    }
+
+    return remove(pos.key());
+  }
+
+  /**
+   * @brief Removes an element with the key, underfull nodes borrow from or
+   * are merged with a sibling
+  */
+  bool remove(const Key &key);
+
+  /**
+   * @brief Checks if the map contains an element with a specific key
+  */
+  bool contains(const Key &key) const {
+    const const_iterator it = lower_bound(key);
+
+    return it.leaf_ != nullptr && !(key < it.key());
+  }
+
+  /**
+   * @brief Finds an element with a specific key in the map
+   *
+   * @throws ArrayException if element with specified key is not in the map
+  */
+  iterator find(const Key &key) {
+    const const_iterator it = std::as_const(*this).find(key);
+
+    return Iterator(*this, it.leaf_, it.index_);
+  }
+
+  const_iterator find(const Key &key) const {
+    const const_iterator it = lower_bound(key);
+
+    if (it.leaf_ == nullptr || key < it.key()) {
+      throw ArrayException("Element with specified key was not found");
+    }
+
+    return it;
+  }
+
+  /**
+   * @brief Returns an iterator to the first element with a key not less than the given one
+  */
+  iterator lower_bound(const Key &key) {
+    const const_iterator it = std::as_const(*this).lower_bound(key);
+
+    return Iterator(*this, it.leaf_, it.index_);
+  }
+
+  const_iterator lower_bound(const Key &key) const;
+
+  /**
+   * @brief Returns an iterator to the first element with a key greater than the given one
+  */
+  iterator upper_bound(const Key &key) {
+    const const_iterator it = std::as_const(*this).upper_bound(key);
+
+    return Iterator(*this, it.leaf_, it.index_);
+  }
+
+  const_iterator upper_bound(const Key &key) const;
+
+  /**
+   * @brief Removes all elements and frees the nodes
+  */
+  void clear() {
+    destroyNode(root_);
+    root_ = nullptr;
+    first_ = nullptr;
+    last_ = nullptr;
+    size_ = 0;
+  }
+
+  /**
+   * @brief Swaps the contents of two maps
+  */
+  void swap(BTreeMap &other) {
+    std::swap(root_, other.root_);
+    std::swap(first_, other.first_);
+    std::swap(last_, other.last_);
+    std::swap(size_, other.size_);
+  }
+
+  /**
+   * @brief Inserts elements of other with keys that are not in the map yet
+  */
+  void merge(const BTreeMap &other) {
+    for (auto it = other.cbegin(); it != other.cend(); ++it) {
+      insert(it.key(), *it);
+    }
+  }
+
+  /**
+   * @brief Number of elements that fit in a leaf
+  */
+  static constexpr size_type leaf_capacity() { return kLeafSlots; }
+
+  /**
+   * @brief Number of keys that fit in an inner node
+  */
+  static constexpr size_type inner_capacity() { return kInnerSlots; }
+
+
+/* ========================================================================= */
+/*                                Iterators                                  */
+/* ========================================================================= */
+
+  class ConstIterator {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = const T*;
+    using reference = const T&;
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the first element
+    */
+    ConstIterator(const BTreeMap &map) : map_{ &map }, leaf_{ map.first_ }, index_{ 0 } {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to an element of a leaf
+    */
+    ConstIterator(const BTreeMap &map, Leaf *leaf, size_type index) : map_{ &map }, leaf_{ leaf }, index_{ index } {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the mapped value
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    const mapped_type& operator*() const {
+      check();
+
+      return leaf_->values[index_];
+    }
+
+    /**
+     * @brief Returns the key of the element pointed by the iterator
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    const key_type& key() const {
+      check();
+
+      return leaf_->keys[index_];
+    }
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    ConstIterator& operator++() {
+      if (leaf_ == nullptr) {
+        throw ArrayException("Cannot increment an unset iterator");
+      }
+
+      if (++index_ == leaf_->count) {
+        leaf_ = leaf_->next;
+        index_ = 0;
+      }
+
+      return *this;
+    }
+
+    /**
+     * @brief Decrement operator. Moves the iterator to the previous element (prefix version)
+     *
+     * @note Decrementing the end iterator moves it to the last element
+     *
+     * @throws ArrayException if iterator is at the beginning
+    */
+    ConstIterator& operator--() {
+      Leaf *leaf = leaf_;
+      size_type index = index_;
+
+      if (leaf == nullptr || index == 0) {
+        leaf = leaf == nullptr ? map_->last_ : leaf->prev;
+        index = leaf == nullptr ? 0 : leaf->count;
+      }
+
+      if (leaf == nullptr) {
+        throw ArrayException("Cannot decrement an iterator at the beginning");
+      }
+
+      leaf_ = leaf;
+      index_ = index - 1;
+
+      return *this;
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on equality. Returns true
+     * if both iterators point to the same element, false otherwise
+    */
+    bool operator==(const ConstIterator &other) const {
+      return map_ == other.map_ && leaf_ == other.leaf_ && index_ == other.index_;
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on unequality. Returns true
+     * if iterators point to different elements, false otherwise
+    */
+    bool operator!=(const ConstIterator &other) const { return !(*this == other); }
+
+  protected:
+    friend class BTreeMap;
+
+    void check() const {
+      if (leaf_ == nullptr) {
+        throw ArrayException("Cannot dereference an unset iterator");
+      }
+    }
+
+    const BTreeMap *map_;
+    Leaf *leaf_;
+    size_type index_;
+  };
+
+  class Iterator : public ConstIterator {
+  public:
+    using pointer = T*;
+    using reference = T&;
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the first element
+    */
+    Iterator(BTreeMap &map) : ConstIterator(map) {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to an element of a leaf
+    */
+    Iterator(BTreeMap &map, Leaf *leaf, size_type index) : ConstIterator(map, leaf, index) {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the mapped value
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    mapped_type& operator*() const {
+      this->check();
+
+      return this->leaf_->values[this->index_];
+    }
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    Iterator& operator++() {
+      ConstIterator::operator++();
+
+      return *this;
+    }
+
+    /**
+     * @brief Decrement operator. Moves the iterator to the previous element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the beginning
+    */
+    Iterator& operator--() {
+      ConstIterator::operator--();
+
+      return *this;
+    }
+  };
+
+  iterator begin() {
+    return Iterator(*this);
+  }
+
+  iterator end() {
+    return Iterator(*this, nullptr, 0);
+  }
+
+  const_iterator cbegin() const {
+    return ConstIterator(*this);
+  }
+
+  const_iterator cend() const {
+    return ConstIterator(*this, nullptr, 0);
+  }
+
+
+  /* ========================================================================= */
+  /*                        Bonus Methods (insert_many)                        */
+  /* ========================================================================= */
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> result;
+    std::vector<key_type> keys;
+
+    for (auto arg : {args...}) {
+      result.push_back(insert(arg.first, arg.second));
+      keys.push_back(arg.first);
+    }
+
+    // an insert may have split the leaf of an earlier element
+    for (size_type i = 0; i < keys.size(); ++i) {
+      result[i].first = lower_bound(keys[i]);
+    }
+
+    return result;
+  }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  std::pair<iterator, bool> emplace(const Key &key, const T &obj);
+
+  /**
+   * @brief Number of keys in [keys, keys + count) less than key (with or_equal,
+   * not greater than key)
+   *
+   * @note Numbers are counted with no branches over the whole node: the loop is
+   * vectorized and nothing is mispredicted. Other keys may be costly to
+   * compare, they are binary searched
+  */
+  template <bool or_equal>
+  static size_type countLess(const Key *keys, size_type count, const Key &key) {
+    if constexpr (std::is_arithmetic<Key>::value) {
+      size_type less = 0;
+
+      for (size_type i = 0; i < count; ++i) {
+        less += or_equal ? !(key < keys[i]) : keys[i] < key;
+      }
+
+      return less;
+    } else if constexpr (or_equal) {
+      return std::upper_bound(keys, keys + count, key) - keys;
+    } else {
+      return std::lower_bound(keys, keys + count, key) - keys;
+    }
+  }
+
+  /**
+   * @brief Walks from the root to the leaf that may hold key, records the path
+  */
+  Leaf* descend(const Key &key, Path *path) const;
+
+  /**
+   * @brief Adds a separator and the new right child after a split, splitting
+   * the parents that are full in turn
+  */
+  void insertChild(Path &path, Key separator, Node *right);
+
+  /**
+   * @brief Fixes an underfull leaf or inner node, climbing while merges make
+   * the parent underfull too
+  */
+  void rebalance(Path &path, Node *node);
+
+  void rebalanceLeaf(Inner *parent, size_type child, Leaf *leaf);
+
+  void rebalanceInner(Inner *parent, size_type child, Inner *inner);
+
+  /**
+   * @brief Drops key keys[index - 1] and child children[index] of an inner node
+  */
+  static void removeChild(Inner *inner, size_type index);
+
+  void unlink(Leaf *leaf);
+
+  Node* copyNode(const Node *node);
+
+  static void destroyNode(Node *node);
+
+  void moveFrom(BTreeMap &other);
+};
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename Key, typename T, size_t NodeBytes>
+T& BTreeMap<Key, T, NodeBytes>::at(const Key &key) {
+  const iterator it = find(key);
+
+  return it.leaf_->values[it.index_];
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+auto BTreeMap<Key, T, NodeBytes>::lower_bound(const Key &key) const -> const_iterator {
+  Leaf *leaf = descend(key, nullptr);
+
+  if (leaf == nullptr) {
+    return ConstIterator(*this, nullptr, 0);
+  }
+
+  const size_type index = countLess<false>(leaf->keys, leaf->count, key);
+
+  // separators send the key to the leaf where it would be, past its end the
+  // next bigger key is the first one of the next leaf
+  return index < leaf->count ? ConstIterator(*this, leaf, index) : ConstIterator(*this, leaf->next, 0);
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+auto BTreeMap<Key, T, NodeBytes>::upper_bound(const Key &key) const -> const_iterator {
+  Leaf *leaf = descend(key, nullptr);
+
+  if (leaf == nullptr) {
+    return ConstIterator(*this, nullptr, 0);
+  }
+
+  const size_type index = countLess<true>(leaf->keys, leaf->count, key);
+
+  return index < leaf->count ? ConstIterator(*this, leaf, index) : ConstIterator(*this, leaf->next, 0);
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+bool BTreeMap<Key, T, NodeBytes>::remove(const Key &key) {
+  Path path;
+  Leaf *leaf = descend(key, &path);
+
+  if (leaf == nullptr) {
+    return false;
+  }
+
+  const size_type index = countLess<false>(leaf->keys, leaf->count, key);
+
+  if (index == leaf->count || key < leaf->keys[index]) {
+    return false;
+  }
+
+  std::move(leaf->keys + index + 1, leaf->keys + leaf->count, leaf->keys + index);
+  std::move(leaf->values + index + 1, leaf->values + leaf->count, leaf->values + index);
+  --leaf->count;
+  --size_;
+
+  // separators of the parents may keep the removed key: it still splits the
+  // children correctly
+  rebalance(path, leaf);
+
+  return true;
+}
+
+
+/* ========================================================================= */
+/*                 Private Helper Methods Implementation                     */
+/* ========================================================================= */
+
+template <typename Key, typename T, size_t NodeBytes>
+auto BTreeMap<Key, T, NodeBytes>::emplace(const Key &key, const T &obj) -> std::pair<iterator, bool> {
+  if (root_ == nullptr) {
+    first_ = last_ = new Leaf();
+    root_ = first_;
+  }
+
+  Path path;
+  Leaf *leaf = descend(key, &path);
+  size_type index = countLess<false>(leaf->keys, leaf->count, key);
+
+  if (index < leaf->count && !(key < leaf->keys[index])) {
+    return std::make_pair(Iterator(*this, leaf, index), false);
+  }
+
+  if (leaf->count == kLeafSlots) {
+    // upper half goes to a new leaf on the right, the key goes to the left
+    // half if it is not bigger than everything there
+    const size_type half = kLeafSlots / 2;
+    Leaf *right = new Leaf();
+
+    std::move(leaf->keys + half, leaf->keys + kLeafSlots, right->keys);
+    std::move(leaf->values + half, leaf->values + kLeafSlots, right->values);
+    right->count = kLeafSlots - half;
+    leaf->count = half;
+
+    right->prev = leaf;
+    right->next = leaf->next;
+    (leaf->next != nullptr ? leaf->next->prev : last_) = right;
+    leaf->next = right;
+
+    insertChild(path, right->keys[0], right);
+
+    if (index > half) {
+      leaf = right;
+      index -= half;
+    }
+  }
+
+  std::move_backward(leaf->keys + index, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+  std::move_backward(leaf->values + index, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+  leaf->keys[index] = key;
+  leaf->values[index] = obj;
+  ++leaf->count;
+  ++size_;
+
+  return std::make_pair(Iterator(*this, leaf, index), true);
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+auto BTreeMap<Key, T, NodeBytes>::descend(const Key &key, Path *path) const -> Leaf* {
+  Node *node = root_;
+
+  while (node != nullptr && !node->leaf) {
+    Inner *inner = static_cast<Inner*>(node);
+    const size_type child = countLess<true>(inner->keys, inner->count, key);
+
+    if (path != nullptr) {
+      path->nodes[path->depth] = inner;
+      path->children[path->depth] = child;
+      ++path->depth;
+    }
+
+    node = inner->children[child];
+  }
+
+  return static_cast<Leaf*>(node);
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::insertChild(Path &path, Key separator, Node *right) {
+  while (path.depth > 0) {
+    --path.depth;
+    Inner *inner = path.nodes[path.depth];
+    const size_type child = path.children[path.depth];
+
+    if (inner->count < kInnerSlots) {
+      std::move_backward(inner->keys + child, inner->keys + inner->count, inner->keys + inner->count + 1);
+      std::move_backward(inner->children + child + 1, inner->children + inner->count + 1,
+                         inner->children + inner->count + 2);
+      inner->keys[child] = std::move(separator);
+      inner->children[child + 1] = right;
+      ++inner->count;
+
+      return;
+    }
+
+    // full: lay out all keys and children with the new ones in place, the
+    // middle key goes up and the upper half goes to a new node
+    Key keys[kInnerSlots + 1];
+    Node *children[kInnerSlots + 2];
+
+    std::move(inner->keys, inner->keys + child, keys);
+    keys[child] = std::move(separator);
+    std::move(inner->keys + child, inner->keys + kInnerSlots, keys + child + 1);
+
+    std::copy(inner->children, inner->children + child + 1, children);
+    children[child + 1] = right;
+    std::copy(inner->children + child + 1, inner->children + kInnerSlots + 1, children + child + 2);
+
+    const size_type half = (kInnerSlots + 1) / 2;
+    Inner *sibling = new Inner();
+
+    std::move(keys, keys + half, inner->keys);
+    std::copy(children, children + half + 1, inner->children);
+    inner->count = half;
+
+    std::move(keys + half + 1, keys + kInnerSlots + 1, sibling->keys);
+    std::copy(children + half + 1, children + kInnerSlots + 2, sibling->children);
+    sibling->count = kInnerSlots - half;
+
+    separator = std::move(keys[half]);
+    right = sibling;
+  }
+
+  // the root was split
+  Inner *root = new Inner();
+
+  root->keys[0] = std::move(separator);
+  root->children[0] = root_;
+  root->children[1] = right;
+  root->count = 1;
+  root_ = root;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::rebalance(Path &path, Node *node) {
+  while (path.depth > 0) {
+    const size_type minimum = node->leaf ? kLeafSlots / 2 : kInnerSlots / 2;
+
+    if (node->count >= minimum) {
+      return;
+    }
+
+    --path.depth;
+    Inner *parent = path.nodes[path.depth];
+    const size_type child = path.children[path.depth];
+
+    if (node->leaf) {
+      rebalanceLeaf(parent, child, static_cast<Leaf*>(node));
+    } else {
+      rebalanceInner(parent, child, static_cast<Inner*>(node));
+    }
+
+    node = parent;
+  }
+
+  // the root may be left with a single child or with nothing at all
+  if (!root_->leaf && root_->count == 0) {
+    Inner *old = static_cast<Inner*>(root_);
+    root_ = old->children[0];
+    delete old;
+  } else if (root_->leaf && root_->count == 0) {
+    delete static_cast<Leaf*>(root_);
+    root_ = nullptr;
+    first_ = last_ = nullptr;
+  }
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::rebalanceLeaf(Inner *parent, size_type child, Leaf *leaf) {
+  Leaf *left = child > 0 ? static_cast<Leaf*>(parent->children[child - 1]) : nullptr;
+  Leaf *right = child < parent->count ? static_cast<Leaf*>(parent->children[child + 1]) : nullptr;
+
+  if (left != nullptr && left->count > kLeafSlots / 2) {
+    // the biggest element of the left sibling moves in front
+    std::move_backward(leaf->keys, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+    std::move_backward(leaf->values, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+    --left->count;
+    leaf->keys[0] = std::move(left->keys[left->count]);
+    leaf->values[0] = std::move(left->values[left->count]);
+    ++leaf->count;
+    parent->keys[child - 1] = leaf->keys[0];
+  } else if (right != nullptr && right->count > kLeafSlots / 2) {
+    // the smallest element of the right sibling moves to the back
+    leaf->keys[leaf->count] = std::move(right->keys[0]);
+    leaf->values[leaf->count] = std::move(right->values[0]);
+    ++leaf->count;
+    std::move(right->keys + 1, right->keys + right->count, right->keys);
+    std::move(right->values + 1, right->values + right->count, right->values);
+    --right->count;
+    parent->keys[child] = right->keys[0];
+  } else {
+    // both siblings are at the minimum: merge the right one of the pair into the left one
+    if (left == nullptr) {
+      left = leaf;
+      leaf = right;
+      ++child;
+    }
+
+    std::move(leaf->keys, leaf->keys + leaf->count, left->keys + left->count);
+    std::move(leaf->values, leaf->values + leaf->count, left->values + left->count);
+    left->count += leaf->count;
+
+    unlink(leaf);
+    delete leaf;
+    removeChild(parent, child);
+  }
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::rebalanceInner(Inner *parent, size_type child, Inner *inner) {
+  Inner *left = child > 0 ? static_cast<Inner*>(parent->children[child - 1]) : nullptr;
+  Inner *right = child < parent->count ? static_cast<Inner*>(parent->children[child + 1]) : nullptr;
+
+  if (left != nullptr && left->count > kInnerSlots / 2) {
+    // rotate right: separator comes down, the last key of the left sibling goes up
+    std::move_backward(inner->keys, inner->keys + inner->count, inner->keys + inner->count + 1);
+    std::copy_backward(inner->children, inner->children + inner->count + 1, inner->children + inner->count + 2);
+    inner->keys[0] = std::move(parent->keys[child - 1]);
+    inner->children[0] = left->children[left->count];
+    ++inner->count;
+    --left->count;
+    parent->keys[child - 1] = std::move(left->keys[left->count]);
+  } else if (right != nullptr && right->count > kInnerSlots / 2) {
+    // rotate left: separator comes down, the first key of the right sibling goes up
+    inner->keys[inner->count] = std::move(parent->keys[child]);
+    inner->children[inner->count + 1] = right->children[0];
+    ++inner->count;
+    parent->keys[child] = std::move(right->keys[0]);
+    std::move(right->keys + 1, right->keys + right->count, right->keys);
+    std::copy(right->children + 1, right->children + right->count + 1, right->children);
+    --right->count;
+  } else {
+    // merge the right one of the pair into the left one, the separator comes down between them
+    if (left == nullptr) {
+      left = inner;
+      inner = right;
+      ++child;
+    }
+
+    left->keys[left->count] = std::move(parent->keys[child - 1]);
+    std::move(inner->keys, inner->keys + inner->count, left->keys + left->count + 1);
+    std::copy(inner->children, inner->children + inner->count + 1, left->children + left->count + 1);
+    left->count += inner->count + 1;
+
+    delete inner;
+    removeChild(parent, child);
+  }
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::removeChild(Inner *inner, size_type index) {
+  std::move(inner->keys + index, inner->keys + inner->count, inner->keys + index - 1);
+  std::copy(inner->children + index + 1, inner->children + inner->count + 1, inner->children + index);
+  --inner->count;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::unlink(Leaf *leaf) {
+  (leaf->prev != nullptr ? leaf->prev->next : first_) = leaf->next;
+  (leaf->next != nullptr ? leaf->next->prev : last_) = leaf->prev;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+auto BTreeMap<Key, T, NodeBytes>::copyNode(const Node *node) -> Node* {
+  if (node->leaf) {
+    // nodes are copied left to right, so leaves come in order
+    const Leaf *source = static_cast<const Leaf*>(node);
+    Leaf *leaf = new Leaf();
+
+    std::copy(source->keys, source->keys + source->count, leaf->keys);
+    std::copy(source->values, source->values + source->count, leaf->values);
+    leaf->count = source->count;
+
+    leaf->prev = last_;
+    (last_ != nullptr ? last_->next : first_) = leaf;
+    last_ = leaf;
+
+    return leaf;
+  }
+
+  const Inner *source = static_cast<const Inner*>(node);
+  Inner *inner = new Inner();
+
+  std::copy(source->keys, source->keys + source->count, inner->keys);
+  inner->count = source->count;
+
+  for (size_type i = 0; i <= source->count; ++i) {
+    inner->children[i] = copyNode(source->children[i]);
+  }
+
+  return inner;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::destroyNode(Node *node) {
+  if (node == nullptr) {
+    return;
+  }
+
+  if (node->leaf) {
+    delete static_cast<Leaf*>(node);
+    return;
+  }
+
+  Inner *inner = static_cast<Inner*>(node);
+
+  for (size_type i = 0; i <= inner->count; ++i) {
+    destroyNode(inner->children[i]);
+  }
+
+  delete inner;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::moveFrom(BTreeMap &other) {
+  root_ = other.root_;
+  first_ = other.first_;
+  last_ = other.last_;
+  size_ = other.size_;
+
+  other.root_ = nullptr;
+  other.first_ = nullptr;
+  other.last_ = nullptr;
+  other.size_ = 0;
+}
+
+} // namespace s21
+
+#endif // S21_BTREE_MAP_H_
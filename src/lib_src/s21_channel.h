@@ -0,0 +1,529 @@
+#ifndef S21_CHANNEL_H_
+#define S21_CHANNEL_H_
+
+// channel is built on C++20 coroutines, with older standards this header is
+// empty (see test20 and bench20 targets of the Makefile)
+#if __cplusplus >= 202002L && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <optional>
+#include <utility>
+
+#include "s21_intrusive_list.h"
+#include "s21_queue.h"
+#include "s21_vector.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+class Executor;
+
+/**
+ * @brief Return type of coroutines run by an Executor
+ *
+ * @note Coroutine does not start until it is given to Executor::spawn
+ *
+ * @note g++ 12 miscompiles lazily started coroutines that have co_await right
+ * in the condition of an if (the body is never entered), await into a local
+ * variable first: bool sent = co_await channel.send(v); if (!sent) ...
+*/
+class Task {
+public:
+  struct promise_type {
+    std::exception_ptr error_;
+
+    Task get_return_object() {
+      return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    // started by the executor, finished frames are destroyed by it too
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+
+    void return_void() {}
+
+    void unhandled_exception() { error_ = std::current_exception(); }
+  };
+
+  using Handle = std::coroutine_handle<promise_type>;
+
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+
+  Task(Task &&other) : handle_{ other.handle_ } { other.handle_ = nullptr; }
+
+  /**
+   * @brief Destroys the coroutine if it was never given to an executor
+  */
+  ~Task() {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+private:
+  friend class Executor;
+
+  explicit Task(Handle handle) : handle_{ handle } {}
+
+  Handle handle_;
+};
+
+// Implementation of a minimal single-threaded executor
+//
+// Ready coroutines wait in a Queue and are resumed one by one by run().
+// Coroutines never resume each other directly, they are scheduled here, so
+// the stack does not grow however long a chain of hand-offs is
+
+class Executor {
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using size_type = size_t;
+
+  Queue<std::coroutine_handle<>> ready_;
+  Vector<Task::Handle> tasks_; // all spawned coroutines that are not destroyed yet
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  Executor() {}
+
+  Executor(const Executor&) = delete;
+  Executor& operator=(const Executor&) = delete;
+
+  /**
+   * @brief Destructor. Destroys coroutines that have not finished (they are
+   * suspended forever on a channel nobody will use)
+  */
+  ~Executor() {
+    for (Task::Handle handle : tasks_) {
+      handle.destroy();
+    }
+  }
+
+/* ========================================================================= */
+/*                              Main Methods                                 */
+/* ========================================================================= */
+
+  /**
+   * @brief Takes a coroutine and schedules its first run
+  */
+  void spawn(Task task) {
+    Task::Handle handle = task.handle_;
+    task.handle_ = nullptr;
+
+    tasks_.push_back(handle);
+    ready_.push(handle);
+  }
+
+  /**
+   * @brief Schedules a suspended coroutine to be resumed by run
+  */
+  void schedule(std::coroutine_handle<> handle) { ready_.push(handle); }
+
+  /**
+   * @brief Resumes ready coroutines until none is left, returns how many
+   * times coroutines were resumed
+   *
+   * @note Finished coroutines are destroyed. The first exception that escaped
+   * a coroutine is rethrown after that
+  */
+  size_type run();
+
+  /**
+   * @brief Returns the number of spawned coroutines that have not finished
+  */
+  size_type pending() const { return tasks_.size(); }
+};
+
+inline Executor::size_type Executor::run() {
+  size_type resumed = 0;
+
+  while (!ready_.empty()) {
+    std::coroutine_handle<> handle = ready_.front();
+    ready_.pop();
+
+    handle.resume();
+    ++resumed;
+  }
+
+  std::exception_ptr error;
+  size_type kept = 0;
+
+  for (size_type i = 0; i < tasks_.size(); ++i) {
+    Task::Handle handle = tasks_[i];
+
+    if (handle.done()) {
+      if (!error) {
+        error = handle.promise().error_;
+      }
+      handle.destroy();
+    } else {
+      tasks_[kept++] = handle;
+    }
+  }
+
+  while (tasks_.size() > kept) {
+    tasks_.pop_back();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  return resumed;
+}
+
+// Implementation of a bounded channel for coroutines
+//
+// Values are kept in a ring buffer of capacity slots (capacity 0 makes every
+// send wait for a receiver). co_await send() suspends the coroutine while the
+// buffer is full, co_await recv() while it is empty. Waiting coroutines are
+// kept in IntrusiveLists of their awaiters (awaiters live in coroutine frames,
+// so waiting does not allocate) and are woken in FIFO order through the
+// executor.
+//
+// Channel is not thread-safe: all coroutines that use it should run on the
+// same executor
+
+template <typename T>
+class Channel { // does not inherit from Container, size is not the only state
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using size_type = size_t;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+
+public:
+  class SendAwaiter;
+  class RecvAwaiter;
+
+private:
+  Executor &executor_;
+
+  T *slots_;
+  size_type capacity_;
+  size_type head_{ 0 };
+  size_type count_{ 0 };
+  bool closed_{ false };
+
+public:
+
+  /**
+   * @brief Awaiter of send: co_await returns false if the channel was closed
+   * and the value was not sent
+  */
+  class SendAwaiter {
+    friend class Channel;
+
+    Channel &channel_;
+    value_type value_;
+    IntrusiveListHook hook_;
+    std::coroutine_handle<> handle_;
+    bool sent_{ false };
+
+  public:
+    SendAwaiter(Channel &channel, value_type value)
+        : channel_{ channel }, value_{ std::move(value) } {}
+
+    SendAwaiter(const SendAwaiter&) = delete;
+    SendAwaiter& operator=(const SendAwaiter&) = delete;
+
+    /**
+     * @brief Leaves the queue of waiting senders if the coroutine is destroyed
+     * while it waits
+    */
+    ~SendAwaiter() {
+      if (hook_.linked()) {
+        channel_.senders_.remove(*this);
+      }
+    }
+
+    bool await_ready() { return channel_.trySend(value_, sent_); }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+      handle_ = handle;
+      channel_.senders_.pushBack(*this);
+    }
+
+    bool await_resume() const { return sent_; }
+  };
+
+  /**
+   * @brief Awaiter of recv: co_await returns an empty optional if the channel
+   * was closed and all values are taken
+  */
+  class RecvAwaiter {
+    friend class Channel;
+
+    Channel &channel_;
+    std::optional<value_type> result_;
+    IntrusiveListHook hook_;
+    std::coroutine_handle<> handle_;
+
+  public:
+    explicit RecvAwaiter(Channel &channel) : channel_{ channel } {}
+
+    RecvAwaiter(const RecvAwaiter&) = delete;
+    RecvAwaiter& operator=(const RecvAwaiter&) = delete;
+
+    /**
+     * @brief Leaves the queue of waiting receivers if the coroutine is destroyed
+     * while it waits
+    */
+    ~RecvAwaiter() {
+      if (hook_.linked()) {
+        channel_.receivers_.remove(*this);
+      }
+    }
+
+    bool await_ready() { return channel_.tryRecv(result_); }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+      handle_ = handle;
+      channel_.receivers_.pushBack(*this);
+    }
+
+    std::optional<value_type> await_resume() { return std::move(result_); }
+  };
+
+private:
+  IntrusiveList<SendAwaiter, &SendAwaiter::hook_> senders_;
+  IntrusiveList<RecvAwaiter, &RecvAwaiter::hook_> receivers_;
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Creates an empty channel that wakes coroutines through executor
+  */
+  Channel(Executor &executor, size_type capacity);
+
+  Channel(const Channel&) = delete;
+  Channel& operator=(const Channel&) = delete;
+
+  /**
+   * @brief Destructor. Destroys values left in the buffer
+   *
+   * @note Coroutines still waiting on the channel are forgotten, they should
+   * be destroyed together with their executor
+  */
+  ~Channel();
+
+/* ========================================================================= */
+/*                              Main Methods                                 */
+/* ========================================================================= */
+
+  /**
+   * @brief Returns an awaiter that puts value into the channel, suspends
+   * while the buffer is full
+  */
+  SendAwaiter send(value_type value) { return SendAwaiter(*this, std::move(value)); }
+
+  /**
+   * @brief Returns an awaiter that takes the oldest value, suspends while the
+   * channel is empty
+  */
+  RecvAwaiter recv() { return RecvAwaiter(*this); }
+
+  /**
+   * @brief Sends a value without waiting
+   *
+   * @return false if the buffer is full (and no receiver waits) or the channel is closed
+  */
+  bool try_send(value_type value) {
+    bool sent = false;
+    trySend(value, sent);
+    return sent;
+  }
+
+  /**
+   * @brief Takes a value without waiting, returns an empty optional if there is none
+  */
+  std::optional<value_type> try_recv() {
+    std::optional<value_type> result;
+    tryRecv(result);
+    return result;
+  }
+
+  /**
+   * @brief Closes the channel: waiting and future senders fail, receivers
+   * get what is left in the buffer and then empty optionals
+  */
+  void close();
+
+  bool closed() const { return closed_; }
+
+  /**
+   * @brief Returns the number of buffered values
+  */
+  size_type size() const { return count_; }
+
+  bool empty() const { return count_ == 0; }
+
+  size_type capacity() const { return capacity_; }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Hands value to a waiting receiver or puts it into the buffer
+   *
+   * @return true if send is complete (sent or failed because of close)
+  */
+  bool trySend(reference value, bool &sent);
+
+  /**
+   * @brief Takes a value from the buffer or from a waiting sender
+   *
+   * @return true if receive is complete (got a value or channel is closed and empty)
+  */
+  bool tryRecv(std::optional<value_type> &result);
+
+  void pushSlot(value_type &&value) {
+    new (slots_ + (head_ + count_) % capacity_) value_type(std::move(value));
+    ++count_;
+  }
+
+  value_type popSlot() {
+    value_type value(std::move(slots_[head_]));
+    slots_[head_].~value_type();
+
+    head_ = (head_ + 1) % capacity_;
+    --count_;
+
+    return value;
+  }
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+template <typename T>
+Channel<T>::Channel(Executor &executor, size_type capacity)
+    : executor_{ executor }, capacity_{ capacity } {
+  slots_ = capacity == 0 ? nullptr
+                         : static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t(alignof(T))));
+}
+
+template <typename T>
+Channel<T>::~Channel() {
+  while (count_ > 0) {
+    popSlot();
+  }
+
+  ::operator delete(slots_, std::align_val_t(alignof(T)));
+
+  // awaiters check their hooks when they are destroyed
+  senders_.clear();
+  receivers_.clear();
+}
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename T>
+void Channel<T>::close() {
+  closed_ = true;
+
+  while (!receivers_.empty()) {
+    RecvAwaiter &receiver = receivers_.front();
+    receivers_.popFront();
+    executor_.schedule(receiver.handle_);
+  }
+
+  while (!senders_.empty()) {
+    SendAwaiter &sender = senders_.front();
+    senders_.popFront();
+    executor_.schedule(sender.handle_);
+  }
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+template <typename T>
+bool Channel<T>::trySend(reference value, bool &sent) {
+  if (closed_) {
+    return true;
+  }
+
+  // receivers wait only while the buffer is empty, so nobody is overtaken
+  if (!receivers_.empty()) {
+    RecvAwaiter &receiver = receivers_.front();
+    receivers_.popFront();
+
+    receiver.result_.emplace(std::move(value));
+    executor_.schedule(receiver.handle_);
+
+    sent = true;
+    return true;
+  }
+
+  if (count_ < capacity_) {
+    pushSlot(std::move(value));
+
+    sent = true;
+    return true;
+  }
+
+  return false;
+}
+
+template <typename T>
+bool Channel<T>::tryRecv(std::optional<value_type> &result) {
+  if (count_ > 0) {
+    result.emplace(popSlot());
+
+    // a slot is free now, the oldest waiting sender takes it
+    if (!senders_.empty()) {
+      SendAwaiter &sender = senders_.front();
+      senders_.popFront();
+
+      pushSlot(std::move(sender.value_));
+      sender.sent_ = true;
+      executor_.schedule(sender.handle_);
+    }
+
+    return true;
+  }
+
+  // buffer is empty but a sender waits: only possible with zero capacity
+  if (!senders_.empty()) {
+    SendAwaiter &sender = senders_.front();
+    senders_.popFront();
+
+    result.emplace(std::move(sender.value_));
+    sender.sent_ = true;
+    executor_.schedule(sender.handle_);
+
+    return true;
+  }
+
+  return closed_;
+}
+
+} // namespace s21
+
+#endif  // C++20
+
+#endif  // S21_CHANNEL_H_
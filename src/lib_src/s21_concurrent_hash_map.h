@@ -0,0 +1,328 @@
+#ifndef S21_CONCURRENT_HASH_MAP_H_
+#define S21_CONCURRENT_HASH_MAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+
+#include "s21_hash_map.h"
+#include "s21_thread_pool.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a hash map for many threads (lock striping over HashMap)
+//
+// Keys are spread over a power of two number of shards, every shard is a
+// HashMap with its own reader-writer lock. Lookups of a shard run in parallel,
+// a write only blocks its own shard, so threads working on different keys
+// rarely meet. A shard is picked by the top bits of a hash mixed differently
+// from the one HashMap uses inside, so keys of a shard still spread over its
+// table. Shards sit on separate cache lines, locks of neighbours do not share one.
+//
+// Values are returned by copy: a reference could outlive the lock
+
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class ConcurrentHashMap { // does not inherit from Container, size is shared between threads
+public:
+  // every shard is a usual map, for_each_shard gives them out
+  using Shard = HashMap<Key, T, Hash, KeyEqual>;
+
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using size_type = size_t;
+  using key_type = Key;
+  using mapped_type = T;
+
+  static constexpr size_type kCacheLine = 64;
+
+  // shard that looks a key up without throwing when it is not there
+  class Table : public Shard {
+  public:
+    const T* lookup(const Key &key) const {
+      const size_type index = this->findIndex(key);
+
+      return index == this->capacity_ ? nullptr : &this->slots_[index].second;
+    }
+  };
+
+  struct alignas(kCacheLine) Stripe {
+    mutable std::shared_mutex mutex_;
+    Table map_;
+  };
+
+  size_type shift_; // 64 - log2 of the number of shards
+  size_type count_;
+  Stripe *stripes_;
+  Hash hash_;
+
+public:
+
+  static constexpr size_type kDefaultShards = 64;
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Creates an empty map with at least shard_count shards
+   *
+   * @note The number of shards is rounded up to a power of two. It is fixed:
+   * more shards than writing threads keep them from waiting for each other
+   *
+   * @throws ArrayException if shard_count is zero
+  */
+  explicit ConcurrentHashMap(size_type shard_count = kDefaultShards);
+
+  ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+  ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+  /**
+   * @brief Destructor
+   *
+   * @note No other thread should use the map at this point
+  */
+  ~ConcurrentHashMap() { delete[] stripes_; }
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Inserts an element or assigns to the current element if the key already exists
+   *
+   * @return true if the element was inserted, false if assigned
+  */
+  bool insert_or_assign(const Key &key, const T &obj) {
+    Stripe &stripe = stripeOf(key);
+    std::unique_lock<std::shared_mutex> lock(stripe.mutex_);
+
+    return stripe.map_.insert_or_assign(key, obj).second;
+  }
+
+  /**
+   * @brief Inserts an element if the key is not in the map yet
+   *
+   * @return true if the element was inserted
+  */
+  bool insert(const Key &key, const T &obj) {
+    Stripe &stripe = stripeOf(key);
+    std::unique_lock<std::shared_mutex> lock(stripe.mutex_);
+
+    return stripe.map_.insert(key, obj).second;
+  }
+
+  /**
+   * @brief Copies the value of the key to out
+   *
+   * @return false if the key is not in the map (out is left as is)
+  */
+  bool find(const Key &key, T &out) const;
+
+  /**
+   * @brief Checks if the map contains an element with a specific key
+  */
+  bool contains(const Key &key) const {
+    const Stripe &stripe = stripeOf(key);
+    std::shared_lock<std::shared_mutex> lock(stripe.mutex_);
+
+    return stripe.map_.contains(key);
+  }
+
+  /**
+   * @brief Removes the element with the key
+   *
+   * @return true if this call removed the element, false if it was not in the map
+  */
+  bool erase(const Key &key) {
+    Stripe &stripe = stripeOf(key);
+    std::unique_lock<std::shared_mutex> lock(stripe.mutex_);
+
+    return stripe.map_.remove(key);
+  }
+
+  /**
+   * @brief Returns the value of the key, inserting make(key) first if the key
+   * is not in the map
+   *
+   * @note make is called at most once per inserted key, under the lock of its
+   * shard: other threads asking for the same key wait for it and get its result.
+   * A key that is already there costs only a shared lock
+  */
+  template <typename Make>
+  T compute_if_absent(const Key &key, Make make);
+
+  /**
+   * @brief Calls visit(shard) for every shard, one after another. Every shard
+   * is read under its shared lock, writers of other shards are not stopped
+   *
+   * @note visit gets a const Shard& and must not call methods of this map
+  */
+  template <typename Visit>
+  void for_each_shard(Visit visit) const;
+
+  /**
+   * @brief Calls visit(shard) for every shard, shards are visited in parallel
+   * by the pool threads (see the note above)
+  */
+  template <typename Visit>
+  void for_each_shard(ThreadPool &pool, Visit visit) const;
+
+  /**
+   * @brief Removes all elements
+  */
+  void clear();
+
+  /**
+   * @brief Returns the number of elements
+   *
+   * @note Shards are counted one by one, under concurrent modifications the
+   * value may already be outdated
+  */
+  size_type size() const;
+
+  /**
+   * @brief Returns true if the map is empty (see the note for size)
+  */
+  bool empty() const { return size() == 0; }
+
+  /**
+   * @brief Returns the number of shards
+  */
+  size_type shard_count() const { return count_; }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Shard of a key: top bits of the hash mixed with a constant other
+   * than the one of HashTable, whose low bits pick the slot
+  */
+  size_type shardOf(const Key &key) const {
+    const uint64_t h = static_cast<uint64_t>(hash_(key)) * 0xC2B2AE3D27D4EB4Full;
+
+    return shift_ == 64 ? 0 : static_cast<size_type>(h >> shift_);
+  }
+
+  Stripe& stripeOf(const Key &key) { return stripes_[shardOf(key)]; }
+
+  const Stripe& stripeOf(const Key &key) const { return stripes_[shardOf(key)]; }
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+ConcurrentHashMap<Key, T, Hash, KeyEqual>::ConcurrentHashMap(size_type shard_count) {
+  if (shard_count == 0) {
+    throw ArrayException("ConcurrentHashMap needs at least one shard");
+  }
+
+  count_ = 1;
+  shift_ = 64;
+
+  while (count_ < shard_count) {
+    count_ *= 2;
+    --shift_;
+  }
+
+  stripes_ = new Stripe[count_];
+}
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool ConcurrentHashMap<Key, T, Hash, KeyEqual>::find(const Key &key, T &out) const {
+  const Stripe &stripe = stripeOf(key);
+  std::shared_lock<std::shared_mutex> lock(stripe.mutex_);
+
+  const T *value = stripe.map_.lookup(key);
+
+  if (value == nullptr) {
+    return false;
+  }
+
+  out = *value;
+
+  return true;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename Make>
+T ConcurrentHashMap<Key, T, Hash, KeyEqual>::compute_if_absent(const Key &key, Make make) {
+  Stripe &stripe = stripeOf(key);
+
+  {
+    std::shared_lock<std::shared_mutex> lock(stripe.mutex_);
+
+    const T *value = stripe.map_.lookup(key);
+
+    if (value != nullptr) {
+      return *value;
+    }
+  }
+
+  std::unique_lock<std::shared_mutex> lock(stripe.mutex_);
+
+  // someone could have inserted it between the two locks
+  const T *value = stripe.map_.lookup(key);
+
+  if (value != nullptr) {
+    return *value;
+  }
+
+  return *stripe.map_.insert(key, make(key)).first;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename Visit>
+void ConcurrentHashMap<Key, T, Hash, KeyEqual>::for_each_shard(Visit visit) const {
+  for (size_type i = 0; i < count_; ++i) {
+    std::shared_lock<std::shared_mutex> lock(stripes_[i].mutex_);
+    visit(static_cast<const Shard&>(stripes_[i].map_));
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename Visit>
+void ConcurrentHashMap<Key, T, Hash, KeyEqual>::for_each_shard(ThreadPool &pool, Visit visit) const {
+  pool.parallel_for(0, count_, [this, &visit](size_type i) {
+    std::shared_lock<std::shared_mutex> lock(stripes_[i].mutex_);
+    visit(static_cast<const Shard&>(stripes_[i].map_));
+  }, 1);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void ConcurrentHashMap<Key, T, Hash, KeyEqual>::clear() {
+  for (size_type i = 0; i < count_; ++i) {
+    std::unique_lock<std::shared_mutex> lock(stripes_[i].mutex_);
+    stripes_[i].map_.clear();
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+size_t ConcurrentHashMap<Key, T, Hash, KeyEqual>::size() const {
+  size_type total = 0;
+
+  for (size_type i = 0; i < count_; ++i) {
+    std::shared_lock<std::shared_mutex> lock(stripes_[i].mutex_);
+    total += stripes_[i].map_.size();
+  }
+
+  return total;
+}
+
+} // namespace s21
+
+#endif // S21_CONCURRENT_HASH_MAP_H_
@@ -0,0 +1,279 @@
+#ifndef S21_CONCURRENT_LIST_H_
+#define S21_CONCURRENT_LIST_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+
+// Implementation of a lock-free sorted linked list (Harris list with
+// epoch based memory reclamation)
+//
+// Node is removed in two steps: first the lowest bit of its next_ pointer is
+// set (node is logically deleted, nothing can be linked after it anymore),
+// then it is physically unlinked by whoever walks by first. Insert and remove
+// help to unlink marked nodes they meet, contains only reads and never writes
+// to shared memory. Elements are kept sorted and unique, so the list works as a set
+
+template <typename T>
+class ConcurrentList { // does not inherit from Container, size is atomic here
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using size_type = size_t;
+  using value_type = T;
+  using const_reference = const T&;
+
+  struct Node {
+    const value_type data_;
+    std::atomic<Node*> next_;
+
+    Node(const_reference data) : data_{ data }, next_{ nullptr } {}
+  };
+
+  static constexpr uintptr_t kMark = 1;
+
+  // position found by find: *prev_ == current_, current_->next_ == next_
+  struct Position {
+    std::atomic<Node*> *prev_;
+    Node *current_;
+    Node *next_;
+  };
+
+  std::atomic<Node*> head_{ nullptr };
+  std::atomic<size_type> size_{ 0 };
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor. Creates an empty list
+  */
+  ConcurrentList() {}
+
+  /**
+   * @brief Initializer list constructor
+  */
+  ConcurrentList(std::initializer_list<value_type> const& items) {
+    for (const_reference item : items) {
+      insert(item);
+    }
+  }
+
+  ConcurrentList(const ConcurrentList&) = delete;
+  ConcurrentList& operator=(const ConcurrentList&) = delete;
+
+  /**
+   * @brief Destructor. Deletes all nodes that are still linked
+   *
+   * @note No other thread should use the list at this point. Already removed
+   * nodes are deleted by epoch reclamation later on
+  */
+  ~ConcurrentList();
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Inserts a value if it is not in the list yet
+   *
+   * @return true if the value was inserted, false if it was already there
+  */
+  bool insert(const_reference value);
+
+  /**
+   * @brief Removes a value from the list
+   *
+   * @return true if this call removed the value, false if it was not in the list
+  */
+  bool remove(const_reference value);
+
+  /**
+   * @brief Checks if the list contains the given value
+  */
+  bool contains(const_reference value);
+
+  /**
+   * @brief Returns the number of elements
+   *
+   * @note Under concurrent modifications the value may already be outdated
+  */
+  size_type size() const { return size_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Returns true if the list is empty (see the note for size)
+  */
+  bool empty() const { return size() == 0; }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  static bool isMarked(Node *p) { return reinterpret_cast<uintptr_t>(p) & kMark; }
+
+  static Node* marked(Node *p) { return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(p) | kMark); }
+
+  static Node* unmarked(Node *p) { return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(p) & ~kMark); }
+
+  /**
+   * @brief Finds the first node with data not less than value
+   *
+   * @note Unlinks all marked nodes on the way. Should be called inside
+   * an EpochGuard, found nodes stay valid until the guard is left
+   *
+   * @return true if the found node holds exactly the value
+  */
+  bool find(const_reference value, Position &position);
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+template <typename T>
+ConcurrentList<T>::~ConcurrentList() {
+  Node *p = unmarked(head_.load(std::memory_order_relaxed));
+
+  while (p != nullptr) {
+    Node *next = unmarked(p->next_.load(std::memory_order_relaxed));
+    delete p;
+    p = next;
+  }
+}
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename T>
+bool ConcurrentList<T>::insert(const_reference value) {
+  EpochGuard guard;
+  Node *node = nullptr;
+  Position position;
+
+  while (true) {
+    if (find(value, position)) {
+      delete node;
+      return false;
+    }
+
+    if (node == nullptr) {
+      node = new Node(value);
+    }
+
+    node->next_.store(position.current_, std::memory_order_relaxed);
+
+    Node *expected = position.current_;
+    if (position.prev_->compare_exchange_strong(expected, node,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed)) {
+      size_.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+}
+
+template <typename T>
+bool ConcurrentList<T>::remove(const_reference value) {
+  EpochGuard guard;
+  Position position;
+
+  while (true) {
+    if (!find(value, position)) {
+      return false;
+    }
+
+    // logical deletion, the one who marks the node is the one who removed it
+    Node *next = position.next_;
+    if (!position.current_->next_.compare_exchange_strong(next, marked(next),
+                                                          std::memory_order_acq_rel,
+                                                          std::memory_order_relaxed)) {
+      continue;
+    }
+
+    size_.fetch_sub(1, std::memory_order_relaxed);
+
+    // physical deletion, if someone changed the previous node just let
+    // the next find clean it up
+    Node *expected = position.current_;
+    if (position.prev_->compare_exchange_strong(expected, next,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed)) {
+      Epoch::retire(position.current_);
+    } else {
+      find(value, position);
+    }
+
+    return true;
+  }
+}
+
+template <typename T>
+bool ConcurrentList<T>::contains(const_reference value) {
+  EpochGuard guard;
+
+  // wait-free walk: marked nodes are skipped, not unlinked
+  Node *current = head_.load(std::memory_order_acquire);
+
+  while (current != nullptr && current->data_ < value) {
+    current = unmarked(current->next_.load(std::memory_order_acquire));
+  }
+
+  return current != nullptr && !(value < current->data_) &&
+         !isMarked(current->next_.load(std::memory_order_acquire));
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+template <typename T>
+bool ConcurrentList<T>::find(const_reference value, Position &position) {
+try_again:
+  std::atomic<Node*> *prev = &head_;
+  Node *current = prev->load(std::memory_order_acquire);
+
+  while (true) {
+    if (current == nullptr) {
+      position = Position{ prev, nullptr, nullptr };
+      return false;
+    }
+
+    Node *next = current->next_.load(std::memory_order_acquire);
+
+    if (!isMarked(next)) {
+      if (!(current->data_ < value)) {
+        position = Position{ prev, current, next };
+        return !(value < current->data_);
+      }
+
+      prev = &current->next_;
+    } else { // current is logically deleted, help to unlink it
+      Node *expected = current;
+      if (!prev->compare_exchange_strong(expected, unmarked(next),
+                                         std::memory_order_acq_rel,
+                                         std::memory_order_acquire)) {
+        goto try_again; // previous node changed, start over
+      }
+
+      Epoch::retire(current);
+    }
+
+    current = unmarked(next);
+  }
+}
+
+} // namespace s21
+
+#endif  // S21_CONCURRENT_LIST_H_
@@ -0,0 +1,331 @@
+#ifndef S21_CONCURRENT_STACK_H_
+#define S21_CONCURRENT_STACK_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <utility>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+
+// Implementation of a lock-free stack (Treiber stack with an elimination
+// array and epoch based memory reclamation)
+//
+// Top of the stack is a single atomic pointer, push and pop swing it with one
+// compare-and-swap. Popped nodes are retired, not deleted, so a node can not
+// be freed and allocated again while some thread still holds its address:
+// this is what protects the compare-and-swap of pop from ABA.
+//
+// When the compare-and-swap fails (the top is contended) a thread does not
+// retry right away but visits a random slot of the elimination array: a push
+// leaves its node there for a while and a pop that comes by takes it. Such a
+// pair cancels out without touching the top at all, so under heavy load
+// pushes and pops mostly meet in different slots instead of fighting for
+// the same cache line.
+//
+// Stack may be bounded: push fails when capacity elements are already inside
+
+template <typename T>
+class ConcurrentStack { // does not inherit from Container, size is atomic here
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using size_type = size_t;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+
+  static constexpr size_type kCacheLine = 64;
+
+  // number of elimination slots and how long a push waits in its slot
+  static constexpr size_type kEliminationSlots = 8;
+  static constexpr int kEliminationSpins = 64;
+
+  struct Node {
+    // top copies data_ of a node other threads may be popping, so pop copies
+    // it as well. Nodes met in the elimination array are private to the pair
+    // and are moved from
+    value_type data_;
+    Node *next_;
+
+    template <typename Arg>
+    explicit Node(Arg &&data) : data_{ std::forward<Arg>(data) }, next_{ nullptr } {}
+  };
+
+  struct alignas(kCacheLine) Slot {
+    std::atomic<Node*> node_{ nullptr };
+  };
+
+  alignas(kCacheLine) std::atomic<Node*> head_{ nullptr };
+  alignas(kCacheLine) std::atomic<size_type> size_{ 0 };
+
+  size_type capacity_;
+  Slot slots_[kEliminationSlots];
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Creates an empty stack that holds at most capacity elements
+   *
+   * @note Without capacity the stack is unbounded
+  */
+  explicit ConcurrentStack(size_type capacity = std::numeric_limits<size_type>::max())
+      : capacity_{ capacity } {}
+
+  ConcurrentStack(const ConcurrentStack&) = delete;
+  ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+  /**
+   * @brief Destructor. Deletes all nodes that are still in the stack
+   *
+   * @note No other thread should use the stack at this point. Already popped
+   * nodes are deleted by epoch reclamation later on
+  */
+  ~ConcurrentStack();
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Inserts an element at the top of the stack
+   *
+   * @return false if the stack is full (nothing is inserted then)
+  */
+  bool push(const_reference value) { return emplace(value); }
+
+  bool push(value_type &&value) { return emplace(std::move(value)); }
+
+  /**
+   * @brief Copies the top element to out and removes it from the stack
+   *
+   * @return false if the stack is empty
+  */
+  bool pop(reference out);
+
+  /**
+   * @brief Copies the top element to out, the stack is not changed
+   *
+   * @note Under concurrent pops the element may be gone by the time top returns
+   *
+   * @return false if the stack is empty
+  */
+  bool top(reference out);
+
+  /**
+   * @brief Returns the number of elements
+   *
+   * @note Under concurrent modifications the value may already be outdated
+  */
+  size_type size() const { return size_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Returns true if the stack is empty (see the note for size)
+  */
+  bool empty() const { return head_.load(std::memory_order_acquire) == nullptr; }
+
+  /**
+   * @brief Returns the maximum number of elements
+  */
+  size_type capacity() const { return capacity_; }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  template <typename Arg>
+  bool emplace(Arg &&value);
+
+  /**
+   * @brief Leaves the node in a random elimination slot for a while
+   *
+   * @return true if a pop took the node, false if the node is still ours
+  */
+  bool offer(Node *node);
+
+  /**
+   * @brief Looks for a node left by a push in a random elimination slot
+   *
+   * @return the node (it is private to the caller now) or nullptr
+  */
+  Node* take();
+
+  /**
+   * @brief Returns a random elimination slot, every thread has its own sequence
+  */
+  Slot& randomSlot();
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+template <typename T>
+ConcurrentStack<T>::~ConcurrentStack() {
+  Node *p = head_.load(std::memory_order_relaxed);
+
+  while (p != nullptr) {
+    Node *next = p->next_;
+    delete p;
+    p = next;
+  }
+}
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename T>
+bool ConcurrentStack<T>::pop(reference out) {
+  EpochGuard guard;
+
+  while (true) {
+    Node *head = head_.load(std::memory_order_acquire);
+
+    if (head == nullptr) {
+      return false;
+    }
+
+    // head can not be freed (and come back to the top) while we are in the guard
+    if (head_.compare_exchange_weak(head, head->next_,
+                                    std::memory_order_acquire,
+                                    std::memory_order_relaxed)) {
+      out = head->data_;
+      size_.fetch_sub(1, std::memory_order_relaxed);
+      Epoch::retire(head);
+
+      return true;
+    }
+
+    if (Node *node = take()) {
+      out = std::move(node->data_);
+      size_.fetch_sub(1, std::memory_order_relaxed);
+      delete node;
+
+      return true;
+    }
+  }
+}
+
+template <typename T>
+bool ConcurrentStack<T>::top(reference out) {
+  EpochGuard guard;
+  Node *head = head_.load(std::memory_order_acquire);
+
+  if (head == nullptr) {
+    return false;
+  }
+
+  out = head->data_;
+
+  return true;
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+template <typename T>
+template <typename Arg>
+bool ConcurrentStack<T>::emplace(Arg &&value) {
+  // the place is reserved first, so concurrent pushes can not overfill the stack
+  if (size_.fetch_add(1, std::memory_order_relaxed) >= capacity_) {
+    size_.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  Node *node = new Node(std::forward<Arg>(value));
+  Node *head = head_.load(std::memory_order_relaxed);
+
+  while (true) {
+    node->next_ = head;
+
+    if (head_.compare_exchange_weak(head, node,
+                                    std::memory_order_release,
+                                    std::memory_order_relaxed)) {
+      return true;
+    }
+
+    if (offer(node)) {
+      return true;
+    }
+
+    head = head_.load(std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+bool ConcurrentStack<T>::offer(Node *node) {
+  Slot &slot = randomSlot();
+  Node *expected = nullptr;
+
+  if (!slot.node_.compare_exchange_strong(expected, node,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+    return false; // somebody else waits there
+  }
+
+  for (int i = 0; i < kEliminationSpins; ++i) {
+    if (slot.node_.load(std::memory_order_relaxed) != node) {
+      return true;
+    }
+  }
+
+  // nobody came: take the node back, if that fails a pop was faster
+  expected = node;
+  if (slot.node_.compare_exchange_strong(expected, nullptr,
+                                         std::memory_order_relaxed,
+                                         std::memory_order_relaxed)) {
+    std::this_thread::yield();
+    return false;
+  }
+
+  return true;
+}
+
+template <typename T>
+typename ConcurrentStack<T>::Node* ConcurrentStack<T>::take() {
+  Slot &slot = randomSlot();
+
+  for (int i = 0; i < kEliminationSpins; ++i) {
+    Node *node = slot.node_.load(std::memory_order_relaxed);
+
+    if (node != nullptr &&
+        slot.node_.compare_exchange_strong(node, nullptr,
+                                           std::memory_order_acquire,
+                                           std::memory_order_relaxed)) {
+      return node;
+    }
+  }
+
+  std::this_thread::yield();
+  return nullptr;
+}
+
+template <typename T>
+typename ConcurrentStack<T>::Slot& ConcurrentStack<T>::randomSlot() {
+  // xorshift seeded with the address of the thread local itself
+  thread_local uint32_t state = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&state) >> 4) | 1u;
+
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+
+  return slots_[state % kEliminationSlots];
+}
+
+} // namespace s21
+
+#endif  // S21_CONCURRENT_STACK_H_
@@ -1,7 +1,10 @@
 #ifndef S21_CONTAINER_H_
 #define S21_CONTAINER_H_
 
+#include <cstddef>
+#include <iterator>
 #include <limits>
+#include <type_traits>
 #include "../s21_containers.h"
 
 namespace s21 {
@@ -18,18 +21,18 @@ protected:
 
   size_type size_{ 0 };
 
-  Container() {}
+  constexpr Container() {}
 
 public:
   /**
    * @brief Returns the number of elements in the container
   */
-  size_type size() const{ return size_; }
+  constexpr size_type size() const{ return size_; }
 
   /**
    * @brief Returns true if the container is empty, false otherwise
   */
-  bool empty() const { return size_ == 0; }
+  constexpr bool empty() const { return size_ == 0; }
 
   /**
    * @brief Returns the maximum number of elements the container is able to hold
@@ -37,6 +40,34 @@ public:
   size_type max_size() { return std::numeric_limits<size_type>::max(); }
 };
 
+/**
+ * @brief True for iterators that can walk a range more than once
+ *
+ * @note Input iterators (streams) are single-pass. Iterators of the library
+ * declare no category, all of them are multi-pass
+*/
+template <typename It, typename = void>
+struct MultiPass : std::true_type {};
+
+template <typename It>
+struct MultiPass<It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+    : std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category> {};
+
+/**
+ * @brief Number of elements in [first, last) of a multi-pass range
+ *
+ * @note Counted by hand: not every iterator of the library supports operator-
+*/
+template <typename It>
+size_t countRange(It first, It last) {
+  size_t n = 0;
+  for (; first != last; ++first) {
+    ++n;
+  }
+
+  return n;
+}
+
 }
 
 #endif  // S21_CONTAINERS_H_
\ No newline at end of file
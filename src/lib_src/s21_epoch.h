@@ -0,0 +1,272 @@
+#ifndef S21_EPOCH_H_
+#define S21_EPOCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "../array_exception.h"
+
+namespace s21 {
+
+/**
+ * @brief Epoch based memory reclamation for lock-free containers
+ *
+ * @details Every operation on a container runs inside an EpochGuard. While a
+ * thread is inside a guard it announces the global epoch it has seen. Nodes
+ * unlinked from a container are retired together with the current epoch and
+ * deleted once the global epoch moved two steps further: by then every thread
+ * that could still hold a pointer to them has left its guard.
+ *
+ * Compared to hazard pointers readers pay one fence per operation instead of
+ * one per visited node, which is what read-mostly containers need. The price is
+ * that a thread stuck inside a guard delays reclamation for everyone
+*/
+class Epoch {
+public:
+  static constexpr size_t kMaxThreads = 128;
+
+  /**
+   * @brief Enters a critical section, pointers read from containers stay
+   * valid until the matching exit
+   *
+   * @note Guards can be nested, only the outermost one announces the epoch
+  */
+  static void enter() {
+    ThreadData &data = threadData();
+
+    if (data.nesting_++ > 0) {
+      return;
+    }
+
+    Record &record = *data.record();
+    uint64_t epoch = domain().epoch_.load(std::memory_order_relaxed);
+    record.epoch_.exchange(epoch | kActive, std::memory_order_seq_cst);
+
+    // announcement must be visible before any node is read
+    fullFence();
+  }
+
+  /**
+   * @brief Leaves a critical section
+  */
+  static void exit() {
+    ThreadData &data = threadData();
+
+    if (--data.nesting_ > 0) {
+      return;
+    }
+
+    data.record()->epoch_.store(0, std::memory_order_release);
+  }
+
+  /**
+   * @brief Schedules deletion of a node that is not reachable from the
+   * container anymore
+  */
+  template <typename T>
+  static void retire(T *p) {
+    ThreadData &data = threadData();
+    uint64_t epoch = domain().epoch_.load(std::memory_order_acquire);
+
+    data.retired_.push_back(Retired{ p, [](void *ptr) { delete static_cast<T*>(ptr); }, epoch });
+
+    if (data.retired_.size() >= kReclaimThreshold) {
+      reclaim(data.retired_);
+    }
+  }
+
+private:
+  // lowest bit of an announced epoch tells that the thread is inside a guard
+  // (global epoch is always advanced by 2, so the bit is free)
+  static constexpr uint64_t kActive = 1;
+  static constexpr uint64_t kStep = 2;
+
+  // number of retired nodes a thread collects before trying to delete them
+  static constexpr size_t kReclaimThreshold = 128;
+
+  struct Retired {
+    void *ptr_;
+    void (*deleter_)(void*);
+    uint64_t epoch_;
+  };
+
+  // every record lives on its own cache line, so threads do not
+  // invalidate each other's lines when they enter and exit guards
+  struct alignas(64) Record {
+    std::atomic<bool> in_use_{ false };
+    std::atomic<uint64_t> epoch_{ 0 };
+  };
+
+  struct Domain {
+    std::atomic<uint64_t> epoch_{ kStep };
+
+    Record records_[kMaxThreads];
+    std::atomic<size_t> records_used_{ 0 };
+
+    std::mutex orphans_mutex_;
+    std::vector<Retired> orphans_;
+
+    // no threads are left at this point, everything can go
+    ~Domain() {
+      for (Retired &retired : orphans_) {
+        retired.deleter_(retired.ptr_);
+      }
+    }
+  };
+
+  // record of a thread is released when the thread exits, nodes it
+  // could not delete yet are handed over to the orphans list
+  struct ThreadData {
+    Record *record_ = nullptr;
+    size_t nesting_ = 0;
+    std::vector<Retired> retired_;
+
+    Record* record() {
+      if (record_ == nullptr) {
+        record_ = acquireRecord();
+      }
+
+      return record_;
+    }
+
+    ~ThreadData() {
+      if (record_ == nullptr) {
+        return;
+      }
+
+      record_->epoch_.store(0, std::memory_order_release);
+
+      reclaim(retired_);
+
+      if (!retired_.empty()) {
+        std::lock_guard<std::mutex> lock(domain().orphans_mutex_);
+        domain().orphans_.insert(domain().orphans_.end(), retired_.begin(), retired_.end());
+      }
+
+      record_->in_use_.store(false, std::memory_order_release);
+    }
+  };
+
+  static Domain& domain() {
+    static Domain instance;
+    return instance;
+  }
+
+  /**
+   * @brief Orders the epoch announcement with the following reads of nodes
+   *
+   * @note Thread sanitizer does not understand fences, under it we rely on
+   * seq_cst operations only (which is enough for x86 anyway)
+  */
+  static void fullFence() {
+#if !defined(__SANITIZE_THREAD__)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+  }
+
+  static ThreadData& threadData() {
+    thread_local ThreadData data;
+    return data;
+  }
+
+  /**
+   * @brief Finds a free record for the calling thread
+   *
+   * @throws ArrayException if more than kMaxThreads threads use lock-free containers at once
+  */
+  static Record* acquireRecord() {
+    Domain &global = domain();
+
+    for (size_t i = 0; i < kMaxThreads; ++i) {
+      bool expected = false;
+
+      if (!global.records_[i].in_use_.load(std::memory_order_relaxed) &&
+          global.records_[i].in_use_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        size_t used = global.records_used_.load(std::memory_order_relaxed);
+        while (used < i + 1 &&
+               !global.records_used_.compare_exchange_weak(used, i + 1, std::memory_order_acq_rel)) {
+        }
+
+        return &global.records_[i];
+      }
+    }
+
+    throw ArrayException("Too many threads are using lock-free containers");
+  }
+
+  /**
+   * @brief Moves the global epoch forward if every thread inside a guard
+   * has already seen the current one
+   *
+   * @return Global epoch after the attempt
+  */
+  static uint64_t tryAdvance() {
+    Domain &global = domain();
+
+    fullFence();
+
+    uint64_t epoch = global.epoch_.load(std::memory_order_seq_cst);
+    const size_t used = global.records_used_.load(std::memory_order_acquire);
+
+    for (size_t i = 0; i < used; ++i) {
+      uint64_t announced = global.records_[i].epoch_.load(std::memory_order_seq_cst);
+      if ((announced & kActive) && (announced & ~kActive) != epoch) {
+        return epoch; // someone is still in the previous epoch
+      }
+    }
+
+    if (global.epoch_.compare_exchange_strong(epoch, epoch + kStep, std::memory_order_acq_rel)) {
+      return epoch + kStep;
+    }
+
+    return epoch; // someone else advanced it, fresh value is in epoch
+  }
+
+  /**
+   * @brief Deletes retired nodes that are at least two epochs old
+  */
+  static void reclaim(std::vector<Retired> &retired) {
+    Domain &global = domain();
+
+    // nodes of exited threads are adopted by the reclaiming thread
+    {
+      std::unique_lock<std::mutex> lock(global.orphans_mutex_, std::try_to_lock);
+      if (lock.owns_lock() && !global.orphans_.empty()) {
+        retired.insert(retired.end(), global.orphans_.begin(), global.orphans_.end());
+        global.orphans_.clear();
+      }
+    }
+
+    uint64_t epoch = tryAdvance();
+
+    size_t kept = 0;
+    for (size_t i = 0; i < retired.size(); ++i) {
+      if (retired[i].epoch_ + 2 * kStep <= epoch) {
+        retired[i].deleter_(retired[i].ptr_);
+      } else {
+        retired[kept++] = retired[i];
+      }
+    }
+
+    retired.resize(kept);
+  }
+};
+
+/**
+ * @brief RAII wrapper for Epoch::enter and Epoch::exit
+*/
+class EpochGuard {
+public:
+  EpochGuard() { Epoch::enter(); }
+  ~EpochGuard() { Epoch::exit(); }
+
+  EpochGuard(const EpochGuard&) = delete;
+  EpochGuard& operator=(const EpochGuard&) = delete;
+};
+
+} // namespace s21
+
+#endif  // S21_EPOCH_H_
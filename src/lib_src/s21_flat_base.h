@@ -0,0 +1,340 @@
+#ifndef S21_FLAT_BASE_H_
+#define S21_FLAT_BASE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "s21_container.h"
+#include "s21_vector.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of sorted vector storage, base class for FlatMap, FlatSet and
+// FlatMultiset
+//
+// Keys are kept sorted in one s21::Vector, lookups are binary searches over
+// contiguous memory instead of a pointer chase per tree level. A single insert
+// or erase shifts the tail of the vector, so flat containers are meant to be
+// filled in bulk (insert_many, insert_range sort the new elements and merge
+// them in one pass) and then mostly read
+
+template <typename Key, typename Compare>
+class FlatBase : public Container {
+protected:
+  // type overrides to make class code easy to understand (really..?)
+  using key_type = Key;
+  using const_key_reference = const Key&;
+
+  Vector<Key> keys_;
+  Compare comp_;
+
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  FlatBase() {}
+
+  FlatBase(const FlatBase &other) : keys_{ other.keys_ }, comp_{ other.comp_ } { size_ = other.size_; }
+
+  FlatBase(FlatBase &&other) : keys_{ std::move(other.keys_) }, comp_{ std::move(other.comp_) } {
+    size_ = other.size_;
+    other.size_ = 0;
+  }
+
+  FlatBase& operator=(FlatBase &&other) {
+    if (this != &other) {
+      keys_ = std::move(other.keys_);
+      comp_ = std::move(other.comp_);
+      size_ = other.size_;
+      other.size_ = 0;
+    }
+
+    return *this;
+  }
+
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Index of the first key not less than key (size_ if there is none)
+  */
+  size_type lowerIndex(const_key_reference key) const {
+    return boundIndex([&](const_key_reference stored) { return comp_(stored, key); });
+  }
+
+  /**
+   * @brief Index of the first key greater than key (size_ if there is none)
+  */
+  size_type upperIndex(const_key_reference key) const {
+    return boundIndex([&](const_key_reference stored) { return !comp_(key, stored); });
+  }
+
+  /**
+   * @brief Index of the first key for which before(key) is false, keys for
+   * which it is true must all come first
+   *
+   * @note Branch-free binary search: the half is picked by a conditional move,
+   * not a jump, so there is nothing to mispredict and the loop runs exactly
+   * log2(size_) times
+  */
+  template <typename Before>
+  size_type boundIndex(Before before) const {
+    if (size_ == 0) {
+      return 0;
+    }
+
+    const Key *base = keys_.data();
+    size_type length = size_;
+
+    while (length > 1) {
+      const size_type half = length / 2;
+      base = before(base[half - 1]) ? base + half : base;
+      length -= half;
+    }
+
+    return (base - keys_.data()) + before(*base);
+  }
+
+  /**
+   * @brief Index of the key, size_ if it is not there
+  */
+  size_type findIndex(const_key_reference key) const {
+    const size_type index = lowerIndex(key);
+
+    return index < size_ && !comp_(key, keys_[index]) ? index : size_;
+  }
+
+  /**
+   * @brief Index of the key
+   *
+   * @throws ArrayException if element with specified key is not in the container
+  */
+  size_type find(const_key_reference key) const {
+    const size_type index = findIndex(key);
+
+    if (index == size_) {
+      throw ArrayException("Element with specified key was not found");
+    }
+
+    return index;
+  }
+
+  /**
+   * @brief Inserts key at index, the tail is shifted one position to the right
+  */
+  void insertKeyAt(size_type index, const_key_reference key) {
+    insertAt(keys_, index, key);
+    ++size_;
+  }
+
+  /**
+   * @brief Removes keys in [first, last)
+  */
+  void eraseKeys(size_type first, size_type last) {
+    eraseRange(keys_, first, last);
+    size_ -= last - first;
+  }
+
+  /**
+   * @brief Sorts count new elements and merges them with the stored ones in one pass
+   *
+   * @details new_key(i) gives the key of the i-th new element. Every element of
+   * the result is reported to the derived class, which moves its own data along:
+   * take_old(from, to) for a stored element, take_new(i, to) for a new one.
+   * If unique is set, a new key that is already there (or came earlier among
+   * new ones) is dropped
+   *
+   * @return final position of every new element and whether it was inserted
+   * (position of the element that kept the key if it was dropped)
+  */
+  template <typename NewKey, typename TakeOld, typename TakeNew>
+  std::vector<std::pair<size_type, bool>> mergeMany(size_type count, NewKey new_key, bool unique,
+                                                    TakeOld take_old, TakeNew take_new);
+
+  /**
+   * @brief Inserts value at index of a vector, the tail is shifted to the right
+  */
+  template <typename T>
+  static void insertAt(Vector<T> &vector, size_type index, const T &value) {
+    vector.push_back(value);
+    std::rotate(vector.data() + index, vector.data() + vector.size() - 1,
+                vector.data() + vector.size());
+  }
+
+  /**
+   * @brief Removes elements [first, last) of a vector, the tail is shifted to the left
+  */
+  template <typename T>
+  static void eraseRange(Vector<T> &vector, size_type first, size_type last) {
+    std::move(vector.data() + last, vector.data() + vector.size(), vector.data() + first);
+
+    for (size_type i = first; i < last; ++i) {
+      vector.pop_back();
+    }
+  }
+
+  /**
+   * @brief Drops elements of a vector after the first count ones
+  */
+  template <typename T>
+  static void truncate(Vector<T> &vector, size_type count) {
+    while (vector.size() > count) {
+      vector.pop_back();
+    }
+  }
+
+/* ========================================================================= */
+/*                                Iterators                                  */
+/* ========================================================================= */
+
+  /**
+   * @brief Position in the sorted vector, dereferencing gives the key
+  */
+  class KeyIterator {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Key;
+    using pointer = const Key*;
+    using reference = const Key&;
+
+    KeyIterator(const FlatBase &base, size_type index) : base_{ &base }, index_{ index } {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the key pointed by the iterator
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    const_key_reference operator*() const {
+      if (index_ >= base_->size_) {
+        throw ArrayException("Cannot dereference an unset iterator");
+      }
+
+      return base_->keys_[index_];
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on equality. Returns true
+     * if both iterators point to the same element, false otherwise
+    */
+    bool operator==(const KeyIterator &other) const {
+      return base_ == other.base_ && index_ == other.index_;
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on unequality. Returns true
+     * if iterators point to different elements, false otherwise
+    */
+    bool operator!=(const KeyIterator &other) const { return !(*this == other); }
+
+    /**
+     * @brief Returns the position of the iterator in the container
+    */
+    size_type index() const { return index_; }
+
+  protected:
+    /**
+     * @throws ArrayException if iterator is at the end
+    */
+    void increment() {
+      if (index_ >= base_->size_) {
+        throw ArrayException("Cannot increment an unset iterator");
+      }
+
+      ++index_;
+    }
+
+    /**
+     * @throws ArrayException if iterator is at the beginning
+    */
+    void decrement() {
+      if (index_ == 0) {
+        throw ArrayException("Cannot decrement an iterator at the beginning");
+      }
+
+      --index_;
+    }
+
+    const FlatBase *base_;
+    size_type index_;
+  };
+
+public: // methods are the part of the derived class interface
+  /**
+   * @brief Checks if the container contains an element with a specific key
+  */
+  bool contains(const_key_reference key) const { return findIndex(key) != size_; }
+
+  /**
+   * @brief Makes room for count elements
+  */
+  void reserve(size_type count) { keys_.reserve(count); }
+};
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename Key, typename Compare>
+template <typename NewKey, typename TakeOld, typename TakeNew>
+std::vector<std::pair<size_t, bool>> FlatBase<Key, Compare>::mergeMany(size_type count, NewKey new_key, bool unique,
+                                                                       TakeOld take_old, TakeNew take_new) {
+  std::vector<std::pair<size_type, bool>> result(count);
+
+  // positions of new elements sorted by key, stable: the first of equal keys wins
+  std::vector<size_type> order(count);
+  for (size_type i = 0; i < count; ++i) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](size_type a, size_type b) {
+    return comp_(new_key(a), new_key(b));
+  });
+
+  // Vector has no move push_back, slots are made first and assigned by move
+  Vector<Key> merged(size_ + count);
+  size_type out = 0;
+  size_type old = 0;
+  size_type next = 0;
+
+  while (old < size_ || next < count) {
+    // stored elements go first among equal keys
+    if (next == count || (old < size_ && !comp_(new_key(order[next]), keys_[old]))) {
+      merged[out] = std::move(keys_[old]);
+      take_old(old, out);
+      ++old;
+      ++out;
+      continue;
+    }
+
+    const size_type item = order[next++];
+
+    if (unique && out > 0 && !comp_(merged[out - 1], new_key(item))) {
+      result[item] = std::make_pair(out - 1, false);
+      continue;
+    }
+
+    merged[out] = new_key(item);
+    take_new(item, out);
+    result[item] = std::make_pair(out, true);
+    ++out;
+  }
+
+  truncate(merged, out);
+  keys_ = std::move(merged);
+  size_ = out;
+
+  return result;
+}
+
+} // namespace s21
+
+#endif // S21_FLAT_BASE_H_
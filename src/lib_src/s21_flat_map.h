@@ -0,0 +1,477 @@
+#ifndef S21_FLAT_MAP_H_
+#define S21_FLAT_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "s21_flat_base.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a map collection on sorted vectors (see FlatBase)
+//
+// Keys and mapped values live in two parallel vectors, so a binary search only
+// touches keys. Interface follows Map: dereferenced iterator gives the mapped
+// value, key() gives the key. Iterators are positions in the vectors: any
+// insert or erase invalidates them
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class FlatMap : public FlatBase<Key, Compare> {
+public:
+  // forward declarations for iterators
+  class Iterator;
+  class ConstIterator;
+
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using key_type = Key;
+  using mapped_type = T;
+
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  using Base = FlatBase<Key, Compare>;
+  using size_type = typename Base::size_type;
+
+  Vector<T> values_; // values_[i] is mapped by keys_[i]
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor, creates an empty map
+  */
+  FlatMap() : Base() {}
+
+  /**
+   * @brief Initializer list constructor, elements are sorted once
+   *
+   * @note The first of the pairs with equal keys is kept
+  */
+  FlatMap(std::initializer_list<value_type> const &items) {
+    insert_range(items.begin(), items.end());
+  }
+
+  /**
+   * @brief Copy constructor
+   *
+   * @note Performs deep copy of passed parameter other
+  */
+  FlatMap(const FlatMap &other) : Base(other), values_{ other.values_ } {}
+
+  /**
+   * @brief Move constructor
+  */
+  FlatMap(FlatMap &&other) : Base(std::move(other)), values_{ std::move(other.values_) } {}
+
+  /**
+   * @brief Assignment operator overload for moving an object
+  */
+  FlatMap& operator=(FlatMap &&other) {
+    if (this != &other) {
+      Base::operator=(std::move(other));
+      values_ = std::move(other.values_);
+    }
+
+    return *this;
+  }
+
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Access a specified element with bounds checking
+   *
+   * @throws ArrayException if key is not in the map
+  */
+  T& at(const Key &key) {
+    return values_[Base::find(key)];
+  }
+
+  const T& at(const Key &key) const {
+    return values_[Base::find(key)];
+  }
+
+  /**
+   * @brief Access or insert specified element
+   *
+   * @note Inserts a value initialized element if the key is not in the map
+  */
+  T& operator[](const Key &key) {
+    const size_type index = this->lowerIndex(key);
+
+    if (index == this->size_ || this->comp_(key, this->keys_[index])) {
+      insertEntryAt(index, key, T());
+    }
+
+    return values_[index];
+  }
+
+  /**
+   * @brief Inserts a key-value pair and returns an iterator to where the element
+   * is in the container and bool denoting whether the insertion took place
+  */
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+
+  /**
+   * @brief Inserts a value by key and returns an iterator to where the element
+   * is in the container and bool denoting whether the insertion took place
+  */
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    const size_type index = this->lowerIndex(key);
+
+    if (index < this->size_ && !this->comp_(key, this->keys_[index])) {
+      return std::make_pair(Iterator(*this, index), false);
+    }
+
+    insertEntryAt(index, key, obj);
+
+    return std::make_pair(Iterator(*this, index), true);
+  }
+
+  /**
+   * @brief Inserts an element or assigns to the current element if the key already exists
+   *
+   * @return iterator to the element and true if it was inserted, false if assigned
+  */
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    auto result = insert(key, obj);
+
+    if (!result.second) {
+      values_[result.first.index()] = obj;
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Inserts key-value pairs of [first, last), they are sorted and merged
+   * in one pass
+  */
+  template <typename InputIt>
+  void insert_range(InputIt first, InputIt last) {
+    std::vector<std::pair<key_type, mapped_type>> items;
+
+    for (; first != last; ++first) {
+      items.emplace_back(first->first, first->second);
+    }
+
+    insertItems(items);
+  }
+
+  /**
+   * @brief Erases an element at pos in the map
+  */
+  bool erase(iterator pos) {
+    if (pos.index() >= this->size_) {
+      return false;
+    }
+
+    eraseEntries(pos.index(), pos.index() + 1);
+
+    return true;
+  }
+
+  /**
+   * @brief Removes an element with the key
+  */
+  bool remove(const Key &key) {
+    const size_type index = this->findIndex(key);
+
+    if (index == this->size_) {
+      return false;
+    }
+
+    eraseEntries(index, index + 1);
+
+    return true;
+  }
+
+  /**
+   * @brief Finds an element with a specific key in the map
+   *
+   * @throws ArrayException if element with specified key is not in the map
+  */
+  iterator find(const Key &key) {
+    return Iterator(*this, Base::find(key));
+  }
+
+  const_iterator find(const Key &key) const {
+    return ConstIterator(*this, Base::find(key));
+  }
+
+  /**
+   * @brief Returns an iterator to the first element with a key not less than the given one
+  */
+  iterator lower_bound(const Key &key) {
+    return Iterator(*this, this->lowerIndex(key));
+  }
+
+  const_iterator lower_bound(const Key &key) const {
+    return ConstIterator(*this, this->lowerIndex(key));
+  }
+
+  /**
+   * @brief Returns an iterator to the first element with a key greater than the given one
+  */
+  iterator upper_bound(const Key &key) {
+    return Iterator(*this, this->upperIndex(key));
+  }
+
+  const_iterator upper_bound(const Key &key) const {
+    return ConstIterator(*this, this->upperIndex(key));
+  }
+
+  /**
+   * @brief Clears the contents of the map
+  */
+  void clear() {
+    this->keys_.clear();
+    values_.clear();
+    this->size_ = 0;
+  }
+
+  /**
+   * @brief Swaps the contents of two maps
+  */
+  void swap(FlatMap &other) {
+    if (this == &other) {
+      return;
+    }
+
+    FlatMap temp{ std::move(*this) };
+
+    *this = std::move(other);
+    other = std::move(temp);
+  }
+
+  /**
+   * @brief Inserts elements of other with keys that are not in the map yet
+  */
+  void merge(const FlatMap &other) {
+    std::vector<std::pair<key_type, mapped_type>> items;
+
+    for (size_type i = 0; i < other.size_; ++i) {
+      items.emplace_back(other.keys_[i], other.values_[i]);
+    }
+
+    insertItems(items);
+  }
+
+  /**
+   * @brief Makes room for count elements
+  */
+  void reserve(size_type count) {
+    Base::reserve(count);
+    values_.reserve(count);
+  }
+
+
+/* ========================================================================= */
+/*                                Iterators                                  */
+/* ========================================================================= */
+
+  class ConstIterator : public Base::KeyIterator {
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the first element
+    */
+    ConstIterator(const FlatMap &map) : Base::KeyIterator(map, 0) {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given index
+    */
+    ConstIterator(const FlatMap &map, size_type index) : Base::KeyIterator(map, index) {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the mapped value
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    const mapped_type& operator*() const {
+      key(); // bounds check
+
+      return static_cast<const FlatMap*>(this->base_)->values_[this->index_];
+    }
+
+    /**
+     * @brief Returns a copy of the key-value pair, keys and values are stored apart
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    value_type pair() const { return value_type(key(), ConstIterator::operator*()); }
+
+    /**
+     * @brief Returns the key of the element pointed by the iterator
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    const key_type& key() const { return Base::KeyIterator::operator*(); }
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    ConstIterator& operator++() {
+      this->increment();
+
+      return *this;
+    }
+
+    /**
+     * @brief Decrement operator. Moves the iterator to the previous element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the beginning
+    */
+    ConstIterator& operator--() {
+      this->decrement();
+
+      return *this;
+    }
+  };
+
+  // mutable iterator is made only from a mutable map, so it keeps the map
+  // without const and is a const iterator as well
+  class Iterator : public ConstIterator {
+  private:
+    FlatMap *map_;
+
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the first element
+    */
+    Iterator(FlatMap &map) : ConstIterator(map), map_{ &map } {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given index
+    */
+    Iterator(FlatMap &map, size_type index) : ConstIterator(map, index), map_{ &map } {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the mapped value
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    mapped_type& operator*() const {
+      this->key(); // bounds check
+
+      return map_->values_[this->index_];
+    }
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    Iterator& operator++() {
+      this->increment();
+
+      return *this;
+    }
+
+    /**
+     * @brief Decrement operator. Moves the iterator to the previous element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the beginning
+    */
+    Iterator& operator--() {
+      this->decrement();
+
+      return *this;
+    }
+  };
+
+  iterator begin() {
+    return Iterator(*this);
+  }
+
+  iterator end() {
+    return Iterator(*this, this->size_);
+  }
+
+  const_iterator cbegin() const {
+    return ConstIterator(*this);
+  }
+
+  const_iterator cend() const {
+    return ConstIterator(*this, this->size_);
+  }
+
+
+  /* ========================================================================= */
+  /*                        Bonus Methods (insert_many)                        */
+  /* ========================================================================= */
+
+  /**
+   * @brief Inserts all key-value pairs at once: they are sorted and merged in one pass
+  */
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    const std::vector<std::pair<key_type, mapped_type>> items{ args... };
+    std::vector<std::pair<iterator, bool>> result;
+
+    for (const auto &position : insertItems(items)) {
+      result.push_back(std::make_pair(Iterator(*this, position.first), position.second));
+    }
+
+    return result;
+  }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  void insertEntryAt(size_type index, const Key &key, const T &obj) {
+    this->insertKeyAt(index, key);
+    Base::insertAt(values_, index, obj);
+  }
+
+  void eraseEntries(size_type first, size_type last) {
+    this->eraseKeys(first, last);
+    Base::eraseRange(values_, first, last);
+  }
+
+  std::vector<std::pair<size_type, bool>> insertItems(const std::vector<std::pair<key_type, mapped_type>> &items);
+};
+
+
+/* ========================================================================= */
+/*                 Private Helper Methods Implementation                     */
+/* ========================================================================= */
+
+template <typename Key, typename T, typename Compare>
+auto FlatMap<Key, T, Compare>::insertItems(const std::vector<std::pair<key_type, mapped_type>> &items)
+    -> std::vector<std::pair<size_type, bool>> {
+  Vector<T> merged(this->size_ + items.size());
+
+  auto result = this->mergeMany(
+      items.size(), [&items](size_type i) -> const key_type& { return items[i].first; }, true,
+      [&](size_type from, size_type to) { merged[to] = std::move(values_[from]); },
+      [&](size_type i, size_type to) { merged[to] = items[i].second; });
+
+  Base::truncate(merged, this->size_);
+  values_ = std::move(merged);
+
+  return result;
+}
+
+} // namespace s21
+
+#endif // S21_FLAT_MAP_H_
@@ -0,0 +1,303 @@
+#ifndef S21_FLAT_MULTISET_H_
+#define S21_FLAT_MULTISET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "s21_flat_base.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a multiset collection on a sorted vector (see FlatBase)
+//
+// Equal elements are stored side by side in insertion order. Iterators are
+// positions in the vector: any insert or erase invalidates them
+
+template <typename T, typename Compare = std::less<T>>
+class FlatMultiset : public FlatBase<T, Compare> {
+public:
+  // forward declarations for iterators
+  class Iterator;
+  class ConstIterator;
+
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  using Base = FlatBase<T, Compare>;
+  using size_type = typename Base::size_type;
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor, creates an empty multiset
+  */
+  FlatMultiset() : Base() {}
+
+  /**
+   * @brief Initializer list constructor, elements are sorted once
+  */
+  FlatMultiset(std::initializer_list<value_type> const &items) {
+    insert_range(items.begin(), items.end());
+  }
+
+  /**
+   * @brief Copy constructor
+   *
+   * @note Performs deep copy of passed parameter other
+  */
+  FlatMultiset(const FlatMultiset &other) : Base(other) {}
+
+  /**
+   * @brief Move constructor
+  */
+  FlatMultiset(FlatMultiset &&other) : Base(std::move(other)) {}
+
+  /**
+   * @brief Assignment operator overload for moving an object
+  */
+  FlatMultiset& operator=(FlatMultiset &&other) {
+    Base::operator=(std::move(other));
+
+    return *this;
+  }
+
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Inserts a value after the equal ones and returns an iterator to it,
+   * insertion always takes place
+  */
+  std::pair<iterator, bool> insert(const value_type &value) {
+    const size_type index = this->upperIndex(value);
+
+    this->insertKeyAt(index, value);
+
+    return std::make_pair(Iterator(*this, index), true);
+  }
+
+  /**
+   * @brief Inserts elements of [first, last), they are sorted and merged in one pass
+  */
+  template <typename InputIt>
+  void insert_range(InputIt first, InputIt last) {
+    const std::vector<value_type> items(first, last);
+    insertItems(items);
+  }
+
+  /**
+   * @brief Erases an element at pos in the multiset
+  */
+  bool erase(iterator pos) {
+    if (pos.index() >= this->size_) {
+      return false;
+    }
+
+    this->eraseKeys(pos.index(), pos.index() + 1);
+
+    return true;
+  }
+
+  /**
+   * @brief Removes all elements with the key
+  */
+  bool remove(const value_type &value) {
+    const size_type first = this->lowerIndex(value);
+    const size_type last = this->upperIndex(value);
+
+    this->eraseKeys(first, last);
+
+    return first != last;
+  }
+
+  /**
+   * @brief Finds an element with a specific key in the multiset
+   *
+   * @note Returned iterator always points to the first occurence of the element
+   * with a specified value
+   *
+   * @throws ArrayException if element with specified key is not in the multiset
+  */
+  Iterator find(const T &value) const {
+    return Iterator(*this, Base::find(value));
+  }
+
+  /**
+   * @brief Returns the number of elements matching a specific key
+  */
+  size_type count(const_reference key) const {
+    return this->upperIndex(key) - this->lowerIndex(key);
+  }
+
+  /**
+   * @brief Returns an open range [begin, end) of elements matching a specific key
+   *
+   * @note Both iterators point to lower_bound(key) if there is no such key
+  */
+  std::pair<iterator, iterator> equal_range(const_reference key) const {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+  /**
+   * @brief Returns an iterator to the first element not less than the given key
+  */
+  iterator lower_bound(const_reference key) const {
+    return Iterator(*this, this->lowerIndex(key));
+  }
+
+  /**
+   * @brief Returns an iterator to the first element greater than the given key
+  */
+  iterator upper_bound(const_reference key) const {
+    return Iterator(*this, this->upperIndex(key));
+  }
+
+  /**
+   * @brief Clears the contents of the multiset
+  */
+  void clear() {
+    this->keys_.clear();
+    this->size_ = 0;
+  }
+
+  /**
+   * @brief Swaps the contents of two multisets
+  */
+  void swap(FlatMultiset &other) {
+    if (this == &other) {
+      return;
+    }
+
+    FlatMultiset temp{ std::move(*this) };
+
+    *this = std::move(other);
+    other = std::move(temp);
+  }
+
+  /**
+   * @brief Inserts all elements of other
+  */
+  void merge(const FlatMultiset &other) {
+    insert_range(other.keys_.data(), other.keys_.data() + other.size_);
+  }
+
+/* ========================================================================= */
+/*                                Iterators                                  */
+/* ========================================================================= */
+
+  class Iterator : public Base::KeyIterator {
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the first element
+    */
+    Iterator(const FlatMultiset &multiset) : Base::KeyIterator(multiset, 0) {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given index
+    */
+    Iterator(const FlatMultiset &multiset, size_type index) : Base::KeyIterator(multiset, index) {}
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    Iterator& operator++() {
+      this->increment();
+
+      return *this;
+    }
+
+    /**
+     * @brief Decrement operator. Moves the iterator to the previous element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the beginning
+    */
+    Iterator& operator--() {
+      this->decrement();
+
+      return *this;
+    }
+  };
+
+  class ConstIterator : public Iterator {
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the first element
+    */
+    ConstIterator(const FlatMultiset &multiset) : Iterator(multiset) {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given index
+    */
+    ConstIterator(const FlatMultiset &multiset, size_type index) : Iterator(multiset, index) {}
+  };
+
+  iterator begin() const {
+    return Iterator(*this);
+  }
+
+  iterator end() const {
+    return Iterator(*this, this->size_);
+  }
+
+  const_iterator cbegin() const {
+    return ConstIterator(*this);
+  }
+
+  const_iterator cend() const {
+    return ConstIterator(*this, this->size_);
+  }
+
+
+  /* ========================================================================= */
+  /*                        Bonus Methods (insert_many)                        */
+  /* ========================================================================= */
+
+  /**
+   * @brief Inserts all arguments at once: they are sorted and merged in one pass,
+   * every insertion takes place
+  */
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    const std::vector<value_type> items{ args... };
+    std::vector<std::pair<iterator, bool>> result;
+
+    for (const auto &position : insertItems(items)) {
+      result.push_back(std::make_pair(Iterator(*this, position.first), position.second));
+    }
+
+    return result;
+  }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  std::vector<std::pair<size_type, bool>> insertItems(const std::vector<value_type> &items) {
+    return this->mergeMany(
+        items.size(), [&items](size_type i) -> const value_type& { return items[i]; }, false,
+        [](size_type, size_type) {}, [](size_type, size_type) {});
+  }
+};
+
+} // namespace s21
+
+#endif // S21_FLAT_MULTISET_H_
@@ -0,0 +1,403 @@
+#ifndef S21_FROZEN_BASE_H_
+#define S21_FROZEN_BASE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_container.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of read-only sorted storage in Eytzinger layout, base class
+// for FrozenSet and FrozenMap
+//
+// Keys are laid out like an implicit binary search tree stored breadth first:
+// the root in slot 1, children of slot k in slots 2k and 2k + 1 (slot 0 is
+// not used and stands for "no element"). A search walks down from the root
+// and, unlike a binary search over a sorted array, touches the first levels of
+// every search in the same few cache lines. Children of a slot 4 levels down
+// (16 ints) are contiguous, so they are prefetched while the current level is
+// compared. Contents are fixed at construction
+
+template <typename Key, typename Compare>
+class FrozenBase : public Container {
+protected:
+  // type overrides to make class code easy to understand (really..?)
+  using key_type = Key;
+  using const_key_reference = const Key&;
+
+  static constexpr size_type kCacheLine = 64;
+
+  Key *keys_ = nullptr; // size_ + 1 slots, slot 0 is raw memory
+  Compare comp_;
+
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  FrozenBase() {}
+
+  FrozenBase(const FrozenBase &other);
+
+  FrozenBase(FrozenBase &&other) : keys_{ other.keys_ }, comp_{ std::move(other.comp_) } {
+    size_ = other.size_;
+    other.keys_ = nullptr;
+    other.size_ = 0;
+  }
+
+  FrozenBase& operator=(FrozenBase &&other) {
+    if (this != &other) {
+      release();
+      keys_ = other.keys_;
+      comp_ = std::move(other.comp_);
+      size_ = other.size_;
+      other.keys_ = nullptr;
+      other.size_ = 0;
+    }
+
+    return *this;
+  }
+
+  ~FrozenBase() { release(); }
+
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Lays out count sorted unique elements: place(slot) is called for
+   * every slot in sorted order and must construct the next key in keys_[slot]
+   * (and whatever else the derived class keeps per slot). If place throws it
+   * must leave keys_[slot] unconstructed, the keys placed before are destroyed
+   *
+   * @note Slots are visited in order (see nextSlot), so the source is read
+   * only once and front to back
+  */
+  template <typename Place>
+  void build(size_type count, Place place);
+
+  /**
+   * @brief Slot of the first key not less than key, 0 if there is none
+  */
+  size_type lowerSlot(const_key_reference key) const {
+    return descend([&](const_key_reference stored) { return comp_(stored, key); });
+  }
+
+  /**
+   * @brief Slot of the first key greater than key, 0 if there is none
+  */
+  size_type upperSlot(const_key_reference key) const {
+    return descend([&](const_key_reference stored) { return !comp_(key, stored); });
+  }
+
+  /**
+   * @brief Slot of the key, 0 if it is not there
+  */
+  size_type findSlot(const_key_reference key) const {
+    const size_type slot = lowerSlot(key);
+
+    return slot != 0 && !comp_(key, keys_[slot]) ? slot : 0;
+  }
+
+  /**
+   * @brief Slot of the key
+   *
+   * @throws ArrayException if element with specified key is not in the container
+  */
+  size_type find(const_key_reference key) const {
+    const size_type slot = findSlot(key);
+
+    if (slot == 0) {
+      throw ArrayException("Element with specified key was not found");
+    }
+
+    return slot;
+  }
+
+  /**
+   * @brief Slot of the smallest key, 0 if the container is empty
+  */
+  size_type firstSlot() const {
+    size_type slot = size_ == 0 ? 0 : 1;
+
+    while (slot != 0 && 2 * slot <= size_) {
+      slot = 2 * slot;
+    }
+
+    return slot;
+  }
+
+  /**
+   * @brief Slot of the biggest key, 0 if the container is empty
+  */
+  size_type lastSlot() const {
+    size_type slot = size_ == 0 ? 0 : 1;
+
+    while (slot != 0 && 2 * slot + 1 <= size_) {
+      slot = 2 * slot + 1;
+    }
+
+    return slot;
+  }
+
+  /**
+   * @brief In-order successor of a slot, 0 after the biggest key
+  */
+  size_type nextSlot(size_type slot) const {
+    if (2 * slot + 1 <= size_) {
+      // leftmost slot of the right subtree
+      slot = 2 * slot + 1;
+
+      while (2 * slot <= size_) {
+        slot = 2 * slot;
+      }
+
+      return slot;
+    }
+
+    // climb while slot is a right child, then once more
+    while (slot & 1) {
+      slot >>= 1;
+    }
+
+    return slot >> 1;
+  }
+
+  /**
+   * @brief In-order predecessor of a slot, 0 before the smallest key
+  */
+  size_type prevSlot(size_type slot) const {
+    if (2 * slot <= size_) {
+      // rightmost slot of the left subtree
+      slot = 2 * slot;
+
+      while (2 * slot + 1 <= size_) {
+        slot = 2 * slot + 1;
+      }
+
+      return slot;
+    }
+
+    // climb while slot is a left child, then once more
+    while (slot != 0 && !(slot & 1)) {
+      slot >>= 1;
+    }
+
+    return slot >> 1;
+  }
+
+/* ========================================================================= */
+/*                                Iterators                                  */
+/* ========================================================================= */
+
+  /**
+   * @brief Position in the layout, walks the keys in sorted order
+  */
+  class KeyIterator {
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Key;
+    using pointer = const Key*;
+    using reference = const Key&;
+
+    KeyIterator(const FrozenBase &base, size_type slot) : base_{ &base }, slot_{ slot } {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the key pointed by the iterator
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    const_key_reference operator*() const {
+      if (slot_ == 0) {
+        throw ArrayException("Cannot dereference an unset iterator");
+      }
+
+      return base_->keys_[slot_];
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on equality. Returns true
+     * if both iterators point to the same element, false otherwise
+    */
+    bool operator==(const KeyIterator &other) const {
+      return base_ == other.base_ && slot_ == other.slot_;
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on unequality. Returns true
+     * if iterators point to different elements, false otherwise
+    */
+    bool operator!=(const KeyIterator &other) const { return !(*this == other); }
+
+  protected:
+    /**
+     * @throws ArrayException if iterator is at the end
+    */
+    void increment() {
+      if (slot_ == 0) {
+        throw ArrayException("Cannot increment an unset iterator");
+      }
+
+      slot_ = base_->nextSlot(slot_);
+    }
+
+    /**
+     * @note Decrementing the end iterator moves it to the biggest key
+     *
+     * @throws ArrayException if iterator is at the beginning
+    */
+    void decrement() {
+      const size_type slot = slot_ == 0 ? base_->lastSlot() : base_->prevSlot(slot_);
+
+      if (slot == 0) {
+        throw ArrayException("Cannot decrement an iterator at the beginning");
+      }
+
+      slot_ = slot;
+    }
+
+    const FrozenBase *base_;
+    size_type slot_;
+  };
+
+public: // methods are the part of the derived class interface
+  /**
+   * @brief Checks if the container contains an element with a specific key
+  */
+  bool contains(const_key_reference key) const { return findSlot(key) != 0; }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+  /**
+   * @brief Keys per cache line rounded down to a power of two: a slot's
+   * descendants this many times further are that many levels down and contiguous
+  */
+  static constexpr size_type prefetchStride() {
+    size_type stride = 1;
+
+    while (stride * 2 * sizeof(Key) <= kCacheLine) {
+      stride *= 2;
+    }
+
+    return stride;
+  }
+
+  /**
+   * @brief Walks from the root to a leaf, going right while before(key) holds
+   *
+   * @note The next slot is computed, not branched to, so nothing is
+   * mispredicted. At the end the path is a bit string ending with the last
+   * left turn followed by right turns: dropping those gives the answer
+  */
+  template <typename Before>
+  size_type descend(Before before) const {
+    size_type slot = 1;
+
+    while (slot <= size_) {
+      prefetch(slot * prefetchStride());
+      slot = 2 * slot + before(keys_[slot]);
+    }
+
+    return slot >> __builtin_ffsll(~static_cast<unsigned long long>(slot));
+  }
+
+  /**
+   * @brief Prefetch hint for a slot, may be past the end (hints never fault)
+  */
+  void prefetch(size_type slot) const {
+    __builtin_prefetch(reinterpret_cast<const void*>(reinterpret_cast<std::uintptr_t>(keys_) + slot * sizeof(Key)));
+  }
+
+  void allocate(size_type count) {
+    keys_ = static_cast<Key*>(::operator new((count + 1) * sizeof(Key), std::align_val_t(kCacheLine)));
+  }
+
+  void release();
+};
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename Key, typename Compare>
+FrozenBase<Key, Compare>::FrozenBase(const FrozenBase &other) : comp_{ other.comp_ } {
+  // slots are the same, no need to lay the keys out again
+  allocate(other.size_);
+
+  // size_ counts the keys copied so far, release() destroys just those on a throw
+  try {
+    for (size_type slot = 1; slot <= other.size_; ++slot) {
+      new (keys_ + slot) Key(other.keys_[slot]);
+      size_ = slot;
+    }
+  } catch (...) {
+    release();
+    throw;
+  }
+}
+
+template <typename Key, typename Compare>
+template <typename Place>
+void FrozenBase<Key, Compare>::build(size_type count, Place place) {
+  release();
+  allocate(count);
+
+  // nextSlot needs the final size, slots are constructed in order anyway
+  size_ = count;
+
+  size_type slot = firstSlot();
+
+  try {
+    for (; slot != 0; slot = nextSlot(slot)) {
+      place(slot);
+    }
+  } catch (...) {
+    // only the slots visited before the failed one hold keys
+    for (size_type built = firstSlot(); built != slot; built = nextSlot(built)) {
+      keys_[built].~Key();
+    }
+
+    ::operator delete(keys_, std::align_val_t(kCacheLine));
+    keys_ = nullptr;
+    size_ = 0;
+    throw;
+  }
+}
+
+
+/* ========================================================================= */
+/*                 Private Helper Methods Implementation                     */
+/* ========================================================================= */
+
+template <typename Key, typename Compare>
+void FrozenBase<Key, Compare>::release() {
+  if (keys_ == nullptr) {
+    return;
+  }
+
+  if (!std::is_trivially_destructible<Key>::value) {
+    for (size_type slot = 1; slot <= size_; ++slot) {
+      keys_[slot].~Key();
+    }
+  }
+
+  ::operator delete(keys_, std::align_val_t(kCacheLine));
+  keys_ = nullptr;
+  size_ = 0;
+}
+
+} // namespace s21
+
+#endif // S21_FROZEN_BASE_H_
@@ -0,0 +1,336 @@
+#ifndef S21_FROZEN_MAP_H_
+#define S21_FROZEN_MAP_H_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "s21_frozen_base.h"
+#include "s21_map.h"
+#include "s21_vector.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a read-only map in Eytzinger layout (see FrozenBase)
+//
+// Keys are searched in their own array, values sit in a parallel one and are
+// only touched once the key is found. Interface follows Map: dereferenced
+// iterator gives the mapped value, key() gives the key. Keys are fixed at
+// construction, mapped values may be changed
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class FrozenMap : public FrozenBase<Key, Compare> {
+public:
+  // forward declarations for iterators
+  class Iterator;
+  class ConstIterator;
+
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using key_type = Key;
+  using mapped_type = T;
+
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  using Base = FrozenBase<Key, Compare>;
+  using size_type = typename Base::size_type;
+
+  Vector<T> values_; // values_[slot] is mapped by keys_[slot]
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor, creates an empty map
+  */
+  FrozenMap() : Base() {}
+
+  /**
+   * @brief Initializer list constructor, pairs are sorted by key
+   *
+   * @note The first of the pairs with equal keys is kept
+  */
+  FrozenMap(std::initializer_list<value_type> const &items) {
+    std::vector<std::pair<key_type, mapped_type>> sorted(items.begin(), items.end());
+
+    std::stable_sort(sorted.begin(), sorted.end(), [this](const auto &a, const auto &b) {
+      return this->comp_(a.first, b.first);
+    });
+    sorted.erase(std::unique(sorted.begin(), sorted.end(), [this](const auto &a, const auto &b) {
+      return !this->comp_(a.first, b.first) && !this->comp_(b.first, a.first);
+    }), sorted.end());
+
+    auto it = sorted.cbegin();
+    buildFrom(sorted.size(), [&it]() { return *(it++); });
+  }
+
+  /**
+   * @brief Creates the map from a map with the same comparator, its keys are
+   * already sorted
+  */
+  explicit FrozenMap(const Map<key_type, mapped_type, Compare> &map) {
+    typename Map<key_type, mapped_type, Compare>::ConstIterator it(map);
+
+    // node of the tree gives both the key and the value
+    buildFrom(map.size(), [&it]() {
+      std::pair<const key_type&, const mapped_type&> item(it.getNode()->key, *it);
+      ++it;
+
+      return item;
+    });
+  }
+
+  /**
+   * @brief Copy constructor
+   *
+   * @note Performs deep copy of passed parameter other
+  */
+  FrozenMap(const FrozenMap &other) : Base(other), values_{ other.values_ } {}
+
+  /**
+   * @brief Move constructor
+  */
+  FrozenMap(FrozenMap &&other) : Base(std::move(other)), values_{ std::move(other.values_) } {}
+
+  /**
+   * @brief Assignment operator overload for moving an object
+  */
+  FrozenMap& operator=(FrozenMap &&other) {
+    if (this != &other) {
+      Base::operator=(std::move(other));
+      values_ = std::move(other.values_);
+    }
+
+    return *this;
+  }
+
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Access a specified element with bounds checking
+   *
+   * @throws ArrayException if key is not in the map
+  */
+  T& at(const Key &key) {
+    return values_[Base::find(key)];
+  }
+
+  const T& at(const Key &key) const {
+    return values_[Base::find(key)];
+  }
+
+  /**
+   * @brief Finds an element with a specific key in the map
+   *
+   * @throws ArrayException if element with specified key is not in the map
+  */
+  iterator find(const Key &key) {
+    return Iterator(*this, Base::find(key));
+  }
+
+  const_iterator find(const Key &key) const {
+    return ConstIterator(*this, Base::find(key));
+  }
+
+  /**
+   * @brief Returns an iterator to the first element with a key not less than the given one
+  */
+  iterator lower_bound(const Key &key) {
+    return Iterator(*this, this->lowerSlot(key));
+  }
+
+  const_iterator lower_bound(const Key &key) const {
+    return ConstIterator(*this, this->lowerSlot(key));
+  }
+
+  /**
+   * @brief Returns an iterator to the first element with a key greater than the given one
+  */
+  iterator upper_bound(const Key &key) {
+    return Iterator(*this, this->upperSlot(key));
+  }
+
+  const_iterator upper_bound(const Key &key) const {
+    return ConstIterator(*this, this->upperSlot(key));
+  }
+
+  /**
+   * @brief Swaps the contents of two maps
+  */
+  void swap(FrozenMap &other) {
+    if (this == &other) {
+      return;
+    }
+
+    FrozenMap temp{ std::move(*this) };
+
+    *this = std::move(other);
+    other = std::move(temp);
+  }
+
+
+/* ========================================================================= */
+/*                                Iterators                                  */
+/* ========================================================================= */
+
+  class ConstIterator : public Base::KeyIterator {
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the smallest key
+    */
+    ConstIterator(const FrozenMap &map) : Base::KeyIterator(map, map.firstSlot()) {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given slot
+    */
+    ConstIterator(const FrozenMap &map, size_type slot) : Base::KeyIterator(map, slot) {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the mapped value
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    const mapped_type& operator*() const {
+      key(); // bounds check
+
+      return static_cast<const FrozenMap*>(this->base_)->values_[this->slot_];
+    }
+
+    /**
+     * @brief Returns the key of the element pointed by the iterator
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    const key_type& key() const { return Base::KeyIterator::operator*(); }
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    ConstIterator& operator++() {
+      this->increment();
+
+      return *this;
+    }
+
+    /**
+     * @brief Decrement operator. Moves the iterator to the previous element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the beginning
+    */
+    ConstIterator& operator--() {
+      this->decrement();
+
+      return *this;
+    }
+  };
+
+  // mutable iterator is made only from a mutable map (see FlatMap)
+  class Iterator : public ConstIterator {
+  private:
+    FrozenMap *map_;
+
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the smallest key
+    */
+    Iterator(FrozenMap &map) : ConstIterator(map), map_{ &map } {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given slot
+    */
+    Iterator(FrozenMap &map, size_type slot) : ConstIterator(map, slot), map_{ &map } {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the mapped value
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    mapped_type& operator*() const {
+      this->key(); // bounds check
+
+      return map_->values_[this->slot_];
+    }
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    Iterator& operator++() {
+      this->increment();
+
+      return *this;
+    }
+
+    /**
+     * @brief Decrement operator. Moves the iterator to the previous element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the beginning
+    */
+    Iterator& operator--() {
+      this->decrement();
+
+      return *this;
+    }
+  };
+
+  iterator begin() {
+    return Iterator(*this);
+  }
+
+  iterator end() {
+    return Iterator(*this, 0);
+  }
+
+  const_iterator cbegin() const {
+    return ConstIterator(*this);
+  }
+
+  const_iterator cend() const {
+    return ConstIterator(*this, 0);
+  }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Lays out count pairs sorted by key, next() gives the next of them
+  */
+  template <typename Next>
+  void buildFrom(size_type count, Next next) {
+    Vector<T> values(count + 1);
+
+    this->build(count, [&](size_type slot) {
+      const auto pair = next();
+
+      // the value first: a throwing copy leaves the slot without a key
+      values[slot] = pair.second;
+      new (this->keys_ + slot) key_type(pair.first);
+    });
+
+    values_ = std::move(values);
+  }
+};
+
+} // namespace s21
+
+#endif // S21_FROZEN_MAP_H_
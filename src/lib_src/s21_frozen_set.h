@@ -0,0 +1,238 @@
+#ifndef S21_FROZEN_SET_H_
+#define S21_FROZEN_SET_H_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "s21_frozen_base.h"
+#include "s21_set.h"
+#include "s21_vector.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a read-only set in Eytzinger layout (see FrozenBase)
+//
+// Built once from a Set, a Vector or a range, then only searched. Iterators
+// walk the elements in sorted order
+
+template <typename T, typename Compare = std::less<T>>
+class FrozenSet : public FrozenBase<T, Compare> {
+public:
+  // forward declarations for iterators
+  class Iterator;
+  class ConstIterator;
+
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  using Base = FrozenBase<T, Compare>;
+  using size_type = typename Base::size_type;
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor, creates an empty set
+  */
+  FrozenSet() : Base() {}
+
+  /**
+   * @brief Creates the set from the elements of [first, last), they are
+   * sorted and duplicates are dropped
+  */
+  template <typename InputIt>
+  FrozenSet(InputIt first, InputIt last) {
+    std::vector<value_type> items(first, last);
+
+    std::sort(items.begin(), items.end(), this->comp_);
+    items.erase(std::unique(items.begin(), items.end(), [this](const_reference a, const_reference b) {
+      return !this->comp_(a, b) && !this->comp_(b, a);
+    }), items.end());
+
+    buildFrom(items.begin(), items.size());
+  }
+
+  /**
+   * @brief Initializer list constructor
+  */
+  FrozenSet(std::initializer_list<value_type> const &items) : FrozenSet(items.begin(), items.end()) {}
+
+  /**
+   * @brief Creates the set from the elements of a vector
+  */
+  explicit FrozenSet(const Vector<value_type> &vector)
+      : FrozenSet(vector.data(), vector.data() + vector.size()) {}
+
+  /**
+   * @brief Creates the set from a set with the same comparator, its elements
+   * are already sorted
+   *
+   * @note Elements of a set ordered by another comparator are sorted again by
+   * the vector or range constructor
+  */
+  explicit FrozenSet(const Set<value_type, Compare> &set) {
+    buildFrom(typename Set<value_type, Compare>::Iterator(set), set.size());
+  }
+
+  /**
+   * @brief Copy constructor
+   *
+   * @note Performs deep copy of passed parameter other
+  */
+  FrozenSet(const FrozenSet &other) : Base(other) {}
+
+  /**
+   * @brief Move constructor
+  */
+  FrozenSet(FrozenSet &&other) : Base(std::move(other)) {}
+
+  /**
+   * @brief Assignment operator overload for moving an object
+  */
+  FrozenSet& operator=(FrozenSet &&other) {
+    Base::operator=(std::move(other));
+
+    return *this;
+  }
+
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Finds an element with a specific key in the set
+   *
+   * @throws ArrayException if element with specified key is not in the set
+  */
+  iterator find(const_reference value) const {
+    return Iterator(*this, Base::find(value));
+  }
+
+  /**
+   * @brief Returns an iterator to the first element not less than the given key
+  */
+  iterator lower_bound(const_reference key) const {
+    return Iterator(*this, this->lowerSlot(key));
+  }
+
+  /**
+   * @brief Returns an iterator to the first element greater than the given key
+  */
+  iterator upper_bound(const_reference key) const {
+    return Iterator(*this, this->upperSlot(key));
+  }
+
+  /**
+   * @brief Swaps the contents of two sets
+  */
+  void swap(FrozenSet &other) {
+    if (this == &other) {
+      return;
+    }
+
+    FrozenSet temp{ std::move(*this) };
+
+    *this = std::move(other);
+    other = std::move(temp);
+  }
+
+/* ========================================================================= */
+/*                                Iterators                                  */
+/* ========================================================================= */
+
+  class Iterator : public Base::KeyIterator {
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the smallest element
+    */
+    Iterator(const FrozenSet &set) : Base::KeyIterator(set, set.firstSlot()) {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given slot
+    */
+    Iterator(const FrozenSet &set, size_type slot) : Base::KeyIterator(set, slot) {}
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    Iterator& operator++() {
+      this->increment();
+
+      return *this;
+    }
+
+    /**
+     * @brief Decrement operator. Moves the iterator to the previous element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the beginning
+    */
+    Iterator& operator--() {
+      this->decrement();
+
+      return *this;
+    }
+  };
+
+  class ConstIterator : public Iterator {
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the smallest element
+    */
+    ConstIterator(const FrozenSet &set) : Iterator(set) {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given slot
+    */
+    ConstIterator(const FrozenSet &set, size_type slot) : Iterator(set, slot) {}
+  };
+
+  iterator begin() const {
+    return Iterator(*this);
+  }
+
+  iterator end() const {
+    return Iterator(*this, 0);
+  }
+
+  const_iterator cbegin() const {
+    return ConstIterator(*this);
+  }
+
+  const_iterator cend() const {
+    return ConstIterator(*this, 0);
+  }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  template <typename InputIt>
+  void buildFrom(InputIt first, size_type count) {
+    this->build(count, [this, &first](size_type slot) {
+      new (this->keys_ + slot) value_type(*first);
+      ++first;
+    });
+  }
+};
+
+} // namespace s21
+
+#endif // S21_FROZEN_SET_H_
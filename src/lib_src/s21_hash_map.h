@@ -0,0 +1,309 @@
+#ifndef S21_HASH_MAP_H_
+#define S21_HASH_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "s21_hash_table.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of an unordered map collection (open addressing, see HashTable)
+//
+// Interface follows Map: dereferenced iterator gives the mapped value,
+// operator-> gives the whole key-value pair. Iterators are invalidated by
+// inserts that grow the table, elements do not move on erase
+
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class HashMap : public HashTable<Key, std::pair<const Key, T>, Hash, KeyEqual> {
+public:
+  // forward declarations for iterators
+  class Iterator;
+  class ConstIterator;
+
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using key_type = Key;
+  using mapped_type = T;
+
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  using Table = HashTable<Key, value_type, Hash, KeyEqual>;
+  using size_type = typename Table::size_type;
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor, creates an empty map
+  */
+  HashMap() : Table() {}
+
+  /**
+   * @brief Initializer list constructor, creates the map initizialized using std::initializer_list
+  */
+  HashMap(std::initializer_list<value_type> const &items) {
+    this->reserve(items.size());
+
+    for (const_reference item : items) {
+      insert(item);
+    }
+  }
+
+  /**
+   * @brief Copy constructor
+   *
+   * @note Performs deep copy of passed parameter other
+  */
+  HashMap(const HashMap &other) : Table(other) {}
+
+  /**
+   * @brief Move constructor
+  */
+  HashMap(HashMap &&other) : Table(std::move(other)) {}
+
+  /**
+   * @brief Assignment operator overload for moving an object
+  */
+  HashMap& operator=(HashMap &&other) {
+    Table::operator=(std::move(other));
+
+    return *this;
+  }
+
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Access a specified element with bounds checking
+   *
+   * @throws ArrayException if key is not in the map
+  */
+  T& at(const Key &key) {
+    return this->slots_[Table::find(key)].second;
+  }
+
+  const T& at(const Key &key) const {
+    return this->slots_[Table::find(key)].second;
+  }
+
+  /**
+   * @brief Access or insert specified element
+   *
+   * @note Inserts a value initialized element if the key is not in the map
+  */
+  T& operator[](const Key &key) {
+    auto result = Table::emplace(key, std::piecewise_construct,
+                                 std::forward_as_tuple(key), std::forward_as_tuple());
+
+    return this->slots_[result.first].second;
+  }
+
+  /**
+   * @brief Inserts a key-value pair and returns an iterator to where the element
+   * is in the container and bool denoting whether the insertion took place
+  */
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+
+  /**
+   * @brief Inserts a value by key and returns an iterator to where the element
+   * is in the container and bool denoting whether the insertion took place
+  */
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    auto result = Table::emplace(key, key, obj);
+
+    return std::make_pair(Iterator(*this, result.first), result.second);
+  }
+
+  /**
+   * @brief Inserts an element or assigns to the current element if the key already exists
+   *
+   * @return iterator to the element and true if it was inserted, false if assigned
+  */
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    auto result = Table::emplace(key, key, obj);
+
+    if (!result.second) {
+      this->slots_[result.first].second = obj;
+    }
+
+    return std::make_pair(Iterator(*this, result.first), result.second);
+  }
+
+  /**
+   * @brief Erases an element at pos in the map
+  */
+  bool erase(iterator pos) {
+    if (pos.index_ >= this->capacity_ || !this->isFull(pos.index_)) {
+      return false;
+    }
+
+    Table::eraseAt(pos.index_);
+
+    return true;
+  }
+
+
+/* ========================================================================= */
+/*                                Iterators                                  */
+/* ========================================================================= */
+
+  class Iterator {
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the first element
+    */
+    Iterator(const HashMap &map) : map_{ &map }, index_{ map.nextFull(0) } {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given slot
+    */
+    Iterator(const HashMap &map, size_type index) : map_{ &map }, index_{ index } {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the mapped value
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    mapped_type& operator*() const { return slot().second; }
+
+    /**
+     * @brief Member access operator. Gives the key-value pair
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    value_type* operator->() const { return &slot(); }
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    Iterator& operator++() {
+      if (index_ >= map_->capacity_) {
+        throw ArrayException("Cannot increment an unset iterator");
+      }
+
+      index_ = map_->nextFull(index_ + 1);
+
+      return *this;
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on equality. Returns true
+     * if both iterators point to the same element, false otherwise
+    */
+    bool operator==(const Iterator &other) const {
+      return map_ == other.map_ && index_ == other.index_;
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on unequality. Returns true
+     * if iterators point to different elements, false otherwise
+    */
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+  protected:
+    value_type& slot() const {
+      if (index_ >= map_->capacity_) {
+        throw ArrayException("Cannot dereference an unset iterator");
+      }
+
+      return map_->slots_[index_];
+    }
+
+  private:
+    friend class HashMap;
+
+    const HashMap *map_;
+    size_type index_;
+  };
+
+  class ConstIterator : public Iterator {
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the first element
+    */
+    ConstIterator(const HashMap &map) : Iterator(map) {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given slot
+    */
+    ConstIterator(const HashMap &map, size_type index) : Iterator(map, index) {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the mapped value
+    */
+    const mapped_type& operator*() const { return this->Iterator::operator*(); }
+
+    /**
+     * @brief Member access operator. Gives the key-value pair
+    */
+    const value_type* operator->() const { return this->Iterator::operator->(); }
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+    */
+    ConstIterator& operator++() {
+      this->Iterator::operator++();
+
+      return *this;
+    }
+  };
+
+  iterator begin() {
+    return Iterator(*this);
+  }
+
+  iterator end() {
+    return Iterator(*this, this->capacity_);
+  }
+
+  const_iterator cbegin() const {
+    return ConstIterator(*this);
+  }
+
+  const_iterator cend() const {
+    return ConstIterator(*this, this->capacity_);
+  }
+
+
+  /* ========================================================================= */
+  /*                        Bonus Methods (insert_many)                        */
+  /* ========================================================================= */
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> result;
+
+    // iterators of earlier elements must survive the later inserts
+    this->reserve(this->size_ + sizeof...(Args));
+
+    for (auto arg : {args...}) {
+      result.push_back(insert(arg.first, arg.second));
+    }
+
+    return result;
+  }
+
+};
+
+} // namespace s21
+
+#endif // S21_HASH_MAP_H_
@@ -0,0 +1,244 @@
+#ifndef S21_HASH_SET_H_
+#define S21_HASH_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "s21_hash_table.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of an unordered set collection (open addressing, see HashTable)
+//
+// Iterators are invalidated by inserts that grow the table, elements do not
+// move on erase
+
+template <typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+class HashSet : public HashTable<T, T, Hash, KeyEqual> {
+public:
+  // forward declarations for iterators
+  class Iterator;
+  class ConstIterator;
+
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  using Table = HashTable<T, T, Hash, KeyEqual>;
+  using size_type = typename Table::size_type;
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor, creates an empty set
+  */
+  HashSet() : Table() {}
+
+  /**
+   * @brief Initializer list constructor, creates the set initizialized using std::initializer_list
+  */
+  HashSet(std::initializer_list<value_type> const &items) {
+    this->reserve(items.size());
+
+    for (const_reference item : items) {
+      insert(item);
+    }
+  }
+
+  /**
+   * @brief Copy constructor
+   *
+   * @note Performs deep copy of passed parameter other
+  */
+  HashSet(const HashSet &other) : Table(other) {}
+
+  /**
+   * @brief Move constructor
+  */
+  HashSet(HashSet &&other) : Table(std::move(other)) {}
+
+  /**
+   * @brief Assignment operator overload for moving an object
+  */
+  HashSet& operator=(HashSet &&other) {
+    Table::operator=(std::move(other));
+
+    return *this;
+  }
+
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Inserts a value and returns an iterator to where the element is in
+   * the container and bool denoting whether the insertion took place
+  */
+  std::pair<iterator, bool> insert(const value_type &value) {
+    auto result = Table::emplace(value, value);
+
+    return std::make_pair(Iterator(*this, result.first), result.second);
+  }
+
+  /**
+   * @brief Erases an element at pos in the set
+  */
+  bool erase(iterator pos) {
+    if (pos.index_ >= this->capacity_ || !this->isFull(pos.index_)) {
+      return false;
+    }
+
+    Table::eraseAt(pos.index_);
+
+    return true;
+  }
+
+  /**
+   * @brief Finds an element with a specific key in the set
+   *
+   * @throws ArrayException if element with specified key is not in the set
+  */
+  Iterator find(const T &value) {
+    return Iterator(*this, Table::find(value));
+  }
+
+/* ========================================================================= */
+/*                                Iterators                                  */
+/* ========================================================================= */
+
+  class Iterator {
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the first element
+    */
+    Iterator(const HashSet &set) : set_{ &set }, index_{ set.nextFull(0) } {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given slot
+    */
+    Iterator(const HashSet &set, size_type index) : set_{ &set }, index_{ index } {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the value pointed by the iterator
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    const_reference operator*() const {
+      if (index_ >= set_->capacity_) {
+        throw ArrayException("Cannot dereference an unset iterator");
+      }
+
+      return set_->slots_[index_];
+    }
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    Iterator& operator++() {
+      if (index_ >= set_->capacity_) {
+        throw ArrayException("Cannot increment an unset iterator");
+      }
+
+      index_ = set_->nextFull(index_ + 1);
+
+      return *this;
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on equality. Returns true
+     * if both iterators point to the same element, false otherwise
+    */
+    bool operator==(const Iterator &other) const {
+      return set_ == other.set_ && index_ == other.index_;
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on unequality. Returns true
+     * if iterators point to different elements, false otherwise
+    */
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+  private:
+    friend class HashSet;
+
+    const HashSet *set_;
+    size_type index_;
+  };
+
+  class ConstIterator : public Iterator {
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the first element
+    */
+    ConstIterator(const HashSet &set) : Iterator(set) {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given slot
+    */
+    ConstIterator(const HashSet &set, size_type index) : Iterator(set, index) {}
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+    */
+    ConstIterator& operator++() {
+      this->Iterator::operator++();
+
+      return *this;
+    }
+  };
+
+  iterator begin() {
+    return Iterator(*this);
+  }
+
+  iterator end() {
+    return Iterator(*this, this->capacity_);
+  }
+
+  const_iterator cbegin() const {
+    return ConstIterator(*this);
+  }
+
+  const_iterator cend() const {
+    return ConstIterator(*this, this->capacity_);
+  }
+
+
+  /* ========================================================================= */
+  /*                        Bonus Methods (insert_many)                        */
+  /* ========================================================================= */
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> result;
+
+    // iterators of earlier elements must survive the later inserts
+    this->reserve(this->size_ + sizeof...(Args));
+
+    for (auto arg : {args...}) {
+      result.push_back(insert(arg));
+    }
+
+    return result;
+  }
+
+};
+
+} // namespace s21
+
+#endif // S21_HASH_SET_H_
@@ -0,0 +1,622 @@
+#ifndef S21_HASH_TABLE_H_
+#define S21_HASH_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "s21_container.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of an open addressing hash table (Swiss table layout), base
+// class for HashMap and HashSet
+//
+// Elements live in one flat array of slots, next to it there is an array of
+// control bytes, one per slot. A control byte is either a marker (empty or
+// deleted) or 7 bits of the element hash. Slots are split into groups of
+// kGroupWidth, lookup probes whole groups: control bytes of a group are
+// matched against the 7 hash bits first and only matching slots compare keys,
+// so most probes never touch the slots array. A group with an empty slot ends
+// the probe sequence.
+//
+// Table is kept at most 7/8 full (deleted slots count as full until the next
+// rehash), capacity is a power of two and a multiple of kGroupWidth.
+//
+// Groups are matched with SSE2 when the target has it (every x86-64 does) and
+// with 64-bit word arithmetic elsewhere, S21_HASH_PORTABLE forces the latter
+
+/**
+ * @brief Values of the control bytes
+*/
+struct HashControl {
+  static constexpr size_t kGroupWidth = 16;
+
+  // full slots keep the lower 7 bits of the hash (0..127), markers are negative
+  static constexpr int8_t kEmpty = -128;
+  static constexpr int8_t kDeleted = -2;
+};
+
+/**
+ * @brief Control bytes of one group, every match returns a bit mask with
+ * bit i set for the i-th slot of the group
+ *
+ * @note Bytes are matched eight at a time inside 64-bit words, then the top
+ * bit of every byte is gathered into the mask with one multiplication
+*/
+struct HashGroupPortable {
+  static constexpr uint64_t kLsbs = 0x0101010101010101ull;
+  static constexpr uint64_t kMsbs = 0x8080808080808080ull;
+
+  uint64_t low_;
+  uint64_t high_;
+
+  explicit HashGroupPortable(const int8_t *ctrl) {
+    std::memcpy(&low_, ctrl, sizeof(low_));
+    std::memcpy(&high_, ctrl + sizeof(low_), sizeof(high_));
+  }
+
+  /**
+   * @brief Slots with the given 7 hash bits
+   *
+   * @note May report a false match right after a real one, keys are
+   * compared anyway
+  */
+  uint32_t match(int8_t h2) const {
+    const uint64_t pattern = kLsbs * static_cast<uint8_t>(h2);
+    return gather(zeroBytes(low_ ^ pattern), zeroBytes(high_ ^ pattern));
+  }
+
+  // empty is the only marker with the second lowest bit clear
+  uint32_t matchEmpty() const {
+    return gather(low_ & (~low_ << 6) & kMsbs, high_ & (~high_ << 6) & kMsbs);
+  }
+
+  uint32_t matchEmptyOrDeleted() const { return gather(low_ & kMsbs, high_ & kMsbs); }
+
+  static uint64_t zeroBytes(uint64_t x) { return (x - kLsbs) & ~x & kMsbs; }
+
+  static uint32_t gather(uint64_t low, uint64_t high) {
+    return static_cast<uint32_t>(((low >> 7) * 0x0102040810204080ull) >> 56) |
+           static_cast<uint32_t>(((high >> 7) * 0x0102040810204080ull) >> 56) << 8;
+  }
+};
+
+#if defined(__SSE2__)
+
+/**
+ * @brief The same group matched with SSE2: one compare for all 16 bytes and
+ * movemask to turn the result into a bit mask
+ *
+ * @note Control bytes must be aligned to 16 bytes
+*/
+struct HashGroupSse2 {
+  __m128i ctrl_;
+
+  explicit HashGroupSse2(const int8_t *ctrl)
+      : ctrl_{ _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl)) } {}
+
+  uint32_t match(int8_t h2) const {
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+  }
+
+  uint32_t matchEmpty() const { return match(HashControl::kEmpty); }
+
+  // markers are the only bytes with the sign bit set
+  uint32_t matchEmptyOrDeleted() const {
+    return static_cast<uint32_t>(_mm_movemask_epi8(ctrl_));
+  }
+};
+
+#endif
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+class HashTable : public Container {
+protected:
+  // type overrides to make class code easy to understand (really..?)
+  using key_type = Key;
+  using slot_type = Slot;
+  using const_key_reference = const Key&;
+
+  static constexpr size_type kGroupWidth = HashControl::kGroupWidth;
+  static constexpr int8_t kEmpty = HashControl::kEmpty;
+  static constexpr int8_t kDeleted = HashControl::kDeleted;
+
+  // SSE2 where the compiler targets it, the portable one otherwise
+#if defined(__SSE2__) && !defined(S21_HASH_PORTABLE)
+  using Group = HashGroupSse2;
+#else
+  using Group = HashGroupPortable;
+#endif
+
+  int8_t *ctrl_ = nullptr;
+  Slot *slots_ = nullptr;
+  size_type capacity_ = 0;
+  size_type growth_left_ = 0; // inserts into empty slots left before a rehash
+
+  Hash hash_;
+  KeyEqual equal_;
+
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor, creates an empty table
+   *
+   * @note Nothing is allocated until the first insert
+  */
+  HashTable() {}
+
+  /**
+   * @brief Copy constructor
+   *
+   * @note Performs deep copy, the copy is sized for other's elements only
+  */
+  HashTable(const HashTable &other);
+
+  /**
+   * @brief Move constructor
+  */
+  HashTable(HashTable &&other) { stealResources(std::move(other)); }
+
+  /**
+   * @brief Destructor
+  */
+  ~HashTable() { deleteTable(); }
+
+  /**
+   * @brief Assignment operator overload for moving an object
+  */
+  HashTable& operator=(HashTable &&other);
+
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Finds a slot with the key or makes a new one constructed from args
+   *
+   * @return index of the slot and true if the slot is new
+  */
+  template <typename... Args>
+  std::pair<size_type, bool> emplace(const_key_reference key, Args&&... args);
+
+  /**
+   * @brief Returns index of the slot with the key or capacity_ if there is none
+  */
+  size_type findIndex(const_key_reference key) const;
+
+  /**
+   * @brief Returns index of the slot with the key
+   *
+   * @throws ArrayException if key is not in the table
+  */
+  size_type find(const_key_reference key) const;
+
+  /**
+   * @brief Removes element in the given slot
+  */
+  void eraseAt(size_type index);
+
+  /**
+   * @brief Returns index of the first full slot not before index (capacity_ if none)
+  */
+  size_type nextFull(size_type index) const;
+
+  bool isFull(size_type index) const { return ctrl_[index] >= 0; }
+
+  static const Key& keyOf(const Key &key) { return key; }
+
+  template <typename T>
+  static const Key& keyOf(const std::pair<const Key, T> &pair) { return pair.first; }
+
+public: // methods are the part of the derived class interface
+  /**
+   * @brief Removes all elements, memory is kept for the next inserts
+  */
+  void clear();
+
+  /**
+   * @brief Removes an element with the key
+   *
+   * @return true if the element was removed, false if it was not in the table
+  */
+  bool remove(const_key_reference key);
+
+  /**
+   * @brief Checks if the container contains an element with a specific key
+  */
+  bool contains(const_key_reference key) const { return findIndex(key) != capacity_; }
+
+  /**
+   * @brief Swaps the contents of two tables
+  */
+  void swap(HashTable &other);
+
+  /**
+   * @brief Copies elements of other that are not in this table yet
+  */
+  void merge(const HashTable &other);
+
+  /**
+   * @brief Makes room for count elements without a rehash
+  */
+  void reserve(size_type count);
+
+  /**
+   * @brief Returns the number of slots
+  */
+  size_type bucket_count() const { return capacity_; }
+
+  /**
+   * @brief Returns the share of full slots
+  */
+  double load_factor() const {
+    return capacity_ == 0 ? 0.0 : static_cast<double>(size_) / capacity_;
+  }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Spreads bits of the user hash, std::hash of integers is identity
+   * and would leave the 7 control bits of small keys all zeroes
+  */
+  size_type hashOf(const_key_reference key) const {
+    uint64_t h = static_cast<uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_type>(h ^ (h >> 32));
+  }
+
+  static int8_t h2Of(size_type hash) { return static_cast<int8_t>(hash & 0x7F); }
+
+  size_type groupMask() const { return capacity_ / kGroupWidth - 1; }
+
+  size_type findIndex(const_key_reference key, size_type hash) const;
+
+  /**
+   * @brief Returns the first empty or deleted slot on the probe sequence of hash
+  */
+  size_type findInsertSlot(size_type hash) const;
+
+  /**
+   * @brief Constructs a slot from args on the probe sequence of hash, there
+   * must be room for it
+  */
+  template <typename... Args>
+  size_type constructAt(size_type hash, Args&&... args);
+
+  /**
+   * @brief Moves all elements into new arrays of the given capacity
+  */
+  void rehash(size_type capacity);
+
+  /**
+   * @brief Allocates arrays for capacity slots (all empty)
+  */
+  void allocate(size_type capacity);
+
+  /**
+   * @brief Destroys elements and frees memory, table is left empty
+  */
+  void deleteTable();
+
+  void stealResources(HashTable &&other);
+
+  static size_type maxLoad(size_type capacity) { return capacity - capacity / 8; }
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+HashTable<Key, Slot, Hash, KeyEqual>::HashTable(const HashTable &other)
+    : hash_{ other.hash_ }, equal_{ other.equal_ } {
+  reserve(other.size_);
+  merge(other);
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+HashTable<Key, Slot, Hash, KeyEqual>& HashTable<Key, Slot, Hash, KeyEqual>::operator=(HashTable &&other) {
+  if (this == &other) {
+    return *this;
+  }
+
+  deleteTable();
+  stealResources(std::move(other));
+
+  return *this;
+}
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<size_t, bool> HashTable<Key, Slot, Hash, KeyEqual>::emplace(const_key_reference key, Args&&... args) {
+  const size_type hash = hashOf(key);
+  const size_type found = findIndex(key, hash);
+
+  if (found != capacity_) {
+    return std::make_pair(found, false);
+  }
+
+  if (growth_left_ == 0) {
+    // key and args may refer to elements of the table (map[map.begin()->first]),
+    // the slot is built before rehash moves them and frees their memory
+    slot_type slot(std::forward<Args>(args)...);
+
+    // mostly deleted slots: clean them up in place instead of growing
+    rehash(size_ < maxLoad(capacity_) / 2 ? capacity_ : capacity_ * 2);
+
+    return std::make_pair(constructAt(hash, std::move(slot)), true);
+  }
+
+  return std::make_pair(constructAt(hash, std::forward<Args>(args)...), true);
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+template <typename... Args>
+size_t HashTable<Key, Slot, Hash, KeyEqual>::constructAt(size_type hash, Args&&... args) {
+  const size_type index = findInsertSlot(hash);
+  new (slots_ + index) slot_type(std::forward<Args>(args)...);
+
+  growth_left_ -= ctrl_[index] == kEmpty;
+  ctrl_[index] = h2Of(hash);
+  ++size_;
+
+  return index;
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Slot, Hash, KeyEqual>::findIndex(const_key_reference key) const {
+  return capacity_ == 0 ? capacity_ : findIndex(key, hashOf(key));
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Slot, Hash, KeyEqual>::find(const_key_reference key) const {
+  const size_type index = findIndex(key);
+
+  if (index == capacity_) {
+    throw ArrayException("Element with specified key was not found");
+  }
+
+  return index;
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+void HashTable<Key, Slot, Hash, KeyEqual>::eraseAt(size_type index) {
+  slots_[index].~slot_type();
+  --size_;
+
+  // probe sequences stop at a group with an empty slot, so if the group already
+  // has one nobody could have walked past this slot and it may become empty too
+  const size_type group = index & ~(kGroupWidth - 1);
+  if (Group(ctrl_ + group).matchEmpty() != 0) {
+    ctrl_[index] = kEmpty;
+    ++growth_left_;
+  } else {
+    ctrl_[index] = kDeleted;
+  }
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Slot, Hash, KeyEqual>::nextFull(size_type index) const {
+  while (index < capacity_ && !isFull(index)) {
+    ++index;
+  }
+
+  return index;
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+void HashTable<Key, Slot, Hash, KeyEqual>::clear() {
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (isFull(i)) {
+      slots_[i].~slot_type();
+    }
+  }
+
+  if (capacity_ != 0) {
+    std::memset(ctrl_, kEmpty, capacity_);
+  }
+
+  size_ = 0;
+  growth_left_ = maxLoad(capacity_);
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+bool HashTable<Key, Slot, Hash, KeyEqual>::remove(const_key_reference key) {
+  const size_type index = findIndex(key);
+
+  if (index == capacity_) {
+    return false;
+  }
+
+  eraseAt(index);
+
+  return true;
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+void HashTable<Key, Slot, Hash, KeyEqual>::swap(HashTable &other) {
+  if (this == &other) {
+    return;
+  }
+
+  HashTable temp{ std::move(*this) };
+
+  *this = std::move(other);
+  other = std::move(temp);
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+void HashTable<Key, Slot, Hash, KeyEqual>::merge(const HashTable &other) {
+  for (size_type i = other.nextFull(0); i < other.capacity_; i = other.nextFull(i + 1)) {
+    emplace(keyOf(other.slots_[i]), other.slots_[i]);
+  }
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+void HashTable<Key, Slot, Hash, KeyEqual>::reserve(size_type count) {
+  size_type capacity = kGroupWidth;
+
+  while (maxLoad(capacity) < count) {
+    capacity *= 2;
+  }
+
+  if (capacity > capacity_) {
+    rehash(capacity);
+  } else if (count > size_ && growth_left_ < count - size_) {
+    rehash(capacity_); // enough slots, but deleted ones have to be cleaned up
+  }
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Slot, Hash, KeyEqual>::findIndex(const_key_reference key, size_type hash) const {
+  if (capacity_ == 0) {
+    return capacity_;
+  }
+
+  const int8_t h2 = h2Of(hash);
+  const size_type mask = groupMask();
+  size_type group = (hash >> 7) & mask;
+
+  // triangular steps visit every group when the number of groups is a power of two
+  for (size_type step = 1;; ++step) {
+    const size_type first = group * kGroupWidth;
+    Group control(ctrl_ + first);
+
+    for (uint32_t match = control.match(h2); match != 0; match &= match - 1) {
+      const size_type index = first + __builtin_ctz(match);
+
+      if (equal_(keyOf(slots_[index]), key)) {
+        return index;
+      }
+    }
+
+    if (control.matchEmpty() != 0) {
+      return capacity_;
+    }
+
+    group = (group + step) & mask;
+  }
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Slot, Hash, KeyEqual>::findInsertSlot(size_type hash) const {
+  const size_type mask = groupMask();
+  size_type group = (hash >> 7) & mask;
+
+  for (size_type step = 1;; ++step) {
+    const size_type first = group * kGroupWidth;
+    const uint32_t free = Group(ctrl_ + first).matchEmptyOrDeleted();
+
+    if (free != 0) {
+      return first + __builtin_ctz(free);
+    }
+
+    group = (group + step) & mask;
+  }
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+void HashTable<Key, Slot, Hash, KeyEqual>::rehash(size_type capacity) {
+  if (capacity == 0) {
+    capacity = kGroupWidth;
+  }
+
+  int8_t *old_ctrl = ctrl_;
+  Slot *old_slots = slots_;
+  const size_type old_capacity = capacity_;
+
+  allocate(capacity);
+
+  for (size_type i = 0; i < old_capacity; ++i) {
+    if (old_ctrl[i] >= 0) {
+      const size_type hash = hashOf(keyOf(old_slots[i]));
+      const size_type index = findInsertSlot(hash);
+
+      new (slots_ + index) slot_type(std::move(old_slots[i]));
+      old_slots[i].~slot_type();
+      ctrl_[index] = h2Of(hash);
+    }
+  }
+
+  growth_left_ = maxLoad(capacity_) - size_;
+
+  if (old_capacity != 0) {
+    ::operator delete(old_slots, std::align_val_t(alignof(Slot)));
+    ::operator delete(old_ctrl, std::align_val_t(kGroupWidth));
+  }
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+void HashTable<Key, Slot, Hash, KeyEqual>::allocate(size_type capacity) {
+  slots_ = static_cast<Slot*>(::operator new(capacity * sizeof(Slot), std::align_val_t(alignof(Slot))));
+  ctrl_ = static_cast<int8_t*>(::operator new(capacity, std::align_val_t(kGroupWidth)));
+  std::memset(ctrl_, kEmpty, capacity);
+
+  capacity_ = capacity;
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+void HashTable<Key, Slot, Hash, KeyEqual>::deleteTable() {
+  if (capacity_ == 0) {
+    return;
+  }
+
+  clear();
+
+  ::operator delete(slots_, std::align_val_t(alignof(Slot)));
+  ::operator delete(ctrl_, std::align_val_t(kGroupWidth));
+
+  slots_ = nullptr;
+  ctrl_ = nullptr;
+  capacity_ = 0;
+  growth_left_ = 0;
+}
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+void HashTable<Key, Slot, Hash, KeyEqual>::stealResources(HashTable &&other) {
+  hash_ = std::move(other.hash_);
+  equal_ = std::move(other.equal_);
+
+  ctrl_ = other.ctrl_;
+  slots_ = other.slots_;
+  capacity_ = other.capacity_;
+  growth_left_ = other.growth_left_;
+  size_ = other.size_;
+
+  other.ctrl_ = nullptr;
+  other.slots_ = nullptr;
+  other.capacity_ = 0;
+  other.growth_left_ = 0;
+  other.size_ = 0;
+}
+
+} // namespace s21
+
+#endif // S21_HASH_TABLE_H_
@@ -0,0 +1,501 @@
+#ifndef S21_INTRUSIVE_LIST_H_
+#define S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <type_traits>
+
+#include "s21_container.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+/**
+ * @brief Link embedded into objects that are stored in an IntrusiveList
+ *
+ * @note An object can be linked into as many intrusive lists at the same time
+ * as it has hooks. Hook is not copied together with an object (copy of a linked
+ * object is not linked anywhere)
+*/
+struct IntrusiveListHook {
+  IntrusiveListHook *next_ = nullptr;
+  IntrusiveListHook *prev_ = nullptr;
+
+  IntrusiveListHook() {}
+  IntrusiveListHook(const IntrusiveListHook&) {}
+  IntrusiveListHook& operator=(const IntrusiveListHook&) { return *this; }
+
+  /**
+   * @brief Returns true if the hook is linked into some list
+  */
+  bool linked() const { return next_ != nullptr; }
+};
+
+// Implementation of an intrusive list collection
+// Uses the same circular design with a barrier element (nil) as List, but
+// nodes are not allocated by the list: links live inside the stored objects
+// themselves. List never owns the objects, it only links and unlinks them
+
+template <typename T, IntrusiveListHook T::*Hook>
+class IntrusiveList : public Container {
+public:
+  // forward declarations for iterators
+  class Iterator;
+  class ConstIterator;
+
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  using Node = IntrusiveListHook;
+
+  Node nil; // barrier node, list is cycled through it just like List
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor. Creates an empty list
+  */
+  IntrusiveList() {
+    nil.next_ = &nil;
+    nil.prev_ = &nil;
+  }
+
+  /**
+   * @note List cannot be copied: a single hook cannot be linked into two lists
+  */
+  IntrusiveList(const IntrusiveList &other) = delete;
+
+  /**
+   * @brief Move constructor. Relinks all objects of the given list into this one
+  */
+  IntrusiveList(IntrusiveList &&other) : IntrusiveList() {
+    stealResources(std::move(other));
+  }
+
+  /**
+   * @brief Destructor. Unlinks all objects (objects themselves are not touched)
+  */
+  ~IntrusiveList() { clear(); }
+
+  /**
+   * @brief Assignment operator overload for moving an object
+  */
+  IntrusiveList& operator=(IntrusiveList &&other) {
+    if (this != &other) {
+      clear();
+      stealResources(std::move(other));
+    }
+
+    return *this;
+  }
+
+/* ========================================================================= */
+/*                    Methods for modifying an IntrusiveList                 */
+/* ========================================================================= */
+
+  /**
+   * @brief Unlinks all objects from the list
+   *
+   * @note Hooks are reset so that objects could be linked into another list
+  */
+  void clear();
+
+  /**
+   * @brief Access the first element of the list
+   *
+   * @throws ArrayException if list is empty
+  */
+  reference front();
+
+  /**
+   * @brief Access the last element of the list
+   *
+   * @throws ArrayException if list is empty
+  */
+  reference back();
+
+  /**
+   * @brief Links an object to the end of the list
+   *
+   * @throws ArrayException if the object is already linked into a list
+  */
+  void pushBack(reference item) { insertNode(&nil, item); }
+
+  /**
+   * @brief Links an object to the head of the list
+   *
+   * @throws ArrayException if the object is already linked into a list
+  */
+  void pushFront(reference item) { insertNode(nil.next_, item); }
+
+  /**
+   * @brief Unlinks the last object of the list
+   *
+   * @note If list is empty it will do nothing
+  */
+  void popBack();
+
+  /**
+   * @brief Unlinks the first object of the list
+   *
+   * @note If list is empty it will do nothing
+  */
+  void popFront();
+
+  /**
+   * @brief Links an object directly before pos and returns the iterator
+   * that points to the new element
+  */
+  Iterator insert(Iterator pos, reference item);
+
+  /**
+   * @brief Unlinks an object at pos. Moves pos to the next element
+  */
+  bool erase(Iterator& pos);
+
+  /**
+   * @brief Unlinks the given object from the list in O(1)
+   *
+   * @note Object must be linked into this list (this is not checked, finding
+   * the owner list would cost O(n)). Returns false if object is not linked at all
+  */
+  bool remove(reference item);
+
+  /**
+   * @brief Transfers all elements from other directly before pos in O(1)
+   *
+   * @note Other list is left empty after the operation
+  */
+  void splice(Iterator pos, IntrusiveList& other);
+
+  /**
+   * @brief Swaps the contents of two lists
+  */
+  void swap(IntrusiveList &other);
+
+  /**
+   * @brief Returns true if the object is linked into some list
+  */
+  static bool isLinked(const_reference item) { return (item.*Hook).linked(); }
+
+/* ========================================================================= */
+/*                                Iterators                                  */
+/* ========================================================================= */
+
+  class Iterator {
+  protected:
+    Node *current_;
+
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the given node
+    */
+    explicit Iterator(Node *node) : current_{ node } {}
+
+    Node* getNode() const { return current_; }
+
+    bool operator==(const Iterator& other) const { return current_ == other.current_; }
+
+    bool operator!=(const Iterator& other) const { return current_ != other.current_; }
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the linked object
+     *
+     * @note Dereferencing end() is not checked, there is no object behind
+     * the barrier node
+    */
+    reference operator*() const { return *IntrusiveList::owner(current_); }
+
+    T* operator->() const { return IntrusiveList::owner(current_); }
+
+    /**
+     * @note No check is performed because list is circular
+    */
+    Iterator& operator++() {
+      current_ = current_->next_;
+      return *this;
+    }
+
+    /**
+     * @note No check is performed because list is circular
+    */
+    Iterator& operator--() {
+      current_ = current_->prev_;
+      return *this;
+    }
+  };
+
+  class ConstIterator : public Iterator {
+  public:
+    explicit ConstIterator(Node *node) : Iterator(node) {}
+
+    ConstIterator(const Iterator& other) : Iterator(other) {}
+
+    const_reference operator*() const { return this->Iterator::operator*(); }
+
+    const T* operator->() const { return this->Iterator::operator->(); }
+
+    ConstIterator& operator++() {
+      this->Iterator::operator++();
+      return *this;
+    }
+
+    ConstIterator& operator--() {
+      this->Iterator::operator--();
+      return *this;
+    }
+  };
+
+  Iterator begin() { return Iterator(nil.next_); }
+
+  Iterator end() { return Iterator(&nil); }
+
+  ConstIterator cbegin() const { return ConstIterator(nil.next_); }
+
+  ConstIterator cend() const { return ConstIterator(const_cast<Node*>(&nil)); }
+
+  /**
+   * @brief Returns an iterator pointing at the given linked object in O(1)
+  */
+  static Iterator iteratorTo(reference item) { return Iterator(&(item.*Hook)); }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Returns an object the hook is embedded into
+   *
+   * @note Offset of the hook is computed once from the pointer to member
+   * (the same thing as container_of macro in C)
+  */
+  static T* owner(Node *hook) {
+    return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - hookOffset());
+  }
+
+  static std::ptrdiff_t hookOffset() {
+    static const std::ptrdiff_t offset = [] {
+      alignas(T) static char storage[sizeof(T)];
+      T *probe = reinterpret_cast<T*>(storage);
+      return reinterpret_cast<char*>(&(probe->*Hook)) - storage;
+    }();
+
+    return offset;
+  }
+
+  /**
+   * @brief Links the hook of item before the node p
+  */
+  void insertNode(Node *p, reference item);
+
+  /**
+   * @brief Unlinks the given node from the list and resets its links
+  */
+  void removeNode(Node *node);
+
+  /**
+   * @brief Takes all nodes from the other list
+   *
+   * @note This list should be empty. Used by move constructor and move assignment
+  */
+  void stealResources(IntrusiveList &&other);
+};
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::clear() {
+  Node *p = nil.next_;
+
+  while (p != &nil) {
+    Node *temp = p;
+    p = p->next_;
+
+    temp->next_ = nullptr;
+    temp->prev_ = nullptr;
+  }
+
+  nil.next_ = &nil;
+  nil.prev_ = &nil;
+
+  this->size_ = 0;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+T& IntrusiveList<T, Hook>::front() {
+  if (this->size() == 0) {
+    throw ArrayException("List is empty");
+  }
+
+  return *owner(nil.next_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+T& IntrusiveList<T, Hook>::back() {
+  if (this->size() == 0) {
+    throw ArrayException("List is empty");
+  }
+
+  return *owner(nil.prev_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::popBack() {
+  if (this->size() == 0) {
+    return;
+  }
+
+  removeNode(nil.prev_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::popFront() {
+  if (this->size() == 0) {
+    return;
+  }
+
+  removeNode(nil.next_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::Iterator
+    IntrusiveList<T, Hook>::insert(Iterator pos, reference item) {
+  insertNode(pos.getNode(), item);
+
+  return iteratorTo(item);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+bool IntrusiveList<T, Hook>::erase(Iterator& pos) {
+  if (pos.getNode() == &nil) {
+    return false;
+  }
+
+  Iterator next = pos;
+  ++next;
+
+  removeNode(pos.getNode());
+
+  pos = next;
+
+  return true;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+bool IntrusiveList<T, Hook>::remove(reference item) {
+  if (!isLinked(item)) {
+    return false;
+  }
+
+  removeNode(&(item.*Hook));
+
+  return true;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::splice(Iterator pos, IntrusiveList& other) {
+  if (this == &other || other.size() == 0) {
+    return;
+  }
+
+  Node *p = pos.getNode();
+  Node *first = other.nil.next_;
+  Node *last = other.nil.prev_;
+
+  // [first, last] chain is inserted between p->prev_ and p
+  first->prev_ = p->prev_;
+  last->next_ = p;
+  p->prev_->next_ = first;
+  p->prev_ = last;
+
+  this->size_ += other.size_;
+
+  other.nil.next_ = &other.nil;
+  other.nil.prev_ = &other.nil;
+  other.size_ = 0;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::swap(IntrusiveList &other) {
+  if (this == &other) {
+    return;
+  }
+
+  IntrusiveList temp(std::move(*this));
+
+  *this = std::move(other);
+
+  other = std::move(temp);
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::insertNode(Node *p, reference item) {
+  Node *node = &(item.*Hook);
+
+  if (node->linked()) {
+    throw ArrayException("Object is already linked into a list");
+  }
+
+  // node is inserted between p->prev_ and p
+  node->next_ = p;
+  node->prev_ = p->prev_;
+
+  p->prev_->next_ = node;
+  p->prev_ = node;
+
+  ++(this->size_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::removeNode(Node *node) {
+  node->prev_->next_ = node->next_;
+  node->next_->prev_ = node->prev_;
+
+  node->next_ = nullptr;
+  node->prev_ = nullptr;
+
+  --(this->size_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::stealResources(IntrusiveList &&other) {
+  if (other.size() == 0) {
+    return;
+  }
+
+  nil.next_ = other.nil.next_;
+  nil.prev_ = other.nil.prev_;
+
+  nil.next_->prev_ = &nil;
+  nil.prev_->next_ = &nil;
+
+  this->size_ = other.size_;
+
+  other.nil.next_ = &other.nil;
+  other.nil.prev_ = &other.nil;
+
+  other.size_ = 0;
+}
+
+} // namespace s21
+
+#endif  // S21_INTRUSIVE_LIST_H_
@@ -3,8 +3,14 @@
 
 #include <cstddef>
 #include <iostream>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "s21_container.h"
+#include "s21_node_pool.h"
 #include "../array_exception.h"
 
 namespace s21 {
@@ -37,12 +43,31 @@ private:
     Node() {}
     Node(const value_type &data, Node *next = nullptr, Node *prev = nullptr) : 
       data_{ data }, next_{ next }, prev_{ prev } {}
+
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args&&... args) :
+      data_(std::forward<Args>(args)...), next_{ nullptr }, prev_{ nullptr } {}
   };
 
+  // nodes are allocated in blocks of the pool (see NodePool), removed nodes
+  // are reused by the next insertions. When the list gets empty only its
+  // biggest block is kept, clear() gives back all of them and shrink_to_fit()
+  // every block with no element in it. Single insertions refill the free list
+  // with a block that grows together with the list, but never more than 64
+  // nodes at once
+  NodePool<Node, &Node::next_, 64> pool_;
+
   Node nil; // nil node is used to simplify the code (barrier node)
   // we could cycle our list through it and simplify some basic list operations
   // to a major degree without sacrificing much of memory usage or efficiency
 
+  // last node accessed by index (and its index). Index lookups start from the
+  // closest of head, tail and this cursor, so sequential get(i) loops are linear.
+  // Cursor is "unset" while it points to nil. Mutable because get() is const,
+  // so even const index access is not safe to do from several threads at once
+  mutable Node *cursor_ = &nil;
+  mutable size_type cursor_index_ = 0;
+
 public:
 
 /* ========================================================================= */
@@ -71,6 +96,18 @@ public:
   */
   List(std::initializer_list<value_type> const& items);
 
+  /**
+   * @brief Range constructor, creates a list with the elements of [first, last)
+   * 
+   * @note All nodes of a multi-pass range are allocated with a single
+   * allocation, see insert
+  */
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  List(InputIt first, InputIt last) : List() {
+    insert(end(), first, last);
+  }
+
   /**
    * @brief Copy constructor. Creates a copy of the given list
    * 
@@ -102,9 +139,19 @@ public:
 
   /**
    * @brief Removes all elements from the container
+   * 
+   * @note Also frees all memory held by the list (including unused nodes)
   */
   void clear();
 
+  /**
+   * @brief Frees the blocks of nodes whose nodes are all unused
+   * 
+   * @note Nodes of a block that still holds an element stay in the free list,
+   * elements are never moved to other nodes (iterators stay valid)
+  */
+  void shrink_to_fit();
+
   /**
    * @brief Inserts an element at the given index
    * 
@@ -178,6 +225,28 @@ public:
   */
   Iterator insert(Iterator pos, const_reference value);
 
+  /**
+   * @brief Inserts elements of [first, last) directly before pos
+   * 
+   * @return Iterator to the first inserted element (pos if range is empty)
+   * 
+   * @note Nodes for a multi-pass range are allocated at once (the range is
+   * counted first) and linked into the list in a single pass. Elements of a
+   * single-pass range are inserted one by one. Either way a throwing copy
+   * leaves the list unchanged
+  */
+  template <typename InputIt>
+  Iterator insert(Iterator pos, InputIt first, InputIt last);
+
+  /**
+   * @brief Appends all elements of a range (anything with begin() and end())
+   * to the end of the list
+  */
+  template <typename Range>
+  void append_range(Range &&range) {
+    insert(end(), range.begin(), range.end());
+  }
+
   /**
    * @brief Erases an element at pos in the list. Moves pos to the next element
    * in the list
@@ -215,6 +284,15 @@ public:
   */
   void popFront();
 
+  /**
+   * @brief Moves up to n first elements into out (in list order) and removes
+   * them in a single pass, returns how many were moved
+   *
+   * @note Nodes are not freed, they go to the free list for the next insertions
+  */
+  template <typename OutputIt>
+  size_type popFront(OutputIt out, size_type n);
+
   /**
    * @brief Swaps the contents of two lists
    * 
@@ -247,8 +325,41 @@ public:
 
   /**
    * @brief Removes consecutive duplicate elements
+   * 
+   * @return Number of removed elements
   */
-  void unique();
+  size_type unique() { return unique([](const_reference a, const_reference b) { return a == b; }); }
+
+  /**
+   * @brief Removes consecutive elements for which pred(kept, current) is true
+   * 
+   * @note Every element is compared with the last element that was kept, not
+   * with the previous (possibly removed) one. Single pass over the list
+   * 
+   * @return Number of removed elements
+  */
+  template <typename BinaryPred>
+  size_type unique(BinaryPred pred);
+
+  /**
+   * @brief Removes all elements for which pred(element) is true
+   * 
+   * @note Single pass over the list, every node is touched exactly once
+   * 
+   * @return Number of removed elements
+  */
+  template <typename UnaryPred>
+  size_type remove_if(UnaryPred pred);
+
+  /**
+   * @brief Removes all elements equal to the given value
+   * 
+   * @note Unlike remove, which stops at the first match, goes through the whole list.
+   * Value may be an element of the list itself, its node is removed last
+   * 
+   * @return Number of removed elements
+  */
+  size_type remove_all(const_reference value);
 
   /**
    * @brief Sorts the elements
@@ -550,27 +661,12 @@ public:
 /**
  * @brief Inserts new elements into the container directly before pos
  * 
- * @note Case for non-zero variadic arguments. Calls itself recursively extracting
- * a single argument on each call
+ * @note All elements are inserted with a single block allocation, every one
+ * is constructed right in its node from the forwarded argument
 */
 template <typename... Args>
-Iterator& insert_many(Iterator& pos, const_reference head, const Args&... tail) {
-  // insert a single element extracted from the front of the variadic template
-  insertNode(pos.getNode(), head);
-  // pass the tail of the variadic template to insert_many again
-  insert_many(pos, tail...);
-
-  return pos;
-}
-
-/**
- * @brief Insert many base case (no arguments in the variadic template)
- * 
- * @note If insert_many is called with no arguments, this version will be called.
- * It also will be called at the end of recursive calls of insert_many
-*/
-Iterator& insert_many(Iterator& pos) { 
-  // like do nothing?
+Iterator& insert_many(Iterator& pos, Args&&... args) {
+  emplaceMany(pos.getNode(), false, std::forward<Args>(args)...);
 
   return pos;
 }
@@ -579,14 +675,8 @@ Iterator& insert_many(Iterator& pos) {
  * @brief Appends new elements to the end of the container
 */
 template <typename... Args>
-void insert_many_back(const_reference head, Args&&... tail) {
-  pushBack(head);
-
-  insert_many_back(tail...);
-}
-
-void insert_many_back() {
-  return;
+void insert_many_back(Args&&... args) {
+  emplaceMany(&nil, false, std::forward<Args>(args)...);
 }
 
 /**
@@ -596,14 +686,8 @@ void insert_many_back() {
  * Maybe I should fix this, but I don't know how and this is not that important
 */
 template <typename... Args>
-void insert_many_front(const_reference head, Args&&... tail) {
-  pushFront(head);
-
-  insert_many_front(tail...);
-}
-
-void insert_many_front() {
-  return;
+void insert_many_front(Args&&... args) {
+  emplaceMany(nil.next_, true, std::forward<Args>(args)...);
 }
 
 /* ========================================================================= */
@@ -638,6 +722,51 @@ private:
   */
   void insertNode(Node *p, const_reference value);
 
+  /**
+   * @brief Takes n raw nodes (free ones first, a single block for the rest),
+   * constructs them with construct(raw_node) and links all of them before the given node
+   * 
+   * @return The first inserted node (p if n is zero)
+   * 
+   * @note If construction throws, already constructed nodes are destroyed
+   * and all taken nodes go to the free list, the list itself is not changed
+  */
+  template <typename Constructor>
+  Node* insertNodes(Node *p, size_type n, Constructor construct);
+
+  /**
+   * @brief Constructs a node from every argument (in reverse order if asked)
+   * and links all of them before the given node with insertNodes
+  */
+  template <typename... Args>
+  void emplaceMany(Node *p, bool reversed, Args&&... args) {
+    auto refs = std::forward_as_tuple(std::forward<Args>(args)...);
+    size_type index = 0;
+
+    insertNodes(p, sizeof...(Args), [&](Node *raw) {
+      const size_type arg = reversed ? sizeof...(Args) - 1 - index : index;
+
+      emplaceNth(raw, arg, refs, std::index_sequence_for<Args...>());
+      ++index;
+    });
+  }
+
+  /**
+   * @brief Constructs a node in raw from the n-th of the forwarded arguments
+  */
+  template <typename Refs, size_t... I>
+  static void emplaceNth(Node *raw, size_type n, Refs &refs, std::index_sequence<I...>) {
+    (void)((n == I && (new (raw) Node(std::in_place, std::get<I>(std::move(refs))), true)) || ...);
+  }
+
+  /**
+   * @brief Destroys the value of a node and puts it into the free list
+  */
+  void releaseNode(Node *node) {
+    node->~Node();
+    pool_.release(node);
+  }
+
   /**
    * @brief Takes resources from the other list and trasnfers it to the current list
    * 
@@ -645,6 +774,25 @@ private:
   */
   void stealResources(List<value_type> &&other);
 
+  /**
+   * @brief Forgets the cached index cursor
+   * 
+   * @note Called on every structural change, because we do not know whether
+   * the change happened before or after the cursor
+  */
+  void resetCursor() const {
+    cursor_ = const_cast<Node*>(&nil);
+    cursor_index_ = 0;
+  }
+
+  /**
+   * @brief Remembers the node at the given index as a new cursor
+  */
+  void setCursor(Node *node, size_type index) const {
+    cursor_ = node;
+    cursor_index_ = index;
+  }
+
 
 /* ========================================================================= */
 /*                           Helper Public Methods                           */
@@ -662,26 +810,23 @@ public:
 
 template <typename T>
 List<T>::List(size_type n) : List() {
-  for (size_type i = 0; i < n; ++i) {
-    this->pushBack(T()); // push default value to the list
-  }
+  // push default values to the list
+  insertNodes(&nil, n, [](Node *raw) { new (raw) Node(T()); });
 }
 
 template <typename T>
 List<T>::List(std::initializer_list<value_type> const& items) : List() {
-  for (const_reference item: items) {
-    this->pushBack(item);
-  }
+  insert(end(), items.begin(), items.end());
 }
 
 template <typename T>
 List<T>::List(const List<value_type> &other) : List() {
-  Node *p = other.nil.next_; // first node of the other list
+  const Node *p = other.nil.next_; // first node of the other list
 
-  while (p != &other.nil) {
-    this->pushBack(p->data_);
+  insertNodes(&nil, other.size(), [&p](Node *raw) {
+    new (raw) Node(p->data_);
     p = p->next_;
-  }
+  });
 }
 
 template <typename T>
@@ -715,20 +860,28 @@ List<T>& List<T>::operator=(List<T> &&other) {
 
 template <typename T>
 void List<T>::clear() {
-  if (this->size() == 0) {
-    return;
-  }
-
   Node *p = nil.next_;
 
   while (p != &nil) {
     Node *temp = p;
     p = p->next_;
 
-    delete temp;
+    temp->~Node(); // memory is freed with the whole block
   }
 
+  pool_.clear();
+
+  nil.next_ = &nil;
+  nil.prev_ = &nil;
+
   this->size_ = 0;
+
+  resetCursor();
+}
+
+template <typename T>
+void List<T>::shrink_to_fit() {
+  pool_.freeUnusedBlocks();
 }
 
 template <typename T>
@@ -743,6 +896,9 @@ bool List<T>::insert(size_type index, const_reference value) {
 
   insertNode(p, value);
 
+  // new node took the index, so it is a perfectly valid cursor
+  setCursor(p->prev_, index);
+
   return true;
 }
 
@@ -804,9 +960,15 @@ bool List<T>::removeAt(size_type index) {
   }
 
   Node *p = findNodeByIndex(index);
+  Node *next = p->next_;
 
   removeNode(p);
 
+  // the next node now sits at the removed index
+  if (next != &nil) {
+    setCursor(next, index);
+  }
+
   return true;
 }
 
@@ -837,6 +999,37 @@ typename List<T>::Iterator List<T>::insert(List<T>::Iterator pos, const_referenc
   return pos;
 }
 
+template <typename T>
+template <typename InputIt>
+typename List<T>::Iterator List<T>::insert(Iterator pos, InputIt first, InputIt last) {
+  if constexpr (!MultiPass<InputIt>::value) {
+    Node *p = pos.getNode();
+    Node *before = p->prev_;
+    size_type inserted = 0;
+
+    try {
+      for (; first != last; ++first, ++inserted) {
+        insertNode(p, *first);
+      }
+    } catch (...) {
+      for (; inserted > 0; --inserted) {
+        removeNode(p->prev_);
+      }
+
+      throw;
+    }
+
+    return Iterator(this, before->next_);
+  } else {
+    Node *inserted = insertNodes(pos.getNode(), countRange(first, last), [&first](Node *raw) {
+      new (raw) Node(*first);
+      ++first;
+    });
+
+    return Iterator(this, inserted);
+  }
+}
+
 template <typename T>
 bool List<T>::erase(List<T>::Iterator& pos) {
   if (pos.getNode() == &nil) {
@@ -881,6 +1074,48 @@ void List<T>::popFront() {
   removeNode(nil.next_);
 }
 
+template <typename T>
+template <typename OutputIt>
+typename List<T>::size_type List<T>::popFront(OutputIt out, size_type n) {
+  if (n > this->size()) {
+    n = this->size();
+  }
+
+  Node *p = nil.next_;
+  size_type moved = 0;
+
+  try {
+    for (; moved < n; ++moved) {
+      *out = std::move(p->data_);
+      ++out;
+
+      Node *next = p->next_;
+      releaseNode(p);
+      p = next;
+    }
+  } catch (...) {
+    // moved elements are gone, the rest of the list stays linked
+    nil.next_ = p;
+    p->prev_ = &nil;
+    this->size_ -= moved;
+    resetCursor();
+    throw;
+  }
+
+  // all removed nodes are unlinked with one relink of the head
+  nil.next_ = p;
+  p->prev_ = &nil;
+  this->size_ -= n;
+
+  if (this->size_ == 0) {
+    pool_.keepBiggestBlock();
+  }
+
+  resetCursor();
+
+  return n;
+}
+
 template <typename T>
 void List<T>::swap(List<T> &other) {
   if (this == &other) {
@@ -947,16 +1182,80 @@ void List<T>::reverse() {
 }
 
 template <typename T>
-void List<T>::unique() {
-  Iterator it = ++(begin()); // second element
+template <typename BinaryPred>
+typename List<T>::size_type List<T>::unique(BinaryPred pred) {
+  size_type removed = 0;
+
+  if (this->size() == 0) {
+    return removed;
+  }
+
+  Node *kept = nil.next_;
+  Node *p = kept->next_;
+
+  while (p != &nil) {
+    Node *next = p->next_;
 
-  while (it != end()) {
-    if (*it == *(--it)) { // first and second
-      erase(it); // erase first
+    if (pred(kept->data_, p->data_)) {
+      removeNode(p);
+      ++removed;
     } else {
-      ++(++it); // move to the next element (third, we were at first)
+      kept = p;
     }
+
+    p = next;
   }
+
+  return removed;
+}
+
+template <typename T>
+template <typename UnaryPred>
+typename List<T>::size_type List<T>::remove_if(UnaryPred pred) {
+  size_type removed = 0;
+  Node *p = nil.next_;
+
+  while (p != &nil) {
+    Node *next = p->next_; // removed node goes to the free list, so remember it first
+
+    if (pred(p->data_)) {
+      removeNode(p);
+      ++removed;
+    }
+
+    p = next;
+  }
+
+  return removed;
+}
+
+template <typename T>
+typename List<T>::size_type List<T>::remove_all(const_reference value) {
+  size_type removed = 0;
+  Node *p = nil.next_;
+  Node *aliased = nullptr; // node holding value itself, comparisons still read it
+
+  while (p != &nil) {
+    Node *next = p->next_;
+
+    if (p->data_ == value) {
+      if (std::addressof(p->data_) == std::addressof(value)) {
+        aliased = p;
+      } else {
+        removeNode(p);
+        ++removed;
+      }
+    }
+
+    p = next;
+  }
+
+  if (aliased != nullptr) {
+    removeNode(aliased);
+    ++removed;
+  }
+
+  return removed;
 }
 
 template <typename T>
@@ -1008,27 +1307,43 @@ typename List<T>::ConstIterator List<T>::partition(ConstIterator start, ConstIte
 
 template <typename T>
 typename List<T>::Node* List<T>::findNodeByIndex(size_type index) const {
+  if (index >= this->size()) { // insertion place after the last element
+    return const_cast<Node*>(&nil);
+  }
+
+  // we can start from the head, from the tail or from the cached cursor,
+  // pick the one with the smallest number of nodes to pass through
   Node *p = nil.next_;
-  
-  // some optimization to trawerse list in the direction with the
-  // smallest number of nodes to pass through
-  if (index <= this->size() / 2) { // insert in the forward direction
-    while (p != &nil && index > 0) { // find the insertion place
-      p = p->next_;
-      --index;
-    }
-  } else { // insert in the backward direction
+  size_type position = 0;
+  size_type distance = index;
+
+  if (this->size() - 1 - index < distance) {
     p = nil.prev_;
-    while (p != &nil && index < this->size()) { // find the insertion place
-      p = p->prev_;
-      ++index;
+    position = this->size() - 1;
+    distance = this->size() - 1 - index;
+  }
+
+  if (cursor_ != &nil) {
+    size_type cursor_distance = index > cursor_index_ ?
+      index - cursor_index_ : cursor_index_ - index;
+
+    if (cursor_distance < distance) {
+      p = cursor_;
+      position = cursor_index_;
     }
-    // because we go backward, we get to the element 
-    //one forward of the insertion point
+  }
+
+  while (position < index) {
     p = p->next_;
+    ++position;
+  }
+
+  while (position > index) {
+    p = p->prev_;
+    --position;
   }
 
-  // at the moment p is pointing to the node after insertion place
+  setCursor(p, index);
 
   return p;
 }
@@ -1049,24 +1364,112 @@ void List<T>::removeNode(Node *node) {
   node->prev_->next_ = node->next_;
   node->next_->prev_ = node->prev_;
 
-  delete node;
+  releaseNode(node);
+
+  if (--(this->size_) == 0) {
+    pool_.keepBiggestBlock();
+  }
 
-  --(this->size_);
+  resetCursor();
 }
 
 template <typename T>
 void List<T>::insertNode(Node *p, const_reference value) {
+  Node *raw = pool_.acquire(this->size());
+
+  try {
+    new (raw) Node(value);
+  } catch (...) {
+    pool_.release(raw);
+    throw;
+  }
+
   // new_node is inerted between p_prev_ and p
-  Node *new_node = new Node(value, p, p->prev_);
+  Node *new_node = raw;
+  new_node->next_ = p;
+  new_node->prev_ = p->prev_;
 
   p->prev_->next_ = new_node;
   p->prev_ = new_node;
 
   ++(this->size_);
+
+  resetCursor();
+}
+
+template <typename T>
+template <typename Constructor>
+typename List<T>::Node* List<T>::insertNodes(Node *p, size_type n, Constructor construct) {
+  if (n == 0) {
+    return p;
+  }
+
+  Node *raw = pool_.take(n);
+  Node *first = nullptr;
+  Node *last = nullptr;
+  Node *node = nullptr;
+  size_type constructed = 0;
+
+  try {
+    for (; constructed < n; ++constructed) {
+      node = raw;
+      raw = raw->next_;
+
+      construct(node);
+
+      // link the nodes with each other, constructor does not keep the links
+      node->prev_ = last;
+      if (last == nullptr) {
+        first = node;
+      } else {
+        last->next_ = node;
+      }
+      last = node;
+    }
+  } catch (...) {
+    for (size_type i = 0; i < constructed; ++i) {
+      Node *next = first->next_;
+      releaseNode(first);
+      first = next;
+    }
+
+    // the node that failed to construct and the ones not reached yet
+    node->next_ = raw;
+    while (node != nullptr) {
+      Node *next = node->next_;
+      pool_.release(node);
+      node = next;
+    }
+
+    throw;
+  }
+
+  // and then link the whole chain into the list at once
+  first->prev_ = p->prev_;
+  last->next_ = p;
+  p->prev_->next_ = first;
+  p->prev_ = last;
+
+  this->size_ += n;
+
+  resetCursor();
+
+  return first;
 }
 
 template <typename T>
 void List<T>::stealResources(List<T> &&other) {
+  // blocks go together with the nodes (even unused ones)
+  pool_ = std::move(other.pool_);
+
+  if (other.size() == 0) { // nothing to steal, nil of the other list must not leak here
+    nil.next_ = &nil;
+    nil.prev_ = &nil;
+    this->size_ = 0;
+    resetCursor();
+    return;
+  }
+
   // steal resources from the other list
   nil.next_ = other.nil.next_;
   nil.prev_ = other.nil.prev_;
@@ -1081,6 +1484,24 @@ void List<T>::stealResources(List<T> &&other) {
   other.nil.prev_ = &other.nil;
 
   other.size_ = 0;
+
+  resetCursor();
+  other.resetCursor();
+}
+
+
+/* ========================================================================= */
+/*                             Free Functions                                */
+/* ========================================================================= */
+
+/**
+ * @brief Erases all elements of the list satisfying pred
+ * 
+ * @return Number of erased elements
+*/
+template <typename T, typename UnaryPred>
+size_t erase_if(List<T> &list, UnaryPred pred) {
+  return list.remove_if(pred);
 }
 
 
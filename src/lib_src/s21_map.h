@@ -1,6 +1,7 @@
 #ifndef S21_MAP_H_
 #define S21_MAP_H_
 
+#include <functional>
 #include <vector>
 #include <utility>
 
@@ -11,9 +12,13 @@
 namespace s21 {
 
 // Implementation of a map collections
+//
+// With a transparent Compare (e.g. Map<std::string, T, std::less<>>) at, find,
+// contains, count and lower_bound also take keys of other types, such as
+// std::string_view or const char*, without building a Key
 
-template <typename Key, typename T>
-class Map : public BaseTree<Key, T> {
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class Map : public BaseTree<Key, T, Compare> {
 public:
   // forward declarations for iterators
   class Iterator;
@@ -31,7 +36,9 @@ private:
   using iterator = Iterator;
   using const_iterator = ConstIterator;
 
-  using Tree = BaseTree<Key, T>;
+  using size_type = Container::size_type;
+
+  using Tree = BaseTree<Key, T, Compare>;
   using Node = typename Tree::Node;
 
 public:
@@ -46,7 +53,7 @@ public:
    * @note Does nothing because every variable initial value is
    * already map
   */
-  Map() : BaseTree<key_type, mapped_type>() {}
+  Map() : Tree() {}
 
   /**
    * @brief Initializer list constructor, creates the map initizialized using std::initializer_list
@@ -65,12 +72,12 @@ public:
    * 
    * @note Performs shallow copy of passed parameter other
   */
-  Map(const Map& other) : BaseTree<key_type, mapped_type>(other) {}
+  Map(const Map& other) : Tree(other) {}
 
   /**
    * @brief Move constructor
   */
-  Map(Map&& other) : BaseTree<key_type, mapped_type>(std::move(other)) {}
+  Map(Map&& other) : Tree(std::move(other)) {}
 
   /**
    * @brief Destructor
@@ -100,6 +107,11 @@ public:
     return Tree::find(key)->value;
   }
 
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  T& at(const K& key) {
+    return Tree::find(key)->value;
+  }
+
   /**
    * @brief Access or insert specified element
    * 
@@ -107,11 +119,7 @@ public:
    * inserts new element with specified key
   */
   T& operator[](const Key& key) {
-    try {
-      return at(key);
-    } catch (ArrayException &error) {
-      return *(insert(key, T()).first);
-    }
+    return Tree::insertUnique(key, T()).first->value;
   }
 
   /**
@@ -127,12 +135,10 @@ public:
    * is in the container and bool denoting whether the insertion took place
   */
   std::pair<iterator, bool> insert(const Key& key, const T& obj) {
-    if (!Tree::contains(key)) {
-      auto insert_result = Tree::insert(key, obj);
-      return std::make_pair(Iterator(*this, insert_result.first), insert_result.second);
-    } else {
-      return std::make_pair(Iterator(*this, Tree::find(key)), false);
-    }
+    // a single descent finds either the existing node or the place for a new one
+    auto insert_result = Tree::insertUnique(key, obj);
+
+    return std::make_pair(Iterator(*this, insert_result.first), insert_result.second);
   }
 
   /**
@@ -157,6 +163,44 @@ public:
     return Tree::remove(pos.getNode()->key);
   }
 
+  /**
+   * @brief Finds an element with a specific key in the map
+   * 
+   * @throws ArrayException if element with specified key is not in the map
+  */
+  iterator find(const Key& key) {
+    return Iterator(*this, Tree::find(key));
+  }
+
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  iterator find(const K& key) {
+    return Iterator(*this, Tree::find(key));
+  }
+
+  /**
+   * @brief Returns the number of elements with a specific key, either 0 or 1
+  */
+  size_type count(const Key& key) const {
+    return Tree::contains(key) ? 1 : 0;
+  }
+
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  size_type count(const K& key) const {
+    return Tree::contains(key) ? 1 : 0;
+  }
+
+  /**
+   * @brief Returns an iterator to the first element with a key not less than the given one
+  */
+  iterator lower_bound(const Key& key) {
+    return Iterator(*this, Tree::lowerNode(key));
+  }
+
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  iterator lower_bound(const K& key) {
+    return Iterator(*this, Tree::lowerNode(key));
+  }
+
 
 /* ========================================================================= */
 /*                                Iterators                                  */
@@ -167,12 +211,12 @@ public:
     /**
      * @brief Iterator constructor. Sets the current position to the beginning of the tree
     */
-    Iterator(const Map<key_type, mapped_type>& map) : Tree::Iterator(map) {}
+    Iterator(const Map& map) : Tree::Iterator(map) {}
 
     /**
      * @brief Iterator constructor. Sets the current position to the given node
     */
-    Iterator(const Map<key_type, mapped_type>& map, Node* node) : Tree::Iterator(map, node) {}
+    Iterator(const Map& map, Node* node) : Tree::Iterator(map, node) {}
 
     /**
      * @brief Copy constructor
@@ -251,12 +295,12 @@ public:
     /**
      * @brief Iterator constructor. Sets the current position to the beginning of the tree
     */
-    ConstIterator(const Map<key_type, mapped_type>& map) : Iterator(map) {}
+    ConstIterator(const Map& map) : Iterator(map) {}
 
     /**
      * @brief Iterator constructor. Sets the current position to the given node
     */
-    ConstIterator(const Map<key_type, mapped_type>& map, Node *node) : Iterator(map, node) {}
+    ConstIterator(const Map& map, Node *node) : Iterator(map, node) {}
 
     /**
      * @brief Copy constructor
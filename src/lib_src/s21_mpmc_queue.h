@@ -0,0 +1,427 @@
+#ifndef S21_MPMC_QUEUE_H_
+#define S21_MPMC_QUEUE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a bounded queue for many producer and many consumer threads
+// (Vyukov's ring with sequence numbers)
+//
+// Every cell of the ring keeps a sequence number that tells whose turn it is:
+// cell at position pos is free for a producer when sequence == pos and ready
+// for a consumer when sequence == pos + 1. Producers and consumers only fight
+// for their own counter with a single compare-and-swap, so they do not
+// disturb each other. Nothing is allocated after construction.
+//
+// Closing sets the top bit of the enqueue position, the same compare-and-swap
+// that takes a position checks it, so a push either gets in before the close
+// or fails.
+//
+// try_ methods never wait. Blocking push/pop spin for a while and then park
+// on a condition variable, the mutex is touched only when someone is parked
+
+template <typename T>
+class MpmcQueue { // does not inherit from Container, size is shared between threads
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using size_type = size_t;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+
+  static constexpr size_type kCacheLine = 64;
+
+  // number of failed attempts before a blocking call parks the thread
+  static constexpr int kSpinTries = 64;
+
+  struct Cell {
+    std::atomic<size_type> sequence_;
+    alignas(value_type) unsigned char storage_[sizeof(value_type)];
+
+    value_type* data() { return reinterpret_cast<value_type*>(storage_); }
+  };
+
+  // set in enqueue_pos_ once the queue is closed
+  static constexpr size_type kClosedBit = ~(~size_type{ 0 } >> 1);
+
+  alignas(kCacheLine) std::atomic<size_type> enqueue_pos_{ 0 };
+  alignas(kCacheLine) std::atomic<size_type> dequeue_pos_{ 0 };
+
+  alignas(kCacheLine) std::atomic<size_type> waiting_producers_{ 0 };
+  std::atomic<size_type> waiting_consumers_{ 0 };
+
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+
+  size_type mask_;
+  Cell *cells_;
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Creates an empty queue that can hold at least capacity elements
+   *
+   * @note Capacity is rounded up to a power of two (and at least two)
+   *
+   * @throws ArrayException if capacity is zero
+  */
+  explicit MpmcQueue(size_type capacity);
+
+  MpmcQueue(const MpmcQueue&) = delete;
+  MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+  /**
+   * @brief Destructor. Destroys elements that were not popped
+   *
+   * @note No other thread should use the queue at this point
+  */
+  ~MpmcQueue();
+
+/* ========================================================================= */
+/*                            Non-blocking Methods                           */
+/* ========================================================================= */
+
+  /**
+   * @brief Inserts an element at the end of the queue
+   *
+   * @return false if the queue is full or closed (nothing is inserted then)
+  */
+  bool try_push(const_reference value) { return tryPushAndWake(value); }
+
+  bool try_push(value_type &&value) { return tryPushAndWake(std::move(value)); }
+
+  /**
+   * @brief Moves the first element to out and removes it from the queue
+   *
+   * @return false if the queue is empty
+  */
+  bool try_pop(reference out) {
+    if (!popCell(out)) {
+      return false;
+    }
+
+    wakeOne(waiting_producers_, not_full_);
+    return true;
+  }
+
+/* ========================================================================= */
+/*                              Blocking Methods                             */
+/* ========================================================================= */
+
+  /**
+   * @brief Inserts an element, waits while the queue is full
+   *
+   * @return false if the queue is closed (before or while waiting)
+  */
+  bool push(const_reference value) { return emplace(value); }
+
+  bool push(value_type &&value) { return emplace(std::move(value)); }
+
+  /**
+   * @brief Removes the first element into out, waits while the queue is empty
+   *
+   * @note Elements pushed before close are still handed out, so consumers
+   * drain the queue completely
+   *
+   * @return false if the queue is closed and there is nothing left
+  */
+  bool pop(reference out);
+
+  /**
+   * @brief Closes the queue: pushes fail from now on and every parked
+   * thread is woken up
+  */
+  void close();
+
+  /**
+   * @brief Returns true if the queue was closed
+  */
+  bool closed() const { return (enqueue_pos_.load(std::memory_order_acquire) & kClosedBit) != 0; }
+
+/* ========================================================================= */
+/*                                Information                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Returns the number of elements
+   *
+   * @note Under concurrent modifications the value may already be outdated
+  */
+  size_type size() const;
+
+  /**
+   * @brief Returns true if the queue is empty (see the note for size)
+  */
+  bool empty() const { return size() == 0; }
+
+  /**
+   * @brief Returns the maximum number of elements the queue can hold
+  */
+  size_type capacity() const { return mask_ + 1; }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Constructs an element in a free cell, does not wake anybody
+  */
+  template <typename... Args>
+  bool pushCell(Args&&... args);
+
+  /**
+   * @brief Takes an element from a ready cell, does not wake anybody
+  */
+  bool popCell(reference out);
+
+  template <typename Arg>
+  bool tryPushAndWake(Arg &&value) {
+    if (!pushCell(std::forward<Arg>(value))) {
+      return false;
+    }
+
+    wakeOne(waiting_consumers_, not_empty_);
+    return true;
+  }
+
+  template <typename Arg>
+  bool emplace(Arg &&value);
+
+  /**
+   * @brief Wakes a parked thread if there is any
+   *
+   * @note Counter is read with seq_cst after the cell was published with
+   * seq_cst, so either the waiter sees the element or we see the waiter
+  */
+  void wakeOne(std::atomic<size_type> &waiting, std::condition_variable &condition);
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+template <typename T>
+MpmcQueue<T>::MpmcQueue(size_type capacity) {
+  if (capacity == 0) {
+    throw ArrayException("Queue capacity should be positive");
+  }
+
+  // with a single cell "free for the next round" and "ready" look the same
+  size_type rounded = 2;
+  while (rounded < capacity) {
+    rounded <<= 1;
+  }
+
+  mask_ = rounded - 1;
+  cells_ = new Cell[rounded];
+
+  for (size_type i = 0; i < rounded; ++i) {
+    cells_[i].sequence_.store(i, std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+MpmcQueue<T>::~MpmcQueue() {
+  size_type end = enqueue_pos_.load(std::memory_order_relaxed) & ~kClosedBit;
+
+  for (size_type pos = dequeue_pos_.load(std::memory_order_relaxed); pos != end; ++pos) {
+    cells_[pos & mask_].data()->~value_type();
+  }
+
+  delete[] cells_;
+}
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename T>
+bool MpmcQueue<T>::popCell(reference out) {
+  size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+  Cell *cell;
+
+  while (true) {
+    cell = &cells_[pos & mask_];
+    size_type sequence = cell->sequence_.load(std::memory_order_acquire);
+    intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+    if (diff == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false; // element for this position was not pushed yet
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed); // someone took it, catch up
+    }
+  }
+
+  out = std::move(*cell->data());
+  cell->data()->~value_type();
+
+  // cell is free for the producer of the next round
+  cell->sequence_.store(pos + mask_ + 1, std::memory_order_seq_cst);
+
+  return true;
+}
+
+template <typename T>
+bool MpmcQueue<T>::pop(reference out) {
+  for (int i = 0; i < kSpinTries; ++i) {
+    if (try_pop(out)) {
+      return true;
+    }
+
+    if (closed() && empty()) {
+      return false;
+    }
+
+    std::this_thread::yield();
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  waiting_consumers_.fetch_add(1, std::memory_order_seq_cst);
+
+  bool popped = false;
+  not_empty_.wait(lock, [&]() {
+    popped = popCell(out);
+    return popped || (closed() && empty());
+  });
+
+  waiting_consumers_.fetch_sub(1, std::memory_order_relaxed);
+  lock.unlock();
+
+  if (popped) {
+    wakeOne(waiting_producers_, not_full_);
+  }
+
+  return popped;
+}
+
+template <typename T>
+void MpmcQueue<T>::close() {
+  // pushes that took a position before are in, the rest see the bit and fail
+  enqueue_pos_.fetch_or(kClosedBit, std::memory_order_seq_cst);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  not_full_.notify_all();
+  not_empty_.notify_all();
+}
+
+template <typename T>
+typename MpmcQueue<T>::size_type MpmcQueue<T>::size() const {
+  size_type head = dequeue_pos_.load(std::memory_order_acquire);
+  size_type tail = enqueue_pos_.load(std::memory_order_acquire) & ~kClosedBit;
+
+  // positions are read one by one, head can run ahead of the tail we have seen
+  return tail > head ? tail - head : 0;
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+template <typename T>
+template <typename... Args>
+bool MpmcQueue<T>::pushCell(Args&&... args) {
+  size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Cell *cell;
+
+  while (true) {
+    // a failed compare-and-swap reloads pos, a close in between is seen here
+    if ((pos & kClosedBit) != 0) {
+      return false;
+    }
+
+    cell = &cells_[pos & mask_];
+    size_type sequence = cell->sequence_.load(std::memory_order_acquire);
+    intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false; // cell still holds an element of the previous round
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed); // someone took it, catch up
+    }
+  }
+
+  new (cell->data()) value_type(std::forward<Args>(args)...);
+
+  cell->sequence_.store(pos + 1, std::memory_order_seq_cst);
+
+  return true;
+}
+
+template <typename T>
+template <typename Arg>
+bool MpmcQueue<T>::emplace(Arg &&value) {
+  for (int i = 0; i < kSpinTries; ++i) {
+    if (closed()) {
+      return false;
+    }
+
+    if (tryPushAndWake(std::forward<Arg>(value))) {
+      return true;
+    }
+
+    std::this_thread::yield();
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  waiting_producers_.fetch_add(1, std::memory_order_seq_cst);
+
+  // value is only moved from when the push succeeds
+  bool pushed = false;
+  not_full_.wait(lock, [&]() {
+    pushed = pushCell(std::forward<Arg>(value));
+    return pushed || closed();
+  });
+
+  waiting_producers_.fetch_sub(1, std::memory_order_relaxed);
+  lock.unlock();
+
+  if (pushed) {
+    wakeOne(waiting_consumers_, not_empty_);
+  }
+
+  return pushed;
+}
+
+template <typename T>
+void MpmcQueue<T>::wakeOne(std::atomic<size_type> &waiting, std::condition_variable &condition) {
+  if (waiting.load(std::memory_order_seq_cst) == 0) {
+    return;
+  }
+
+  // taking the mutex makes sure the waiter is either before its check or
+  // already inside wait, so the notification is not lost
+  std::lock_guard<std::mutex> lock(mutex_);
+  condition.notify_one();
+}
+
+} // namespace s21
+
+#endif  // S21_MPMC_QUEUE_H_
@@ -0,0 +1,493 @@
+#ifndef S21_MULTIMAP_H_
+#define S21_MULTIMAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <vector>
+#include <utility>
+
+#include "s21_container.h"
+#include "../array_exception.h"
+#include "s21_base_tree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Implementation of a multimap collections
+//
+// Every inserted value is kept: a tree node per distinct key holds a bucket,
+// a vector of the values with this key in insertion order. Walking the values
+// of a key (equal_range, iteration) reads the bucket, the tree is only walked
+// to get from one key to the next. Dereferenced iterator gives the mapped
+// value, key() gives the key. Inserting or erasing a value of a key
+// invalidates iterators to the other values of this key
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class Multimap : public BaseTree<Key, Vector<T>, Compare> {
+public:
+  // forward declarations for iterators
+  class Iterator;
+  class ConstIterator;
+
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using key_type = Key;
+  using mapped_type = T;
+
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  using size_type = Container::size_type;
+
+  using Bucket = Vector<T>;
+  using Tree = BaseTree<Key, Bucket, Compare>;
+  using Node = typename Tree::Node;
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor, creates an empty multimap
+  */
+  Multimap() : Tree() {}
+
+  /**
+   * @brief Initializer list constructor, every pair is inserted
+  */
+  Multimap(std::initializer_list<value_type> const &items) {
+    for (const value_type &item : items) {
+      insert(item);
+    }
+  }
+
+  /**
+   * @brief Copy constructor
+   *
+   * @note Performs deep copy of passed parameter other
+  */
+  Multimap(const Multimap& other) : Tree(other) {}
+
+  /**
+   * @brief Move constructor
+  */
+  Multimap(Multimap&& other) : Tree(std::move(other)) {}
+
+  /**
+   * @brief Destructor
+  */
+  ~Multimap() { this->clear(); }
+
+  /**
+   * @brief Assignment operator overload for moving an object
+  */
+  Multimap& operator=(Multimap &&other) {
+    Tree::operator=(std::move(other));
+
+    return *this;
+  }
+
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Inserts a key-value pair, always takes place
+  */
+  iterator insert(const value_type& value) {
+    return insert(value.first, value.second);
+  }
+
+  /**
+   * @brief Inserts a value by key, always takes place
+   *
+   * @returns iterator to the inserted value, it is the last one with this key
+  */
+  iterator insert(const Key& key, const T& obj) {
+    // a new node comes counted, a value added to an existing bucket is not
+    auto insert_result = Tree::insertUnique(key, Bucket());
+    Node* node = insert_result.first;
+
+    if (!insert_result.second) {
+      ++this->size_;
+    }
+
+    node->value.push_back(obj);
+
+    return Iterator(*this, node, node->value.size() - 1);
+  }
+
+  /**
+   * @brief Erases the value at pos, other values with the same key are kept
+  */
+  bool erase(iterator pos) {
+    Node* node = pos.getNode();
+
+    if (node == nullptr) {
+      return false;
+    }
+
+    Bucket& bucket = node->value;
+
+    if (bucket.size() == 1) {
+      return Tree::remove(node->key);
+    }
+
+    for (size_type i = pos.index() + 1; i < bucket.size(); ++i) {
+      bucket[i - 1] = std::move(bucket[i]);
+    }
+
+    bucket.pop_back();
+    --this->size_;
+
+    return true;
+  }
+
+  /**
+   * @brief Removes all values with the key
+  */
+  bool remove(const Key& key) {
+    Node* node = Tree::findNode(key);
+
+    if (node == nullptr) {
+      return false;
+    }
+
+    // the node itself is uncounted by the tree
+    this->size_ -= node->value.size() - 1;
+
+    return Tree::remove(key);
+  }
+
+  /**
+   * @brief Finds the first value with a specific key in the multimap
+   *
+   * @throws ArrayException if element with specified key is not in the multimap
+  */
+  iterator find(const Key& key) {
+    return Iterator(*this, Tree::find(key));
+  }
+
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  iterator find(const K& key) {
+    return Iterator(*this, Tree::find(key));
+  }
+
+  /**
+   * @brief Returns the number of values with a specific key
+  */
+  size_type count(const Key& key) const {
+    return countOf(key);
+  }
+
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  size_type count(const K& key) const {
+    return countOf(key);
+  }
+
+  /**
+   * @brief Returns an open range [begin, end) of values with a specific key
+   *
+   * @note Range is empty if there is no such key. Its values are the bucket
+   * of a single node, they are walked without going through the tree
+  */
+  std::pair<iterator, iterator> equal_range(const Key& key) {
+    return rangeOf(key);
+  }
+
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K& key) {
+    return rangeOf(key);
+  }
+
+  /**
+   * @brief Returns an iterator to the first value with a key not less than the given one
+  */
+  iterator lower_bound(const Key& key) {
+    return Iterator(*this, Tree::lowerNode(key));
+  }
+
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  iterator lower_bound(const K& key) {
+    return Iterator(*this, Tree::lowerNode(key));
+  }
+
+  /**
+   * @brief Returns an iterator to the first value with a key greater than the given one
+  */
+  iterator upper_bound(const Key& key) {
+    return Iterator(*this, Tree::upperNode(key));
+  }
+
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  iterator upper_bound(const K& key) {
+    return Iterator(*this, Tree::upperNode(key));
+  }
+
+  /**
+   * @brief Inserts all values of other, other is left as is
+   *
+   * @note Values of a key present in both go after the values already here
+  */
+  void merge(const Multimap& other) {
+    if (this == &other) {
+      return;
+    }
+
+    for (ConstIterator it(other); it != other.cend(); ++it) {
+      insert(it.key(), *it);
+    }
+  }
+
+
+/* ========================================================================= */
+/*                                Iterators                                  */
+/* ========================================================================= */
+
+  class Iterator : public Tree::Iterator {
+  private:
+    size_type index_ = 0; // position in the bucket of the current node
+
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the beginning of the tree
+    */
+    Iterator(const Multimap& map) : Tree::Iterator(map) {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given value of the given node
+    */
+    Iterator(const Multimap& map, Node* node, size_type index = 0) : Tree::Iterator(map, node), index_(index) {}
+
+    /**
+     * @brief Copy constructor
+     *
+     * @note Necessary for passing iterators to funcitons and returning them as the result
+    */
+    Iterator(const iterator& other) : Tree::Iterator(other), index_(other.index_) {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the mapped value
+     *
+     * @throws ArrayException if current position is not set (at the end)
+    */
+    mapped_type& operator*() const {
+      return Tree::Iterator::operator*()->value[index_];
+    }
+
+    /**
+     * @brief Returns the key of the element pointed by the iterator
+     *
+     * @throws ArrayException if current position is not set (at the end)
+    */
+    const key_type& key() const {
+      return Tree::Iterator::operator*()->key;
+    }
+
+    /**
+     * @brief Position of the value among the values with the same key
+    */
+    size_type index() const {
+      return index_;
+    }
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+     *
+     * @note Goes through the tree only after the last value of a key
+     *
+     * @throws ArrayException if current position is not set (at the end)
+    */
+    Iterator& operator++() {
+      if (Tree::Iterator::current_ == nullptr) {
+        throw ArrayException("Cannot increment an unset iterator");
+      }
+
+      if (++index_ == Tree::Iterator::current_->value.size()) {
+        index_ = 0;
+        Tree::Iterator::current_ = Tree::Iterator::findSuccessor(Tree::Iterator::current_);
+      }
+
+      return *this;
+    }
+
+    /**
+     * @brief Decrement operator. Moves the iterator to the previous element (prefix version)
+     *
+     * @throws ArrayException if current position is not set (at the end)
+    */
+    Iterator& operator--() {
+      if (Tree::Iterator::current_ == nullptr) {
+        throw ArrayException("Cannot decrement an unset iterator");
+      }
+
+      if (index_ > 0) {
+        --index_;
+      } else {
+        Tree::Iterator::current_ = Tree::Iterator::findPredecessor(Tree::Iterator::current_);
+        if (Tree::Iterator::current_ != nullptr) {
+          index_ = Tree::Iterator::current_->value.size() - 1;
+        }
+      }
+
+      return *this;
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on equality. Returns true
+     * if both iterators point to the same element, false otherwise
+    */
+    bool operator==(const Iterator& other) const {
+      return this->Tree::Iterator::operator==(other) && index_ == other.index_;
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on unequality. Returns true
+     * if iterators point to different elements, false otherwise
+    */
+    bool operator!=(const Iterator& other) const {
+      return !(*this == other);
+    }
+
+    /**
+     * @brief Assignment operator. Performs a shallow copy of the given iterator
+    */
+    Iterator& operator=(const Iterator& other) {
+      Tree::Iterator::current_ = other.current_;
+      index_ = other.index_;
+
+      return *this;
+    }
+  };
+
+  class ConstIterator : public Iterator {
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the beginning of the tree
+    */
+    ConstIterator(const Multimap& map) : Iterator(map) {}
+
+    /**
+     * @brief Iterator constructor. Sets the current position to the given value of the given node
+    */
+    ConstIterator(const Multimap& map, Node *node, size_type index = 0) : Iterator(map, node, index) {}
+
+    /**
+     * @brief Copy constructor
+     *
+     * @note Necessary for passing iterators to funcitons and returning them as the result
+    */
+    ConstIterator(const ConstIterator& other) : Iterator(other) {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the mapped value
+    */
+    const mapped_type& operator*() const {
+        return this->Iterator::operator*();
+    }
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+     *
+     * @throws ArrayException if current position is not set (at the end)
+    */
+    ConstIterator& operator++() {
+        this->Iterator::operator++();
+
+        return *this;
+    }
+
+    /**
+     * @brief Decrement operator. Moves the iterator to the previous element (prefix version)
+     *
+     * @throws ArrayException if current position is not set (at the end)
+    */
+    ConstIterator& operator--() {
+        this->Iterator::operator--();
+
+        return *this;
+    }
+
+    /**
+     * @brief Assignment operator. Performs a shallow copy of the given iterator
+    */
+    ConstIterator& operator=(const ConstIterator &other) {
+      this->Iterator::operator=(other);
+
+      return *this;
+    }
+  };
+
+  iterator begin() {
+    return Iterator(*this);
+  }
+
+  iterator end() {
+    return Iterator(*this, nullptr);
+  }
+
+  const_iterator cbegin() const {
+    return ConstIterator(*this);
+  }
+
+  const_iterator cend() const {
+    return ConstIterator(*this, nullptr);
+  }
+
+
+  /* ========================================================================= */
+  /*                        Bonus Methods (insert_many)                        */
+  /* ========================================================================= */
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> result;
+
+    for (const value_type &arg : {args...}) {
+      result.push_back(std::make_pair(insert(arg), true));
+    }
+
+    return result;
+  }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  template <typename K>
+  size_type countOf(const K& key) const {
+    const Node* node = Tree::findNode(key);
+
+    return node == nullptr ? 0 : node->value.size();
+  }
+
+  /**
+   * @brief The range ends past the last value of the bucket
+  */
+  template <typename K>
+  std::pair<iterator, iterator> rangeOf(const K& key) {
+    Node* node = Tree::findNode(key);
+
+    if (node == nullptr) {
+      iterator bound = lower_bound(key);
+      return std::make_pair(bound, bound);
+    }
+
+    iterator last(*this, node, node->value.size() - 1);
+
+    return std::make_pair(Iterator(*this, node), ++last);
+  }
+};
+
+}
+
+#endif // S21_MULTIMAP_H_
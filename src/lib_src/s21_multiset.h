@@ -1,6 +1,7 @@
 #ifndef S21_MULTISET_H_
 #define S21_MULTISET_H_
 
+#include <functional>
 #include <vector>
 #include <utility>
 
@@ -11,9 +12,13 @@
 namespace s21 {
 
 // Implementation of a multiset collections
+//
+// With a transparent Compare (e.g. Multiset<std::string, std::less<>>) find,
+// contains, count, lower_bound and upper_bound also take keys of other types,
+// such as std::string_view or const char*, without building a T
 
-template <typename T>
-class Multiset : public BaseTree<T, bool> {
+template <typename T, typename Compare = std::less<T>>
+class Multiset : public BaseTree<T, bool, Compare> {
 public:
   // forward declarations for iterators
   class Iterator;
@@ -30,7 +35,7 @@ private:
 
   using size_type = Container::size_type; // what the actual $%*@
 
-  using Tree = BaseTree<T, bool>;
+  using Tree = BaseTree<T, bool, Compare>;
   using Node = typename Tree::Node;
 
 public:
@@ -45,7 +50,7 @@ public:
    * @note Does nothing because every variable initial value is
    * already multiset
   */
-  Multiset() : BaseTree<T, bool>() {}
+  Multiset() : Tree() {}
 
   /**
    * @brief Initializer list constructor, creates the multiset initizialized using std::initializer_list
@@ -64,12 +69,12 @@ public:
    * 
    * @note Performs shallow copy of passed parameter other
   */
-  Multiset(const Multiset& other) : BaseTree<T, bool>(other) {}
+  Multiset(const Multiset& other) : Tree(other) {}
 
   /**
    * @brief Move constructor
   */
-  Multiset(Multiset&& other) : BaseTree<T, bool>(std::move(other)) {}
+  Multiset(Multiset&& other) : Tree(std::move(other)) {}
 
   /**
    * @brief Destructor
@@ -121,13 +126,23 @@ public:
     return Iterator(*this, Tree::find(value));
   }
 
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  Iterator find(const K& value) {
+    return Iterator(*this, Tree::find(value));
+  }
+
   /**
    * @brief Returns the number of elements matching a specific key
    * 
    * @remark Why here it is the key and in other places it is the value. WHY?
   */
-  size_type count(const_reference key) {
-    return Tree::find(key)->count;
+  size_type count(const_reference key) const {
+    return countOf(key);
+  }
+
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  size_type count(const K& key) const {
+    return countOf(key);
   }
 
   /**
@@ -139,13 +154,9 @@ public:
   */
   std::pair<iterator, iterator> equal_range(const_reference key) {
     iterator start = find(key);
-    iterator end = start;
-
-    while (end != this->end() && *end == *start) {
-      ++end; // find next element
-    }
 
-    return std::make_pair(start, end);
+    // equal elements share a node, the next one is past all of them
+    return std::make_pair(start, upper_bound(key));
   }
 
   /**
@@ -154,13 +165,12 @@ public:
    * @note Value should be greater than or equal to key
   */
   iterator lower_bound(const_reference key) {
-    iterator it = this->begin();
-
-    while (it != this->end() && *it < key) {
-      ++it;
-    }
+    return Iterator(*this, Tree::lowerNode(key));
+  }
 
-    return it;
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  iterator lower_bound(const K& key) {
+    return Iterator(*this, Tree::lowerNode(key));
   }
 
   /**
@@ -169,13 +179,12 @@ public:
    * @brief Value should be strictly greater than key
   */
   iterator upper_bound(const_reference key) {
-    iterator it = this->begin();
-
-    while (it != this->end() && *it <= key) {
-      ++it;
-    }
+    return Iterator(*this, Tree::upperNode(key));
+  }
 
-    return it;
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  iterator upper_bound(const K& key) {
+    return Iterator(*this, Tree::upperNode(key));
   }
 
 /* ========================================================================= */
@@ -191,12 +200,12 @@ public:
     /**
      * @brief Iterator constructor. Sets the current position to the beginning of the tree
     */
-    Iterator(const Multiset<value_type>& multiset) : Tree::Iterator(multiset) {}
+    Iterator(const Multiset& multiset) : Tree::Iterator(multiset) {}
 
     /**
      * @brief Iterator constructor. Sets the current position to the given node
     */
-    Iterator(const Multiset<value_type>& multiset, Node* node) : Tree::Iterator(multiset, node) {}
+    Iterator(const Multiset& multiset, Node* node) : Tree::Iterator(multiset, node) {}
 
     /**
      * @brief Copy constructor
@@ -289,12 +298,12 @@ public:
     /**
      * @brief Iterator constructor. Sets the current position to the beginning of the tree
     */
-    ConstIterator(const Multiset<value_type>& multiset) : Iterator(multiset) {}
+    ConstIterator(const Multiset& multiset) : Iterator(multiset) {}
 
     /**
      * @brief Iterator constructor. Sets the current position to the given node
     */
-    ConstIterator(const Multiset<value_type>& multiset, Node *node) : Iterator(multiset, node) {}
+    ConstIterator(const Multiset& multiset, Node *node) : Iterator(multiset, node) {}
 
     /**
      * @brief Copy constructor
@@ -373,6 +382,22 @@ public:
 
     return result;
   }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Duplicates are kept in a single node, its count is the answer
+  */
+  template <typename K>
+  size_type countOf(const K& key) const {
+    const Node* node = Tree::findNode(key);
+
+    return node == nullptr ? 0 : node->count;
+  }
 };
 
 }
@@ -0,0 +1,326 @@
+#ifndef S21_NODE_POOL_H_
+#define S21_NODE_POOL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+
+namespace s21 {
+
+// Block allocator for the nodes of node based containers (List, TimingWheel)
+//
+// A block is a single allocation with a header followed by nodes. Nodes given
+// back are not freed, they are kept in a free list (linked through the Next
+// member of the node) and reused by the next acquisitions, bulk takes use free
+// nodes first and one block for the rest. The pool does not construct or
+// destroy anything: nodes come out and go back as raw memory.
+//
+// A block is kept while any of its nodes is in use, so a container that
+// shrank keeps the blocks of its peak size. keepBiggestBlock() (for an empty
+// container), freeUnusedBlocks() and clear() give them back
+
+template <typename Node, Node* Node::*Next, size_t MaxRefill>
+class NodePool {
+public:
+  using size_type = size_t;
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  NodePool() {}
+
+  NodePool(const NodePool &other) = delete;
+
+  NodePool& operator=(const NodePool &other) = delete;
+
+  /**
+   * @brief Move constructor, blocks go together with the nodes (even unused ones)
+  */
+  NodePool(NodePool &&other) : blocks_{ other.blocks_ }, free_{ other.free_ } {
+    other.blocks_ = nullptr;
+    other.free_ = nullptr;
+  }
+
+  /**
+   * @brief Move assignment, own blocks are freed (no node should be in use)
+  */
+  NodePool& operator=(NodePool &&other) {
+    if (this != &other) {
+      clear();
+      std::swap(blocks_, other.blocks_);
+      std::swap(free_, other.free_);
+    }
+
+    return *this;
+  }
+
+  ~NodePool() { clear(); }
+
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Returns a raw node from the free list, refills it if needed
+   *
+   * @note A refill block grows together with the container: as many nodes as
+   * are in use, but at least one and never more than MaxRefill
+  */
+  Node* acquire(size_type in_use);
+
+  /**
+   * @brief Returns a chain of n raw nodes linked through Next, taken from the
+   * free list and, if there are not enough of them, from a new block
+  */
+  Node* take(size_type n);
+
+  /**
+   * @brief Puts a raw node (already destroyed or never constructed) into the free list
+  */
+  void release(Node *node) {
+    next(node) = free_;
+    free_ = node;
+  }
+
+  /**
+   * @brief Frees all blocks, no node should be in use at this point
+  */
+  void clear();
+
+  /**
+   * @brief Frees all blocks but the biggest one, whose nodes become the free list
+   *
+   * @note For a container that got empty, so that a long-lived one does not
+   * keep the blocks of every past burst of insertions
+  */
+  void keepBiggestBlock();
+
+  /**
+   * @brief Frees the blocks whose nodes are all in the free list
+  */
+  void freeUnusedBlocks();
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+  struct alignas(Node) Block {
+    Block *next_;
+    size_type count_; // nodes in the block
+  };
+
+  Block *blocks_ = nullptr; // all blocks owned by the pool
+  Node *free_ = nullptr;    // unused nodes (linked through Next, no data inside)
+
+  static Node*& next(Node *node) { return node->*Next; }
+
+  static Node* nodesOf(Block *block) { return reinterpret_cast<Node*>(block + 1); }
+
+  /**
+   * @brief Allocates a block of n nodes and returns the first node of it
+  */
+  Node* allocateBlock(size_type n);
+
+  /**
+   * @brief Frees a block (its nodes should not contain any values)
+  */
+  static void deallocateBlock(Block *block);
+};
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename Node, Node* Node::*Next, size_t MaxRefill>
+Node* NodePool<Node, Next, MaxRefill>::acquire(size_type in_use) {
+  if (free_ == nullptr) {
+    size_type n = in_use == 0 ? 1 : in_use;
+    if (n > MaxRefill) {
+      n = MaxRefill;
+    }
+
+    Node *nodes = allocateBlock(n);
+    for (size_type i = 0; i < n; ++i) {
+      release(&nodes[i]);
+    }
+  }
+
+  Node *node = free_;
+  free_ = next(node);
+
+  return node;
+}
+
+template <typename Node, Node* Node::*Next, size_t MaxRefill>
+Node* NodePool<Node, Next, MaxRefill>::take(size_type n) {
+  size_type available = 0;
+  for (Node *free = free_; free != nullptr && available < n; free = next(free)) {
+    ++available;
+  }
+
+  // nodes of a new block go in address order, the free ones before them
+  const size_type missing = n - available;
+  Node *chain = nullptr;
+
+  if (missing > 0) {
+    Node *nodes = allocateBlock(missing);
+
+    for (size_type i = missing; i > 0; --i) {
+      next(&nodes[i - 1]) = chain;
+      chain = &nodes[i - 1];
+    }
+  }
+
+  for (size_type i = missing; i < n; ++i) {
+    Node *node = free_;
+    free_ = next(node);
+
+    next(node) = chain;
+    chain = node;
+  }
+
+  return chain;
+}
+
+template <typename Node, Node* Node::*Next, size_t MaxRefill>
+void NodePool<Node, Next, MaxRefill>::clear() {
+  while (blocks_ != nullptr) {
+    Block *next_block = blocks_->next_;
+    deallocateBlock(blocks_);
+    blocks_ = next_block;
+  }
+
+  free_ = nullptr;
+}
+
+template <typename Node, Node* Node::*Next, size_t MaxRefill>
+void NodePool<Node, Next, MaxRefill>::keepBiggestBlock() {
+  if (blocks_ == nullptr || blocks_->next_ == nullptr) {
+    return;
+  }
+
+  Block *biggest = blocks_;
+  for (Block *block = blocks_->next_; block != nullptr; block = block->next_) {
+    if (block->count_ > biggest->count_) {
+      biggest = block;
+    }
+  }
+
+  Block *block = blocks_;
+  while (block != nullptr) {
+    Block *next_block = block->next_;
+    if (block != biggest) {
+      deallocateBlock(block);
+    }
+    block = next_block;
+  }
+
+  biggest->next_ = nullptr;
+  blocks_ = biggest;
+
+  // every node is free, the ones of the kept block are all that is left
+  Node *nodes = nodesOf(biggest);
+  free_ = nullptr;
+  for (size_type i = biggest->count_; i > 0; --i) {
+    release(&nodes[i - 1]);
+  }
+}
+
+template <typename Node, Node* Node::*Next, size_t MaxRefill>
+void NodePool<Node, Next, MaxRefill>::freeUnusedBlocks() {
+  size_type count = 0;
+  for (Block *block = blocks_; block != nullptr; block = block->next_) {
+    ++count;
+  }
+
+  if (count == 0) {
+    return;
+  }
+
+  // blocks sorted by address, a free node belongs to the last block starting
+  // before it
+  std::unique_ptr<Block*[]> blocks(new Block*[count]);
+  std::unique_ptr<size_type[]> unused(new size_type[count]());
+
+  count = 0;
+  for (Block *block = blocks_; block != nullptr; block = block->next_) {
+    blocks[count++] = block;
+  }
+  std::sort(blocks.get(), blocks.get() + count, std::less<Block*>());
+
+  auto blockOf = [&](Node *node) {
+    return std::upper_bound(blocks.get(), blocks.get() + count, reinterpret_cast<Block*>(node),
+                            std::less<Block*>()) - blocks.get() - 1;
+  };
+
+  for (Node *node = free_; node != nullptr; node = next(node)) {
+    ++unused[blockOf(node)];
+  }
+
+  // free nodes of the kept blocks make the new free list
+  Node *kept = nullptr;
+  for (Node *node = free_; node != nullptr;) {
+    Node *next_node = next(node);
+    const auto i = blockOf(node);
+
+    if (unused[i] != blocks[i]->count_) {
+      next(node) = kept;
+      kept = node;
+    }
+    node = next_node;
+  }
+  free_ = kept;
+
+  blocks_ = nullptr;
+  for (size_type i = 0; i < count; ++i) {
+    if (unused[i] == blocks[i]->count_) {
+      deallocateBlock(blocks[i]);
+    } else {
+      blocks[i]->next_ = blocks_;
+      blocks_ = blocks[i];
+    }
+  }
+}
+
+
+/* ========================================================================= */
+/*                 Private Helper Methods Implementation                     */
+/* ========================================================================= */
+
+template <typename Node, Node* Node::*Next, size_t MaxRefill>
+Node* NodePool<Node, Next, MaxRefill>::allocateBlock(size_type n) {
+  const size_type bytes = sizeof(Block) + n * sizeof(Node);
+
+  void *memory = nullptr;
+  if constexpr (alignof(Block) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    memory = ::operator new(bytes, std::align_val_t(alignof(Block)));
+  } else {
+    memory = ::operator new(bytes);
+  }
+
+  Block *block = static_cast<Block*>(memory);
+  block->next_ = blocks_;
+  block->count_ = n;
+  blocks_ = block;
+
+  return nodesOf(block);
+}
+
+template <typename Node, Node* Node::*Next, size_t MaxRefill>
+void NodePool<Node, Next, MaxRefill>::deallocateBlock(Block *block) {
+  if constexpr (alignof(Block) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    ::operator delete(block, std::align_val_t(alignof(Block)));
+  } else {
+    ::operator delete(block);
+  }
+}
+
+} // namespace s21
+
+#endif  // S21_NODE_POOL_H_
@@ -0,0 +1,416 @@
+#ifndef S21_PAIRING_HEAP_H_
+#define S21_PAIRING_HEAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+
+#include "s21_container.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a pairing heap
+//
+// Heap is a tree with any number of children per node, children of a node are
+// kept in a doubly linked list (prev_ of the first child points to the parent).
+// Push and decrease-key just meld a single node with the root in O(1), all the
+// work is postponed to pop, which merges children of the removed root in two
+// passes. This makes pairing heap a good fit for workloads with many
+// decrease-key calls (Dijkstra, schedulers)
+//
+// Priority works the same way as in PriorityQueue: the element for which
+// Compare says that it is not less than any other is on top. Nodes never move
+// in memory, so a handle stays valid until its element is popped
+
+template <typename T, typename Compare = std::less<T>>
+class PairingHeap : public Container {
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+
+  struct Node {
+    value_type value_;
+    Node *child_ = nullptr;
+    Node *next_ = nullptr; // next sibling (next free node for released ones)
+    Node *prev_ = nullptr; // previous sibling or parent for the first child
+
+    explicit Node(const_reference value) : value_{ value } {}
+  };
+
+  Node *root_ = nullptr;
+  Node *free_ = nullptr; // released nodes, reused by push
+  Compare compare_;
+
+public:
+
+  /**
+   * @brief Identifies an element in the heap
+   *
+   * @note Handle is valid until its element is popped, after that the node
+   * can be given to another element
+  */
+  class Handle {
+    friend class PairingHeap;
+
+    Node *node_;
+
+    explicit Handle(Node *node) : node_{ node } {}
+
+  public:
+    /**
+     * @brief Creates a handle that does not belong to any element
+    */
+    Handle() : node_{ nullptr } {}
+
+    bool operator==(const Handle &other) const { return node_ == other.node_; }
+
+    bool operator!=(const Handle &other) const { return node_ != other.node_; }
+  };
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor, creates an empty heap
+  */
+  explicit PairingHeap(const Compare &compare = Compare()) : compare_{ compare } {}
+
+  /**
+   * @brief initializer list constructor
+  */
+  PairingHeap(std::initializer_list<value_type> const& items, const Compare &compare = Compare())
+      : compare_{ compare } {
+    for (const_reference item : items) {
+      push(item);
+    }
+  }
+
+  /**
+   * @note Heap cannot be copied: handles of the copy would point into the original
+  */
+  PairingHeap(const PairingHeap&) = delete;
+  PairingHeap& operator=(const PairingHeap&) = delete;
+
+  /**
+   * @brief Destructor. Deletes all nodes
+  */
+  ~PairingHeap();
+
+/* ========================================================================= */
+/*                              Main Methods                                 */
+/* ========================================================================= */
+
+  /**
+   * @brief Accesses the top element
+   *
+   * @throws ArrayException if heap is empty
+  */
+  const_reference top() const;
+
+  /**
+   * @brief Inserts an element in O(1) and returns its handle
+  */
+  Handle push(const_reference value);
+
+  /**
+   * @brief Removes the top element in amortized O(log n)
+   *
+   * @note If heap is empty nothing is done
+  */
+  void pop();
+
+  /**
+   * @brief Moves an element closer to the top: sets its value to a new one,
+   * that Compare says is not less than the old one
+   *
+   * @throws ArrayException if the handle does not belong to an element or the
+   * new value has lower priority than the old one
+  */
+  void decrease_key(Handle handle, const_reference value);
+
+  /**
+   * @brief Returns the value of an element by its handle
+   *
+   * @throws ArrayException if the handle does not belong to an element
+  */
+  const_reference get(Handle handle) const { return checked(handle)->value_; }
+
+  /**
+   * @brief Removes all elements, all handles become invalid
+  */
+  void clear();
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Returns the node of a handle
+   *
+   * @throws ArrayException if the node is not in the heap
+  */
+  Node* checked(Handle handle) const;
+
+  Node* acquireNode(const_reference value);
+
+  void releaseNode(Node *node);
+
+  /**
+   * @brief Links two roots: the one with lower priority becomes the first
+   * child of the other one
+  */
+  Node* meld(Node *a, Node *b);
+
+  /**
+   * @brief Merges a list of siblings into one tree (two-pass pairing)
+  */
+  Node* mergePairs(Node *first);
+
+  /**
+   * @brief Cuts a subtree out of its parent's list of children
+  */
+  void cut(Node *node);
+
+  /**
+   * @brief Deletes a whole subtree
+  */
+  static void deleteTree(Node *node);
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+template <typename T, typename Compare>
+PairingHeap<T, Compare>::~PairingHeap() {
+  clear();
+
+  while (free_ != nullptr) {
+    Node *next = free_->next_;
+    delete free_;
+    free_ = next;
+  }
+}
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename T, typename Compare>
+const T& PairingHeap<T, Compare>::top() const {
+  if (root_ == nullptr) {
+    throw ArrayException("Heap is empty");
+  }
+
+  return root_->value_;
+}
+
+template <typename T, typename Compare>
+typename PairingHeap<T, Compare>::Handle PairingHeap<T, Compare>::push(const_reference value) {
+  Node *node = acquireNode(value);
+
+  root_ = root_ == nullptr ? node : meld(root_, node);
+  ++(this->size_);
+
+  return Handle(node);
+}
+
+template <typename T, typename Compare>
+void PairingHeap<T, Compare>::pop() {
+  if (root_ == nullptr) {
+    return;
+  }
+
+  Node *old = root_;
+  root_ = mergePairs(old->child_);
+
+  if (root_ != nullptr) {
+    root_->prev_ = nullptr;
+  }
+
+  releaseNode(old);
+  --(this->size_);
+}
+
+template <typename T, typename Compare>
+void PairingHeap<T, Compare>::decrease_key(Handle handle, const_reference value) {
+  Node *node = checked(handle);
+
+  if (compare_(value, node->value_)) {
+    throw ArrayException("New value has lower priority than the old one");
+  }
+
+  node->value_ = value;
+
+  if (node == root_) {
+    return;
+  }
+
+  cut(node);
+  root_ = meld(root_, node);
+}
+
+template <typename T, typename Compare>
+void PairingHeap<T, Compare>::clear() {
+  deleteTree(root_);
+
+  root_ = nullptr;
+  this->size_ = 0;
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+template <typename T, typename Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::checked(Handle handle) const {
+  Node *node = handle.node_;
+
+  // only the root has no prev_ among nodes in the heap, released
+  // nodes have no prev_ either
+  if (node == nullptr || (node != root_ && node->prev_ == nullptr)) {
+    throw ArrayException("Handle does not belong to an element of the heap");
+  }
+
+  return node;
+}
+
+template <typename T, typename Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::acquireNode(const_reference value) {
+  if (free_ == nullptr) {
+    return new Node(value);
+  }
+
+  Node *node = free_;
+  free_ = node->next_;
+
+  node->value_ = value;
+  node->next_ = nullptr;
+
+  return node;
+}
+
+template <typename T, typename Compare>
+void PairingHeap<T, Compare>::releaseNode(Node *node) {
+  node->child_ = nullptr;
+  node->prev_ = nullptr;
+  node->next_ = free_;
+
+  free_ = node;
+}
+
+template <typename T, typename Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::meld(Node *a, Node *b) {
+  if (compare_(a->value_, b->value_)) {
+    Node *temp = a;
+    a = b;
+    b = temp;
+  }
+
+  // b becomes the first child of a
+  b->prev_ = a;
+  b->next_ = a->child_;
+
+  if (a->child_ != nullptr) {
+    a->child_->prev_ = b;
+  }
+
+  a->child_ = b;
+  a->next_ = nullptr;
+
+  return a;
+}
+
+template <typename T, typename Compare>
+typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::mergePairs(Node *first) {
+  if (first == nullptr) {
+    return nullptr;
+  }
+
+  // first pass: meld siblings pairwise from left to right, results are
+  // chained in reverse order through prev_
+  Node *pairs = nullptr;
+
+  while (first != nullptr) {
+    Node *a = first;
+    Node *b = a->next_;
+
+    if (b == nullptr) {
+      a->prev_ = pairs;
+      pairs = a;
+      break;
+    }
+
+    first = b->next_;
+    a->next_ = nullptr;
+    b->next_ = nullptr;
+
+    Node *melded = meld(a, b);
+    melded->prev_ = pairs;
+    pairs = melded;
+  }
+
+  // second pass: meld the results from right to left
+  Node *result = pairs;
+  pairs = pairs->prev_;
+
+  while (pairs != nullptr) {
+    Node *next = pairs->prev_;
+    result = meld(result, pairs);
+    pairs = next;
+  }
+
+  return result;
+}
+
+template <typename T, typename Compare>
+void PairingHeap<T, Compare>::cut(Node *node) {
+  if (node->prev_->child_ == node) { // first child, prev_ is the parent
+    node->prev_->child_ = node->next_;
+  } else {
+    node->prev_->next_ = node->next_;
+  }
+
+  if (node->next_ != nullptr) {
+    node->next_->prev_ = node->prev_;
+  }
+
+  node->prev_ = nullptr;
+  node->next_ = nullptr;
+}
+
+template <typename T, typename Compare>
+void PairingHeap<T, Compare>::deleteTree(Node *node) {
+  // children are walked iteratively through a chain of siblings, so deep
+  // heaps (after many pushes without pops) do not overflow the stack
+  while (node != nullptr) {
+    if (node->child_ != nullptr) {
+      // hang the children in front of the remaining siblings
+      Node *last = node->child_;
+      while (last->next_ != nullptr) {
+        last = last->next_;
+      }
+
+      last->next_ = node->next_;
+      node->next_ = node->child_;
+      node->child_ = nullptr;
+    }
+
+    Node *next = node->next_;
+    delete node;
+    node = next;
+  }
+}
+
+} // namespace s21
+
+#endif  // S21_PAIRING_HEAP_H_
@@ -0,0 +1,564 @@
+#ifndef S21_PRIORITY_QUEUE_H_
+#define S21_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "s21_vector.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a priority queue as an implicit d-ary heap
+//
+// Elements are stored level by level in a Vector: children of the element at
+// index i are at indices Arity * i + 1 ... Arity * i + Arity. A wider node
+// makes the heap shallower and all children of a node share one or two
+// cache lines, so sifting down touches less memory than with a binary heap.
+//
+// Just like std::priority_queue, the element for which Compare says that it is
+// not less than any other is on top (largest with std::less, smallest with
+// std::greater). Every pushed element gets a handle, which can later be used
+// to change the priority of the element (decrease-key) or to remove it
+
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class PriorityQueue { // does not inherit from Container, because it contains container (vector)
+  static_assert(Arity >= 2, "Heap node should have at least two children");
+
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using size_type = size_t;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+
+  static constexpr size_type kNoPosition = std::numeric_limits<size_type>::max();
+
+  struct Entry {
+    value_type value_;
+    size_type handle_;
+  };
+
+  Vector<Entry> heap_;
+  Vector<size_type> positions_; // heap index for every handle id
+  Vector<size_type> free_handles_; // ids of popped elements, reused by push
+  Compare compare_;
+
+public:
+
+  /**
+   * @brief Identifies an element in the queue
+   *
+   * @note Handle is valid until its element is popped or removed, after that
+   * the same id can be given to another element
+  */
+  class Handle {
+    friend class PriorityQueue;
+
+    size_type id_;
+
+    explicit Handle(size_type id) : id_{ id } {}
+
+  public:
+    /**
+     * @brief Creates a handle that does not belong to any element
+    */
+    Handle() : id_{ kNoPosition } {}
+
+    bool operator==(const Handle &other) const { return id_ == other.id_; }
+
+    bool operator!=(const Handle &other) const { return id_ != other.id_; }
+  };
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor, creates an empty queue
+  */
+  explicit PriorityQueue(const Compare &compare = Compare()) : compare_{ compare } {}
+
+  /**
+   * @brief initializer list constructor, the heap is built in O(n)
+  */
+  PriorityQueue(std::initializer_list<value_type> const& items, const Compare &compare = Compare())
+      : PriorityQueue(items.begin(), items.end(), compare) {}
+
+  /**
+   * @brief Range constructor, the heap is built in O(n) (heapify)
+  */
+  template <typename InputIt>
+  PriorityQueue(InputIt first, InputIt last, const Compare &compare = Compare());
+
+/* ========================================================================= */
+/*                              Main Methods                                 */
+/* ========================================================================= */
+
+  /**
+   * @brief Accesses the top element
+   *
+   * @throws ArrayException if queue is empty
+  */
+  const_reference top() const;
+
+  /**
+   * @brief Inserts an element in O(log n) and returns its handle
+  */
+  Handle push(const_reference value);
+
+  /**
+   * @brief Inserts all elements of a range
+   *
+   * @note If the range is not smaller than the queue itself, the whole heap is
+   * rebuilt in O(n + k) instead of k separate pushes
+  */
+  template <typename InputIt>
+  void push_many(InputIt first, InputIt last);
+
+  void push_many(std::initializer_list<value_type> const& items) { push_many(items.begin(), items.end()); }
+
+  /**
+   * @brief Removes the top element
+   *
+   * @note If queue is empty nothing is done
+  */
+  void pop();
+
+  /**
+   * @brief Moves an element closer to the top: sets its value to a new one,
+   * that Compare says is not less than the old one
+   *
+   * @throws ArrayException if the handle is not valid or the new value has
+   * lower priority than the old one
+  */
+  void decrease_key(Handle handle, const_reference value);
+
+  /**
+   * @brief Sets a new value of an element, the element moves up or down
+   *
+   * @throws ArrayException if the handle is not valid
+  */
+  void update(Handle handle, const_reference value);
+
+  /**
+   * @brief Removes an element by its handle in O(log n)
+   *
+   * @throws ArrayException if the handle is not valid
+  */
+  void remove(Handle handle);
+
+  /**
+   * @brief Returns the value of an element by its handle
+   *
+   * @throws ArrayException if the handle is not valid
+  */
+  const_reference get(Handle handle) const { return heap_[position(handle)].value_; }
+
+  /**
+   * @brief Returns true if the handle belongs to an element of the queue
+  */
+  bool contains(Handle handle) const {
+    return handle.id_ < positions_.size() && positions_[handle.id_] != kNoPosition;
+  }
+
+  /**
+   * @brief Removes all elements, all handles become invalid
+  */
+  void clear();
+
+  size_type size() const { return heap_.size(); }
+
+  bool empty() const { return heap_.size() == 0; }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Returns the heap index of a valid handle
+   *
+   * @throws ArrayException if the handle is not valid
+  */
+  size_type position(Handle handle) const;
+
+  /**
+   * @brief Appends an entry at the end of the heap without restoring the order
+  */
+  size_type append(const_reference value);
+
+  /**
+   * @brief Gives the handle id back, so that it could be reused
+  */
+  void releaseHandle(size_type id);
+
+  /**
+   * @brief Removes the entry at index i, last entry takes its place
+  */
+  void removeAt(size_type i);
+
+  /**
+   * @brief Puts an entry to index i and updates its position
+  */
+  void place(size_type i, const Entry &entry) {
+    heap_[i] = entry;
+    positions_[entry.handle_] = i;
+  }
+
+  void place(size_type i, Entry &&entry) {
+    heap_[i] = std::move(entry);
+    positions_[heap_[i].handle_] = i;
+  }
+
+  /**
+   * @brief Moves the entry at index i up while its parent has lower priority
+   *
+   * @note Entry is kept aside and parents are moved down into the hole, so
+   * every step costs one move instead of a swap
+  */
+  void siftUp(size_type i);
+
+  /**
+   * @brief Moves the entry at index i down while one of its children has
+   * higher priority
+   *
+   * @note With Track = false positions of handles are not updated (heapify
+   * fixes all of them in one pass afterwards)
+  */
+  template <bool Track = true>
+  void siftDown(size_type i);
+
+  /**
+   * @brief Removes the top entry
+   *
+   * @note Bottom-up variant (Floyd): the hole at the top is moved down to a
+   * leaf along the best children without comparing them to the last entry,
+   * then the last entry is put into the hole and sifted up. The last entry
+   * almost always belongs near the bottom, so this saves a comparison per level
+  */
+  void popTop();
+
+  /**
+   * @brief Restores the heap order of the whole vector in O(n)
+  */
+  void heapify();
+
+  /**
+   * @brief Reserves space for n more elements if the distance of the range
+   * is known in advance
+  */
+  template <typename InputIt>
+  void reserveFor(InputIt first, InputIt last);
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+template <typename T, typename Compare, size_t Arity>
+template <typename InputIt>
+PriorityQueue<T, Compare, Arity>::PriorityQueue(InputIt first, InputIt last, const Compare &compare)
+    : compare_{ compare } {
+  reserveFor(first, last);
+
+  for (; first != last; ++first) {
+    append(*first);
+  }
+
+  heapify();
+}
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename T, typename Compare, size_t Arity>
+const T& PriorityQueue<T, Compare, Arity>::top() const {
+  if (empty()) {
+    throw ArrayException("Priority queue is empty");
+  }
+
+  return heap_[0].value_;
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename PriorityQueue<T, Compare, Arity>::Handle
+    PriorityQueue<T, Compare, Arity>::push(const_reference value) {
+  size_type i = append(value);
+  size_type id = heap_[i].handle_;
+
+  siftUp(i);
+
+  return Handle(id);
+}
+
+template <typename T, typename Compare, size_t Arity>
+template <typename InputIt>
+void PriorityQueue<T, Compare, Arity>::push_many(InputIt first, InputIt last) {
+  const size_type old_size = size();
+
+  reserveFor(first, last);
+
+  for (; first != last; ++first) {
+    append(*first);
+  }
+
+  const size_type added = size() - old_size;
+
+  if (added >= old_size) {
+    heapify();
+  } else {
+    for (size_type i = old_size; i < size(); ++i) {
+      siftUp(i);
+    }
+  }
+}
+
+template <typename T, typename Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::pop() {
+  if (empty()) {
+    return;
+  }
+
+  popTop();
+}
+
+template <typename T, typename Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::decrease_key(Handle handle, const_reference value) {
+  size_type i = position(handle);
+
+  if (compare_(value, heap_[i].value_)) {
+    throw ArrayException("New value has lower priority than the old one");
+  }
+
+  heap_[i].value_ = value;
+  siftUp(i);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::update(Handle handle, const_reference value) {
+  size_type i = position(handle);
+  bool lower = compare_(value, heap_[i].value_);
+
+  heap_[i].value_ = value;
+
+  if (lower) {
+    siftDown(i);
+  } else {
+    siftUp(i);
+  }
+}
+
+template <typename T, typename Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::remove(Handle handle) {
+  removeAt(position(handle));
+}
+
+template <typename T, typename Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::clear() {
+  heap_.clear();
+  positions_.clear();
+  free_handles_.clear();
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+template <typename T, typename Compare, size_t Arity>
+typename PriorityQueue<T, Compare, Arity>::size_type
+    PriorityQueue<T, Compare, Arity>::position(Handle handle) const {
+  if (!contains(handle)) {
+    throw ArrayException("Handle does not belong to an element of the queue");
+  }
+
+  return positions_[handle.id_];
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename PriorityQueue<T, Compare, Arity>::size_type
+    PriorityQueue<T, Compare, Arity>::append(const_reference value) {
+  size_type id;
+
+  if (free_handles_.size() > 0) {
+    id = free_handles_.back();
+    free_handles_.pop_back();
+  } else {
+    id = positions_.size();
+    positions_.push_back(kNoPosition);
+  }
+
+  size_type i = heap_.size();
+  heap_.push_back(Entry{ value, id });
+  positions_[id] = i;
+
+  return i;
+}
+
+template <typename T, typename Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::releaseHandle(size_type id) {
+  positions_[id] = kNoPosition;
+  free_handles_.push_back(id);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::removeAt(size_type i) {
+  releaseHandle(heap_[i].handle_);
+
+  const size_type last = heap_.size() - 1;
+
+  if (i == last) {
+    heap_.pop_back();
+    return;
+  }
+
+  Entry moved = std::move(heap_[last]);
+  heap_.pop_back();
+
+  // last entry can belong both above and below the freed place
+  bool higher = compare_(heap_[i].value_, moved.value_);
+  place(i, std::move(moved));
+
+  if (higher) {
+    siftUp(i);
+  } else {
+    siftDown(i);
+  }
+}
+
+template <typename T, typename Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::siftUp(size_type i) {
+  Entry moving = std::move(heap_[i]);
+
+  while (i > 0) {
+    size_type parent = (i - 1) / Arity;
+
+    if (!compare_(heap_[parent].value_, moving.value_)) {
+      break;
+    }
+
+    place(i, std::move(heap_[parent]));
+    i = parent;
+  }
+
+  place(i, std::move(moving));
+}
+
+template <typename T, typename Compare, size_t Arity>
+template <bool Track>
+void PriorityQueue<T, Compare, Arity>::siftDown(size_type i) {
+  const size_type n = heap_.size();
+  Entry moving = std::move(heap_[i]);
+
+  while (true) {
+    size_type first = Arity * i + 1;
+    if (first >= n) {
+      break;
+    }
+
+    size_type end = n - first > Arity ? first + Arity : n;
+
+    size_type best = first;
+    for (size_type child = first + 1; child < end; ++child) {
+      if (compare_(heap_[best].value_, heap_[child].value_)) {
+        best = child;
+      }
+    }
+
+    if (!compare_(moving.value_, heap_[best].value_)) {
+      break;
+    }
+
+    if (Track) {
+      place(i, std::move(heap_[best]));
+    } else {
+      heap_[i] = std::move(heap_[best]);
+    }
+    i = best;
+  }
+
+  if (Track) {
+    place(i, std::move(moving));
+  } else {
+    heap_[i] = std::move(moving);
+  }
+}
+
+template <typename T, typename Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::popTop() {
+  releaseHandle(heap_[0].handle_);
+
+  Entry moved = std::move(heap_[heap_.size() - 1]);
+  heap_.pop_back();
+
+  const size_type n = heap_.size();
+  if (n == 0) {
+    return;
+  }
+
+  size_type hole = 0;
+
+  while (true) {
+    size_type first = Arity * hole + 1;
+    if (first >= n) {
+      break;
+    }
+
+    size_type end = n - first > Arity ? first + Arity : n;
+
+    size_type best = first;
+    for (size_type child = first + 1; child < end; ++child) {
+      if (compare_(heap_[best].value_, heap_[child].value_)) {
+        best = child;
+      }
+    }
+
+    place(hole, std::move(heap_[best]));
+    hole = best;
+  }
+
+  place(hole, std::move(moved));
+  siftUp(hole);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void PriorityQueue<T, Compare, Arity>::heapify() {
+  const size_type n = heap_.size();
+
+  if (n < 2) {
+    return;
+  }
+
+  // leaves are heaps already, start from the last parent
+  for (size_type i = (n - 2) / Arity + 1; i > 0; --i) {
+    siftDown<false>(i - 1);
+  }
+
+  // one sequential pass instead of a random write on every move
+  for (size_type i = 0; i < n; ++i) {
+    positions_[heap_[i].handle_] = i;
+  }
+}
+
+template <typename T, typename Compare, size_t Arity>
+template <typename InputIt>
+void PriorityQueue<T, Compare, Arity>::reserveFor(InputIt first, InputIt last) {
+  if constexpr (MultiPass<InputIt>::value) {
+    const size_type n = countRange(first, last);
+
+    reserveMore(heap_, n);
+    reserveMore(positions_, n);
+  }
+}
+
+} // namespace s21
+
+#endif  // S21_PRIORITY_QUEUE_H_
@@ -1,7 +1,10 @@
 #ifndef S21_QUEUE_H_
 #define S21_QUEUE_H_
 
+#include <iterator>
+
 #include "s21_deque.h"
+#include "s21_vector.h"
 #include "../array_exception.h"
 
 namespace s21 {
@@ -97,6 +100,46 @@ public:
     Deque<T>::container_.popFront();
   }
 
+  /**
+   * @brief Removes up to n first elements and returns how many were removed
+  */
+  size_type pop_n(size_type n) {
+    if (n > this->size()) {
+      n = this->size();
+    }
+
+    for (size_type i = 0; i < n; ++i) {
+      Deque<T>::container_.popFront();
+    }
+
+    return n;
+  }
+
+  /**
+   * @brief Moves up to n first elements into out (oldest first) and removes
+   * them in one pass over the list, returns how many were moved
+  */
+  template <typename OutputIt>
+  size_type pop_n(OutputIt out, size_type n) {
+    return Deque<T>::container_.popFront(out, n);
+  }
+
+  /**
+   * @brief Appends up to max first elements to out and removes them,
+   * returns how many were moved
+   *
+   * @note Room in out is reserved once for the whole batch
+  */
+  size_type drain(Vector<value_type> &out, size_type max = static_cast<size_type>(-1)) {
+    if (max > this->size()) {
+      max = this->size();
+    }
+
+    reserveMore(out, max);
+
+    return pop_n(std::back_inserter(out), max);
+  }
+
   /* ========================================================================= */
   /*                        Bonus Methods (insert_many)                        */
   /* ========================================================================= */
@@ -0,0 +1,366 @@
+#ifndef S21_RADIX_HEAP_H_
+#define S21_RADIX_HEAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "s21_container.h"
+#include "s21_intrusive_list.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a radix heap for monotone unsigned integer keys
+//
+// Heap only works when keys never go below the last popped key (timers,
+// Dijkstra). Element goes into bucket number bit_width(key ^ last_): bucket 0
+// keeps keys equal to last_, bucket i keeps keys that first differ from last_
+// in bit i - 1. When bucket 0 is empty, the first non-empty bucket is
+// redistributed around its minimum and all its elements go to lower buckets,
+// so every element moves at most once per bit of the key.
+//
+// Buckets are IntrusiveLists of nodes that never move in memory, which makes
+// decrease_key just an unlink from one bucket and a link into another one.
+// Element with the smallest key is on top
+
+template <typename T, typename Key = uint64_t>
+class RadixHeap : public Container {
+  static_assert(std::is_integral<Key>::value && std::is_unsigned<Key>::value,
+                "RadixHeap keys should be unsigned integers");
+
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using value_type = T;
+  using key_type = Key;
+  using reference = T&;
+  using const_reference = const T&;
+
+  static constexpr size_type kBuckets = std::numeric_limits<key_type>::digits + 1;
+
+  struct Node {
+    key_type key_;
+    value_type value_;
+    IntrusiveListHook hook_;
+    bool queued_ = false; // false for released nodes
+
+    Node(key_type key, const_reference value) : key_{ key }, value_{ value } {}
+  };
+
+  using Bucket = IntrusiveList<Node, &Node::hook_>;
+
+  Bucket buckets_[kBuckets];
+  Bucket free_; // released nodes, reused by push
+  key_type last_ = 0;
+
+public:
+
+  /**
+   * @brief Identifies an element in the heap
+   *
+   * @note Handle is valid until its element is popped, after that the node
+   * can be given to another element
+  */
+  class Handle {
+    friend class RadixHeap;
+
+    Node *node_;
+
+    explicit Handle(Node *node) : node_{ node } {}
+
+  public:
+    /**
+     * @brief Creates a handle that does not belong to any element
+    */
+    Handle() : node_{ nullptr } {}
+
+    bool operator==(const Handle &other) const { return node_ == other.node_; }
+
+    bool operator!=(const Handle &other) const { return node_ != other.node_; }
+  };
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Default constructor, creates an empty heap
+  */
+  RadixHeap() {}
+
+  /**
+   * @note Heap cannot be copied: handles of the copy would point into the original
+  */
+  RadixHeap(const RadixHeap&) = delete;
+  RadixHeap& operator=(const RadixHeap&) = delete;
+
+  /**
+   * @brief Destructor. Deletes all nodes
+  */
+  ~RadixHeap();
+
+/* ========================================================================= */
+/*                              Main Methods                                 */
+/* ========================================================================= */
+
+  /**
+   * @brief Accesses the value of the element with the smallest key
+   *
+   * @note Not const: finding the top can redistribute a bucket
+   *
+   * @throws ArrayException if heap is empty
+  */
+  const_reference top() { return topNode().value_; }
+
+  /**
+   * @brief Returns the smallest key
+   *
+   * @throws ArrayException if heap is empty
+  */
+  key_type top_key() { return topNode().key_; }
+
+  /**
+   * @brief Inserts an element in O(1) and returns its handle
+   *
+   * @throws ArrayException if key is less than the last popped key
+  */
+  Handle push(key_type key, const_reference value);
+
+  /**
+   * @brief Removes the element with the smallest key
+   *
+   * @note If heap is empty nothing is done
+  */
+  void pop();
+
+  /**
+   * @brief Lowers the key of an element in O(1)
+   *
+   * @throws ArrayException if the handle does not belong to an element, the
+   * new key is bigger than the old one or less than the last popped key
+  */
+  void decrease_key(Handle handle, key_type key);
+
+  /**
+   * @brief Returns the value of an element by its handle
+   *
+   * @throws ArrayException if the handle does not belong to an element
+  */
+  const_reference get(Handle handle) const { return checked(handle)->value_; }
+
+  /**
+   * @brief Returns the key of an element by its handle
+   *
+   * @throws ArrayException if the handle does not belong to an element
+  */
+  key_type key(Handle handle) const { return checked(handle)->key_; }
+
+  /**
+   * @brief Removes all elements, all handles become invalid
+   *
+   * @note Keys are monotone again starting from zero
+  */
+  void clear();
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Returns the node of a handle
+   *
+   * @throws ArrayException if the node is not in the heap
+  */
+  Node* checked(Handle handle) const;
+
+  /**
+   * @brief Makes bucket 0 non-empty and returns its first node
+   *
+   * @throws ArrayException if heap is empty
+  */
+  Node& topNode();
+
+  /**
+   * @brief Returns the bucket a key belongs to (number of significant
+   * bits in key ^ last_)
+  */
+  size_type bucketOf(key_type key) const;
+
+  Node* acquireNode(key_type key, const_reference value);
+
+  void releaseNode(Node *node);
+
+  static void deleteNodes(Bucket &bucket);
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+template <typename T, typename Key>
+RadixHeap<T, Key>::~RadixHeap() {
+  for (Bucket &bucket : buckets_) {
+    deleteNodes(bucket);
+  }
+
+  deleteNodes(free_);
+}
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename T, typename Key>
+typename RadixHeap<T, Key>::Handle RadixHeap<T, Key>::push(key_type key, const_reference value) {
+  if (key < last_) {
+    throw ArrayException("Key is less than the last popped key");
+  }
+
+  Node *node = acquireNode(key, value);
+
+  buckets_[bucketOf(key)].pushBack(*node);
+  ++(this->size_);
+
+  return Handle(node);
+}
+
+template <typename T, typename Key>
+void RadixHeap<T, Key>::pop() {
+  if (this->size_ == 0) {
+    return;
+  }
+
+  Node &node = topNode();
+
+  buckets_[0].popFront();
+  releaseNode(&node);
+  --(this->size_);
+}
+
+template <typename T, typename Key>
+void RadixHeap<T, Key>::decrease_key(Handle handle, key_type key) {
+  Node *node = checked(handle);
+
+  if (key > node->key_) {
+    throw ArrayException("New key is bigger than the old one");
+  }
+
+  if (key < last_) {
+    throw ArrayException("Key is less than the last popped key");
+  }
+
+  buckets_[bucketOf(node->key_)].remove(*node);
+  node->key_ = key;
+  buckets_[bucketOf(key)].pushBack(*node);
+}
+
+template <typename T, typename Key>
+void RadixHeap<T, Key>::clear() {
+  for (Bucket &bucket : buckets_) {
+    while (!bucket.empty()) {
+      Node &node = bucket.front();
+      bucket.popFront();
+      releaseNode(&node);
+    }
+  }
+
+  last_ = 0;
+  this->size_ = 0;
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+template <typename T, typename Key>
+typename RadixHeap<T, Key>::Node* RadixHeap<T, Key>::checked(Handle handle) const {
+  if (handle.node_ == nullptr || !handle.node_->queued_) {
+    throw ArrayException("Handle does not belong to an element of the heap");
+  }
+
+  return handle.node_;
+}
+
+template <typename T, typename Key>
+typename RadixHeap<T, Key>::Node& RadixHeap<T, Key>::topNode() {
+  if (this->size_ == 0) {
+    throw ArrayException("Heap is empty");
+  }
+
+  if (buckets_[0].empty()) {
+    size_type index = 1;
+    while (buckets_[index].empty()) {
+      ++index;
+    }
+
+    Bucket &bucket = buckets_[index];
+
+    key_type min = bucket.front().key_;
+    for (Node &node : bucket) {
+      min = node.key_ < min ? node.key_ : min;
+    }
+
+    // every key of the bucket shares bits above index - 1 with the new last_,
+    // so they all land in buckets lower than index
+    last_ = min;
+
+    while (!bucket.empty()) {
+      Node &node = bucket.front();
+      bucket.popFront();
+      buckets_[bucketOf(node.key_)].pushBack(node);
+    }
+  }
+
+  return buckets_[0].front();
+}
+
+template <typename T, typename Key>
+typename RadixHeap<T, Key>::size_type RadixHeap<T, Key>::bucketOf(key_type key) const {
+  uint64_t diff = static_cast<uint64_t>(key ^ last_);
+
+  return diff == 0 ? 0 : static_cast<size_type>(64 - __builtin_clzll(diff));
+}
+
+template <typename T, typename Key>
+typename RadixHeap<T, Key>::Node* RadixHeap<T, Key>::acquireNode(key_type key, const_reference value) {
+  Node *node = nullptr;
+
+  if (free_.empty()) {
+    node = new Node(key, value);
+  } else {
+    node = &free_.front();
+    free_.popFront();
+
+    node->key_ = key;
+    node->value_ = value;
+  }
+
+  node->queued_ = true;
+
+  return node;
+}
+
+template <typename T, typename Key>
+void RadixHeap<T, Key>::releaseNode(Node *node) {
+  node->queued_ = false;
+  free_.pushFront(*node);
+}
+
+template <typename T, typename Key>
+void RadixHeap<T, Key>::deleteNodes(Bucket &bucket) {
+  while (!bucket.empty()) {
+    Node *node = &bucket.front();
+    bucket.popFront();
+    delete node;
+  }
+}
+
+} // namespace s21
+
+#endif  // S21_RADIX_HEAP_H_
@@ -1,6 +1,7 @@
 #ifndef S21_SET_H_
 #define S21_SET_H_
 
+#include <functional>
 #include <vector>
 #include <utility>
 
@@ -11,9 +12,13 @@
 namespace s21 {
 
 // Implementation of a set collections
+//
+// With a transparent Compare (e.g. Set<std::string, std::less<>>) find,
+// contains, count and lower_bound also take keys of other types, such as
+// std::string_view or const char*, without building a T
 
-template <typename T>
-class Set : public BaseTree<T, bool> {
+template <typename T, typename Compare = std::less<T>>
+class Set : public BaseTree<T, bool, Compare> {
 public:
   // forward declarations for iterators
   class Iterator;
@@ -28,7 +33,9 @@ private:
   using iterator = Iterator;
   using const_iterator = ConstIterator;
 
-  using Tree = BaseTree<T, bool>;
+  using size_type = Container::size_type;
+
+  using Tree = BaseTree<T, bool, Compare>;
   using Node = typename Tree::Node;
 
 public:
@@ -43,7 +50,7 @@ public:
    * @note Does nothing because every variable initial value is
    * already set
   */
-  Set() : BaseTree<T, bool>() {}
+  Set() : Tree() {}
 
   /**
    * @brief Initializer list constructor, creates the set initizialized using std::initializer_list
@@ -62,12 +69,12 @@ public:
    * 
    * @note Performs shallow copy of passed parameter other
   */
-  Set(const Set& other) : BaseTree<T, bool>(other) {}
+  Set(const Set& other) : Tree(other) {}
 
   /**
    * @brief Move constructor
   */
-  Set(Set&& other) : BaseTree<T, bool>(std::move(other)) {}
+  Set(Set&& other) : Tree(std::move(other)) {}
 
   /**
    * @brief Destructor
@@ -94,18 +101,15 @@ public:
    * whether the insertion took place
    * 
    * @note Because set cannot contain duplicates we either
-   * call insert from the base class or return a pair with iterator
+   * insert a new node or return a pair with iterator
    * set to the existing element with passed value and a false denoting that insertion
-   * did not took place
+   * did not took place (a single descent of the tree finds both)
   */
   std::pair<iterator, bool> insert(const value_type& value) {
-    if (!Tree::contains(value)) {
-      // construct a pair of Iterator and bool from pair of Node and bool
-      auto insert_result = Tree::insert(value, false);
-      return std::make_pair(Iterator(*this, insert_result.first), insert_result.second);
-    } else {
-      return std::make_pair(Iterator(*this, Tree::find(value)), false);
-    }
+    // construct a pair of Iterator and bool from pair of Node and bool
+    auto insert_result = Tree::insertUnique(value, false);
+
+    return std::make_pair(Iterator(*this, insert_result.first), insert_result.second);
   }
 
   /**
@@ -125,6 +129,35 @@ public:
     return Iterator(*this, Tree::find(value));
   }
 
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  Iterator find(const K& value) {
+    return Iterator(*this, Tree::find(value));
+  }
+
+  /**
+   * @brief Returns the number of elements equal to the given one, either 0 or 1
+  */
+  size_type count(const T& value) const {
+    return Tree::contains(value) ? 1 : 0;
+  }
+
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  size_type count(const K& value) const {
+    return Tree::contains(value) ? 1 : 0;
+  }
+
+  /**
+   * @brief Returns an iterator to the first element not less than the given key
+  */
+  iterator lower_bound(const T& key) {
+    return Iterator(*this, Tree::lowerNode(key));
+  }
+
+  template <typename K, typename C = Compare, typename = typename C::is_transparent>
+  iterator lower_bound(const K& key) {
+    return Iterator(*this, Tree::lowerNode(key));
+  }
+
 /* ========================================================================= */
 /*                                Iterators                                  */
 /* ========================================================================= */
@@ -134,12 +167,12 @@ public:
     /**
      * @brief Iterator constructor. Sets the current position to the beginning of the tree
     */
-    Iterator(const Set<value_type>& set) : Tree::Iterator(set) {}
+    Iterator(const Set& set) : Tree::Iterator(set) {}
 
     /**
      * @brief Iterator constructor. Sets the current position to the given node
     */
-    Iterator(const Set<value_type>& set, Node* node) : Tree::Iterator(set, node) {}
+    Iterator(const Set& set, Node* node) : Tree::Iterator(set, node) {}
 
     /**
      * @brief Copy constructor
@@ -218,12 +251,12 @@ public:
     /**
      * @brief Iterator constructor. Sets the current position to the beginning of the tree
     */
-    ConstIterator(const Set<value_type>& set) : Iterator(set) {}
+    ConstIterator(const Set& set) : Iterator(set) {}
 
     /**
      * @brief Iterator constructor. Sets the current position to the given node
     */
-    ConstIterator(const Set<value_type>& set, Node *node) : Iterator(set, node) {}
+    ConstIterator(const Set& set, Node *node) : Iterator(set, node) {}
 
     /**
      * @brief Copy constructor
@@ -0,0 +1,345 @@
+#ifndef S21_SPSC_QUEUE_H_
+#define S21_SPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a bounded lock-free queue for exactly one producer thread
+// and exactly one consumer thread
+//
+// Elements live in a ring buffer with a power of two capacity, head and tail
+// are ever growing counters (slot is counter & mask). Only producer writes tail_,
+// only consumer writes head_, so no compare-and-swap is needed, the other side
+// is synchronized through acquire/release. Each side also keeps a cached copy
+// of the other side's counter and re-reads the real one only when the cached
+// value says that the queue is full (or empty)
+
+template <typename T>
+class SpscQueue { // does not inherit from Container, size is shared between threads
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using size_type = size_t;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+
+  static constexpr size_type kCacheLine = 64;
+
+  // consumer side
+  alignas(kCacheLine) std::atomic<size_type> head_{ 0 };
+  size_type tail_cache_ = 0;
+
+  // producer side
+  alignas(kCacheLine) std::atomic<size_type> tail_{ 0 };
+  size_type head_cache_ = 0;
+
+  // shared read-only part
+  alignas(kCacheLine) size_type mask_;
+  value_type *slots_;
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Creates an empty queue that can hold at least capacity elements
+   *
+   * @note Capacity is rounded up to a power of two
+   *
+   * @throws ArrayException if capacity is zero
+  */
+  explicit SpscQueue(size_type capacity);
+
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  /**
+   * @brief Destructor. Destroys elements that were not popped
+  */
+  ~SpscQueue();
+
+/* ========================================================================= */
+/*                         Producer Side Methods                             */
+/* ========================================================================= */
+
+  /**
+   * @brief Inserts an element at the end of the queue
+   *
+   * @return false if the queue is full (nothing is inserted then)
+  */
+  bool push(const_reference value) { return emplace(value); }
+
+  bool push(value_type &&value) { return emplace(std::move(value)); }
+
+  /**
+   * @brief Constructs an element in place at the end of the queue
+   *
+   * @return false if the queue is full
+  */
+  template <typename... Args>
+  bool emplace(Args&&... args);
+
+  /**
+   * @brief Inserts up to n elements from items with a single publication
+   *
+   * @return Number of inserted elements (less than n if the queue got full)
+   *
+   * @note If a copy throws, elements of the batch copied so far are destroyed
+   * and nothing is inserted
+  */
+  size_type push_n(const value_type *items, size_type n);
+
+/* ========================================================================= */
+/*                         Consumer Side Methods                             */
+/* ========================================================================= */
+
+  /**
+   * @brief Accesses the first element of the queue
+   *
+   * @throws ArrayException if queue is empty
+  */
+  reference front();
+
+  /**
+   * @brief Removes the first element from the queue
+   *
+   * @note If queue is empty nothing is done
+  */
+  void pop();
+
+  /**
+   * @brief Moves the first element to out and removes it from the queue
+   *
+   * @return false if the queue is empty
+  */
+  bool pop(reference out);
+
+  /**
+   * @brief Moves up to n elements to out and removes them with a single publication
+   *
+   * @return Number of moved elements
+   *
+   * @note If a move throws, the elements moved before it stay in out and are
+   * removed, the one that failed and the rest stay in the queue
+  */
+  size_type pop_n(value_type *out, size_type n);
+
+/* ========================================================================= */
+/*                              Any Thread                                   */
+/* ========================================================================= */
+
+  /**
+   * @brief Returns the number of elements
+   *
+   * @note Exact only when called by the producer or the consumer while the
+   * other side is not working
+  */
+  size_type size() const {
+    // head first: it never passes the tail, so the tail read after it is not
+    // behind it and the difference does not wrap around
+    const size_type head = head_.load(std::memory_order_acquire);
+    const size_type tail = tail_.load(std::memory_order_acquire);
+
+    return tail - head;
+  }
+
+  /**
+   * @brief Returns true if the queue is empty (see the note for size)
+  */
+  bool empty() const { return size() == 0; }
+
+  /**
+   * @brief Returns the maximum number of elements the queue can hold
+  */
+  size_type capacity() const { return mask_ + 1; }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Returns the number of free slots from the producer point of view
+  */
+  size_type freeSlots(size_type tail, size_type wanted);
+
+  /**
+   * @brief Returns the number of ready elements from the consumer point of view
+  */
+  size_type readySlots(size_type head, size_type wanted);
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+template <typename T>
+SpscQueue<T>::SpscQueue(size_type capacity) {
+  if (capacity == 0) {
+    throw ArrayException("Queue capacity should be positive");
+  }
+
+  size_type rounded = 1;
+  while (rounded < capacity) {
+    rounded <<= 1;
+  }
+
+  mask_ = rounded - 1;
+  slots_ = static_cast<value_type*>(::operator new(rounded * sizeof(value_type),
+                                                   std::align_val_t(alignof(value_type))));
+}
+
+template <typename T>
+SpscQueue<T>::~SpscQueue() {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+
+  for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+    slots_[i & mask_].~value_type();
+  }
+
+  ::operator delete(slots_, std::align_val_t(alignof(value_type)));
+}
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename T>
+template <typename... Args>
+bool SpscQueue<T>::emplace(Args&&... args) {
+  const size_type tail = tail_.load(std::memory_order_relaxed);
+
+  if (freeSlots(tail, 1) == 0) {
+    return false;
+  }
+
+  new (&slots_[tail & mask_]) value_type(std::forward<Args>(args)...);
+
+  tail_.store(tail + 1, std::memory_order_release);
+
+  return true;
+}
+
+template <typename T>
+typename SpscQueue<T>::size_type SpscQueue<T>::push_n(const value_type *items, size_type n) {
+  const size_type tail = tail_.load(std::memory_order_relaxed);
+  const size_type count = freeSlots(tail, n);
+
+  size_type constructed = 0;
+
+  try {
+    for (; constructed < count; ++constructed) {
+      new (&slots_[(tail + constructed) & mask_]) value_type(items[constructed]);
+    }
+  } catch (...) {
+    // the batch is not published yet, consumer never saw these slots
+    for (size_type i = 0; i < constructed; ++i) {
+      slots_[(tail + i) & mask_].~value_type();
+    }
+
+    throw;
+  }
+
+  // consumer sees the whole batch at once
+  tail_.store(tail + count, std::memory_order_release);
+
+  return count;
+}
+
+template <typename T>
+T& SpscQueue<T>::front() {
+  const size_type head = head_.load(std::memory_order_relaxed);
+
+  if (readySlots(head, 1) == 0) {
+    throw ArrayException("Queue is empty");
+  }
+
+  return slots_[head & mask_];
+}
+
+template <typename T>
+void SpscQueue<T>::pop() {
+  const size_type head = head_.load(std::memory_order_relaxed);
+
+  if (readySlots(head, 1) == 0) {
+    return;
+  }
+
+  slots_[head & mask_].~value_type();
+
+  head_.store(head + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool SpscQueue<T>::pop(reference out) {
+  return pop_n(&out, 1) == 1;
+}
+
+template <typename T>
+typename SpscQueue<T>::size_type SpscQueue<T>::pop_n(value_type *out, size_type n) {
+  const size_type head = head_.load(std::memory_order_relaxed);
+  const size_type count = readySlots(head, n);
+
+  size_type moved = 0;
+
+  try {
+    for (; moved < count; ++moved) {
+      value_type &slot = slots_[(head + moved) & mask_];
+      out[moved] = std::move(slot);
+      slot.~value_type();
+    }
+  } catch (...) {
+    // destroyed slots must leave the queue, the one that failed is still alive
+    head_.store(head + moved, std::memory_order_release);
+    throw;
+  }
+
+  // slots are given back to the producer all at once
+  head_.store(head + count, std::memory_order_release);
+
+  return count;
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+template <typename T>
+typename SpscQueue<T>::size_type SpscQueue<T>::freeSlots(size_type tail, size_type wanted) {
+  size_type free = capacity() - (tail - head_cache_);
+
+  if (free < wanted) { // cached head is outdated, look at the real one
+    head_cache_ = head_.load(std::memory_order_acquire);
+    free = capacity() - (tail - head_cache_);
+  }
+
+  return free < wanted ? free : wanted;
+}
+
+template <typename T>
+typename SpscQueue<T>::size_type SpscQueue<T>::readySlots(size_type head, size_type wanted) {
+  size_type ready = tail_cache_ - head;
+
+  if (ready < wanted) { // cached tail is outdated, look at the real one
+    tail_cache_ = tail_.load(std::memory_order_acquire);
+    ready = tail_cache_ - head;
+  }
+
+  return ready < wanted ? ready : wanted;
+}
+
+} // namespace s21
+
+#endif  // S21_SPSC_QUEUE_H_
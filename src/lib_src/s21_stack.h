@@ -1,20 +1,42 @@
 #ifndef S21_STACK_H_
 #define S21_STACK_H_
 
-#include "s21_deque.h"
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
 #include "../array_exception.h"
 
 namespace s21 {
 
-template <typename T>
-class Stack : public Deque<T> {
-private: // could inherit only if base class is not templated, otherwise it goes to shit
+/**
+ * @note Stack does not use Deque (and its List) anymore: elements are kept in
+ * a contiguous array, the first N of them right inside the stack object. Short
+ * lived stacks (tree traversals in BaseTree) never touch the heap, bigger ones
+ * spill into a heap array that doubles when it is full.
+*/
+template <typename T, size_t N = 16>
+class Stack { // stack does not inherit from Container, the same way as Deque
+private:
   // type overrides to make class code easy to understand (really..?)
   using size_type = size_t;
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
 
+  // inline buffer can not have zero size, N = 0 just wastes one slot
+  static constexpr size_type kInline = N == 0 ? 1 : N;
+
+  alignas(T) unsigned char buffer_[kInline * sizeof(T)];
+
+  T *data_;             // points to buffer_ or to the heap array
+  size_type size_{ 0 };
+  size_type capacity_;
+
 public:
 
 /* ========================================================================= */
@@ -24,67 +46,211 @@ public:
   /**
    * @brief Default constructor, creates an empty stack
   */
-  Stack() : Deque<T>() {}
+  Stack() : data_{ inlineData() }, capacity_{ kInline } {}
 
   /**
-   * @brief initializer list constructor, creates 
+   * @brief initializer list constructor, creates
    * stack initizialized using std::initializer_list
+   *
+   * @note The last element of the list is on top
   */
-  Stack(std::initializer_list<value_type> const& items) : Deque<T>(items) {}
+  Stack(std::initializer_list<value_type> const& items) : Stack() {
+    push_many(items);
+  }
+
   /**
    * @brief Copy constructor
-   * 
+   *
    * @note Performs deep copy of a stack, result is two identical stacks
   */
-  Stack(const Stack &other) : Deque<T>(other) {}
+  Stack(const Stack &other) : Stack() {
+    reserve(other.size_);
+
+    for (size_type i = 0; i < other.size_; ++i) {
+      new (data_ + i) value_type(other.data_[i]);
+      ++size_;
+    }
+  }
 
   /**
    * @brief Move constructor
-   * 
-   * @note Performs a shallow copy of a stack, result is a single stack with resources
-   * stolen from the given stack
-   * 
-   * Using std::move is required here, otherwise container will not be passed as
-   * an r-value
+   *
+   * @note Heap array is stolen, elements of the inline buffer are moved one by
+   * one. Given stack is left empty
   */
-  Stack(Stack &&other) : Deque<T>(std::move(other)) {}
+  Stack(Stack &&other) : Stack() { stealResources(std::move(other)); }
 
   /**
    * @brief Destructor
   */
-  ~Stack() {}
+  ~Stack() { deleteStack(); }
 
   /**
    * @brief Assignment operator overload for moving an object
-   * 
-   * @note The same problem as with move constructor, have to create an r-value
-   * again
   */
-  Stack<value_type>& operator=(Stack<value_type> &&other) {
-    this->Deque<T>::operator=(std::move(other));
+  Stack& operator=(Stack &&other) {
+    if (this == &other) {
+      return *this;
+    }
+
+    deleteStack();
+    stealResources(std::move(other));
 
     return *this;
   }
 
-
 /* ========================================================================= */
-/*                         Methods for modifying a List                      */
+/*                         Methods for modifying a Stack                     */
 /* ========================================================================= */
 
   /**
    * @brief Accesses the top element of the stack
-   * 
+   *
    * @throws ArrayException if stack is empty
   */
-  const_reference top() { return Deque<T>::container_.back(); }
+  reference top() {
+    if (size_ == 0) {
+      throw ArrayException("Stack is empty");
+    }
+
+    return data_[size_ - 1];
+  }
+
+  /**
+   * @brief Accesses the top element of the stack
+   *
+   * @throws ArrayException if stack is empty
+  */
+  const_reference top() const {
+    if (size_ == 0) {
+      throw ArrayException("Stack is empty");
+    }
+
+    return data_[size_ - 1];
+  }
+
+  /**
+   * @brief Inserts an element at the top of the stack
+  */
+  void push(const_reference value) {
+    if (size_ == capacity_) {
+      // value may live inside the stack, copy it before the array moves
+      value_type copy(value);
+      grow(capacity_ * 2);
+      new (data_ + size_) value_type(std::move(copy));
+    } else {
+      new (data_ + size_) value_type(value);
+    }
+
+    ++size_;
+  }
+
+  /**
+   * @brief Inserts an element at the top of the stack
+  */
+  void push(value_type &&value) {
+    if (size_ == capacity_) {
+      value_type temp(std::move(value));
+      grow(capacity_ * 2);
+      new (data_ + size_) value_type(std::move(temp));
+    } else {
+      new (data_ + size_) value_type(std::move(value));
+    }
+
+    ++size_;
+  }
 
   /**
    * @brief Removes the top element from the stack
-   * 
+   *
    * @note If container is empty nothing is done
   */
   void pop() {
-    Deque<T>::container_.popBack();
+    if (size_ > 0) {
+      --size_;
+      data_[size_].~value_type();
+    }
+  }
+
+  /**
+   * @brief Pushes elements of [first, last) in order, the last one ends up on top
+   *
+   * @note Memory for forward ranges is reserved once
+  */
+  template <typename InputIt>
+  void push_many(InputIt first, InputIt last);
+
+  /**
+   * @brief Pushes elements of the list in order, the last one ends up on top
+  */
+  void push_many(std::initializer_list<value_type> const& items) {
+    push_many(items.begin(), items.end());
+  }
+
+  /**
+   * @brief Removes up to n elements from the top and returns how many were removed
+  */
+  size_type pop_n(size_type n);
+
+  /**
+   * @brief Moves up to n elements from the top into out (top element first)
+   * and removes them, returns how many were moved
+  */
+  template <typename OutputIt>
+  size_type pop_n(OutputIt out, size_type n);
+
+  /**
+   * @brief Appends up to max elements from the top to out (top element first)
+   * and removes them, returns how many were moved
+   *
+   * @note Room in out is reserved once for the whole batch
+  */
+  size_type drain(Vector<value_type> &out, size_type max = static_cast<size_type>(-1)) {
+    if (max > size_) {
+      max = size_;
+    }
+
+    reserveMore(out, max);
+
+    return pop_n(std::back_inserter(out), max);
+  }
+
+  /**
+   * @brief Makes room for at least capacity elements
+  */
+  void reserve(size_type capacity) {
+    if (capacity > capacity_) {
+      grow(capacity);
+    }
+  }
+
+  /**
+   * @brief Returns the number of elements in stack
+  */
+  size_type size() const { return size_; }
+
+  /**
+   * @brief Returns true if stack is empty, false otherwise
+  */
+  bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief Returns the number of elements stack can hold without allocating
+  */
+  size_type capacity() const { return capacity_; }
+
+  /**
+   * @brief Swaps the contents of two stacks
+  */
+  void swap(Stack &other) {
+    if (this == &other) {
+      return;
+    }
+
+    Stack temp(std::move(*this));
+
+    *this = std::move(other);
+    other = std::move(temp);
   }
 
   /* ========================================================================= */
@@ -93,17 +259,180 @@ public:
 
   /**
    * @brief Appends new elements to the top of the Stack
-   * 
+   *
    * @note The same thing as insert_many_bacl but for the stack container
   */
   template <typename... Args>
   void insert_many_front(Args&&... args) {
-    Deque<T>::container_.insert_many_back(args...);
+    reserve(size_ + sizeof...(Args));
+    (push(std::forward<Args>(args)), ...);
   }
 
-  // all other methods are inherited from Deque
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  T* inlineData() { return reinterpret_cast<T*>(buffer_); }
+
+  bool isInline() const { return data_ == reinterpret_cast<const T*>(buffer_); }
+
+  /**
+   * @brief Moves elements into a heap array of the given capacity
+  */
+  void grow(size_type capacity);
+
+  /**
+   * @brief Destroys all elements and frees the heap array, stack is left empty
+   * with the inline buffer
+  */
+  void deleteStack();
+
+  /**
+   * @brief Takes elements of other (other must be empty with the inline buffer)
+  */
+  void stealResources(Stack &&other);
 };
 
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename T, size_t N>
+template <typename InputIt>
+void Stack<T, N>::push_many(InputIt first, InputIt last) {
+  if constexpr (MultiPass<InputIt>::value) {
+    reserve(size_ + countRange(first, last));
+  }
+
+  for (; first != last; ++first) {
+    push(*first);
+  }
+}
+
+template <typename T, size_t N>
+typename Stack<T, N>::size_type Stack<T, N>::pop_n(size_type n) {
+  if (n > size_) {
+    n = size_;
+  }
+
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    for (size_type i = 1; i <= n; ++i) {
+      data_[size_ - i].~value_type();
+    }
+  }
+
+  size_ -= n;
+
+  return n;
 }
 
-#endif // S21_STACK_H_
\ No newline at end of file
+template <typename T, size_t N>
+template <typename OutputIt>
+typename Stack<T, N>::size_type Stack<T, N>::pop_n(OutputIt out, size_type n) {
+  if (n > size_) {
+    n = size_;
+  }
+
+  // a local cursor instead of size_, so that writes to out can not alias it
+  T *top = data_ + size_;
+  try {
+    for (size_type i = 0; i < n; ++i) {
+      --top;
+      *out = std::move(*top);
+      ++out;
+
+      if constexpr (!std::is_trivially_destructible<T>::value) {
+        top->~value_type();
+      }
+    }
+  } catch (...) {
+    // elements above top are destroyed already, top itself is still alive
+    size_ = top - data_ + 1;
+    throw;
+  }
+
+  size_ -= n;
+
+  return n;
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+template <typename T, size_t N>
+void Stack<T, N>::grow(size_type capacity) {
+  T *array = static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t(alignof(T))));
+  size_type moved = 0;
+
+  // old elements are destroyed only once all of them are moved. A move that
+  // may throw is not used (elements are copied), so a failure leaves the stack
+  // as it was, without moved-from elements
+  try {
+    for (; moved < size_; ++moved) {
+      new (array + moved) value_type(std::move_if_noexcept(data_[moved]));
+    }
+  } catch (...) {
+    for (size_type i = 0; i < moved; ++i) {
+      array[i].~value_type();
+    }
+
+    ::operator delete(array, std::align_val_t(alignof(T)));
+    throw;
+  }
+
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    for (size_type i = 0; i < size_; ++i) {
+      data_[i].~value_type();
+    }
+  }
+
+  if (!isInline()) {
+    ::operator delete(data_, std::align_val_t(alignof(T)));
+  }
+
+  data_ = array;
+  capacity_ = capacity;
+}
+
+template <typename T, size_t N>
+void Stack<T, N>::deleteStack() {
+  pop_n(size_);
+
+  if (!isInline()) {
+    ::operator delete(data_, std::align_val_t(alignof(T)));
+  }
+
+  data_ = inlineData();
+  capacity_ = kInline;
+}
+
+template <typename T, size_t N>
+void Stack<T, N>::stealResources(Stack &&other) {
+  if (other.isInline()) {
+    for (size_type i = 0; i < other.size_; ++i) {
+      new (data_ + i) value_type(std::move(other.data_[i]));
+    }
+
+    size_ = other.size_;
+    other.pop_n(other.size_);
+
+    return;
+  }
+
+  data_ = other.data_;
+  size_ = other.size_;
+  capacity_ = other.capacity_;
+
+  other.data_ = other.inlineData();
+  other.size_ = 0;
+  other.capacity_ = kInline;
+}
+
+} // namespace s21
+
+#endif // S21_STACK_H_
@@ -0,0 +1,437 @@
+#ifndef S21_STATIC_MAP_H_
+#define S21_STATIC_MAP_H_
+
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "s21_container.h"
+#include "s21_array.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+/**
+ * @brief Hash usable in constant expressions: integers and enums are taken as
+ * they are, strings go through FNV-1a. StaticMap mixes the result itself
+ *
+ * @note Other key types need a hash with a constexpr operator() passed to StaticMap
+*/
+template <typename Key, typename = void>
+struct StaticHash;
+
+template <typename Key>
+struct StaticHash<Key, typename std::enable_if<std::is_integral<Key>::value || std::is_enum<Key>::value>::type> {
+  constexpr uint64_t operator()(Key key) const { return static_cast<uint64_t>(key); }
+};
+
+template <>
+struct StaticHash<std::string_view> {
+  constexpr uint64_t operator()(std::string_view key) const {
+    uint64_t hash = 0xCBF29CE484222325ull;
+
+    for (char c : key) {
+      hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001B3ull;
+    }
+
+    return hash;
+  }
+};
+
+// Implementation of a read-only map of a fixed size with a perfect hash built
+// at compile time
+//
+// Meant for constant tables (opcodes, enum names). A constexpr StaticMap is
+// laid out by the compiler: nothing runs at startup and nothing is allocated,
+// the tables land in read-only data. Hash of a key picks a bucket, the seed
+// found for the bucket while building moves its keys to slots no other key
+// takes (hash and displace). A lookup is a hash, two loads and a single key
+// comparison, no probing and no branches besides the comparison. Every method
+// is constexpr, lookups of constant keys are folded at compile time
+//
+// Elements are kept in the order they were given, iterators walk them so.
+// Dereferenced iterator gives the mapped value, key() gives the key
+
+template <typename Key, typename T, size_t N, typename Hash = StaticHash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class StaticMap : public Container {
+public:
+  // forward declaration for iterators
+  class ConstIterator;
+
+  using Item = std::pair<Key, T>;
+
+private:
+  static_assert(N > 0, "StaticMap needs at least one element");
+
+  // type overrides to make class code easy to understand (really..?)
+  using key_type = Key;
+  using mapped_type = T;
+
+  using const_iterator = ConstIterator;
+
+  using size_type = Container::size_type;
+
+  /**
+   * @brief Number of slots and of buckets: a power of two, at least N and at least 2
+  */
+  static constexpr size_type slotCount() {
+    size_type count = 2;
+
+    while (count < N) {
+      count *= 2;
+    }
+
+    return count;
+  }
+
+  static constexpr size_type kSlots = slotCount();
+
+  // log2(kSlots) top bits of a mixed hash pick a bucket or a slot
+  static constexpr size_type shiftOf() {
+    size_type shift = 64;
+
+    for (size_type count = kSlots; count > 1; count /= 2) {
+      --shift;
+    }
+
+    return shift;
+  }
+
+  static constexpr size_type kShift = shiftOf();
+
+  // seeds tried for one bucket before giving up
+  static constexpr uint64_t kMaxSeed = 1 << 20;
+
+  Array<Key, N> keys_;            // in the given order
+  Array<T, N> values_;            // values_[i] is mapped by keys_[i]
+  Array<uint64_t, kSlots> seeds_; // seed of every bucket
+  Array<size_type, kSlots> slots_; // index of the key in a slot, free slots keep 0
+  Hash hash_;
+  KeyEqual equal_;
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Creates the map from an array of pairs and finds a perfect hash for
+   * its keys. See make_static_map for deducing N
+   *
+   * @note Building is done once by the compiler for a constexpr map, with the
+   * compiler's limit on constexpr steps it is meant for up to a few thousand keys
+   *
+   * @throws ArrayException if a key is given twice or if no seed separates the
+   * keys of a bucket (a compile error for a constexpr map)
+  */
+  constexpr explicit StaticMap(const Item (&items)[N], Hash hash = Hash(), KeyEqual equal = KeyEqual());
+
+  constexpr StaticMap(const StaticMap &other) = default;
+
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Access a specified element with bounds checking
+   *
+   * @throws ArrayException if key is not in the map
+  */
+  constexpr const T& at(const Key &key) const {
+    return values_[find(key).index()];
+  }
+
+  /**
+   * @brief Returns a pointer to the value of the key, nullptr if the key is not
+   * in the map
+  */
+  constexpr const T* lookup(const Key &key) const {
+    const size_type index = findIndex(key);
+
+    return index == N ? nullptr : &values_[index];
+  }
+
+  /**
+   * @brief Finds an element with a specific key in the map
+   *
+   * @throws ArrayException if element with specified key is not in the map
+  */
+  constexpr const_iterator find(const Key &key) const {
+    const size_type index = findIndex(key);
+
+    if (index == N) {
+      throw ArrayException("Element with such key is not in the map");
+    }
+
+    return ConstIterator(*this, index);
+  }
+
+  /**
+   * @brief Checks if the map contains an element with a specific key
+  */
+  constexpr bool contains(const Key &key) const {
+    return findIndex(key) != N;
+  }
+
+
+/* ========================================================================= */
+/*                                Iterators                                  */
+/* ========================================================================= */
+
+  class ConstIterator {
+  private:
+    const StaticMap *map_;
+    size_type index_; // N at the end
+
+  public:
+    /**
+     * @brief Iterator constructor. Sets the current position to the given index
+    */
+    constexpr ConstIterator(const StaticMap &map, size_type index = 0) : map_(&map), index_(index) {}
+
+    /**
+     * @brief Dereferencing operator. Returns a reference to the mapped value
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    constexpr const mapped_type& operator*() const {
+      return map_->values_.at(index_);
+    }
+
+    /**
+     * @brief Returns the key of the element pointed by the iterator
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    constexpr const key_type& key() const {
+      return map_->keys_.at(index_);
+    }
+
+    /**
+     * @brief Position of the element among the given pairs
+    */
+    constexpr size_type index() const {
+      return index_;
+    }
+
+    /**
+     * @brief Increment operator. Moves the iterator to the next element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the end
+    */
+    constexpr ConstIterator& operator++() {
+      if (index_ == N) {
+        throw ArrayException("Cannot increment an iterator at the end");
+      }
+
+      ++index_;
+
+      return *this;
+    }
+
+    /**
+     * @brief Decrement operator. Moves the iterator to the previous element (prefix version)
+     *
+     * @throws ArrayException if iterator is at the beginning
+    */
+    constexpr ConstIterator& operator--() {
+      if (index_ == 0) {
+        throw ArrayException("Cannot decrement an iterator at the beginning");
+      }
+
+      --index_;
+
+      return *this;
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on equality. Returns true
+     * if both iterators point to the same element, false otherwise
+    */
+    constexpr bool operator==(const ConstIterator &other) const {
+      return map_ == other.map_ && index_ == other.index_;
+    }
+
+    /**
+     * @brief Operator for comapring two iterators on unequality. Returns true
+     * if iterators point to different elements, false otherwise
+    */
+    constexpr bool operator!=(const ConstIterator &other) const {
+      return !(*this == other);
+    }
+  };
+
+  constexpr const_iterator begin() const {
+    return ConstIterator(*this);
+  }
+
+  constexpr const_iterator end() const {
+    return ConstIterator(*this, N);
+  }
+
+  constexpr const_iterator cbegin() const {
+    return begin();
+  }
+
+  constexpr const_iterator cend() const {
+    return end();
+  }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Spreads a hash over all 64 bits (splitmix64 finalizer), hashes of
+   * integer keys are the keys themselves
+  */
+  static constexpr uint64_t mix(uint64_t hash) {
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+
+    return hash ^ (hash >> 31);
+  }
+
+  static constexpr size_type bucketOf(uint64_t mixed) {
+    return static_cast<size_type>(mixed >> kShift);
+  }
+
+  static constexpr size_type slotOf(uint64_t mixed, uint64_t seed) {
+    return static_cast<size_type>(((mixed ^ seed) * 0x9E3779B97F4A7C15ull) >> kShift);
+  }
+
+  /**
+   * @brief Index of the key, N if it is not there
+   *
+   * @note A free slot points to the first key: a key landing there is not
+   * equal to it, the first key has a slot of its own
+  */
+  constexpr size_type findIndex(const Key &key) const {
+    const uint64_t mixed = mix(hash_(key));
+    const size_type index = slots_[slotOf(mixed, seeds_[bucketOf(mixed)])];
+
+    return equal_(keys_[index], key) ? index : N;
+  }
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+template <typename Key, typename T, size_t N, typename Hash, typename KeyEqual>
+constexpr StaticMap<Key, T, N, Hash, KeyEqual>::StaticMap(const Item (&items)[N], Hash hash, KeyEqual equal)
+    : keys_(), values_(), seeds_(), slots_(), hash_(hash), equal_(equal) {
+  size_ = N;
+
+  Array<uint64_t, N> mixed;
+
+  for (size_type i = 0; i < N; ++i) {
+    keys_[i] = items[i].first;
+    values_[i] = items[i].second;
+    mixed[i] = mix(hash_(keys_[i]));
+
+    for (size_type j = 0; j < i; ++j) {
+      if (equal_(keys_[j], keys_[i])) {
+        throw ArrayException("StaticMap keys must be unique");
+      }
+    }
+  }
+
+  // keys grouped by bucket: bucket b holds members[start[b]] .. members[start[b + 1] - 1]
+  Array<size_type, kSlots + 1> start;
+  Array<size_type, N> members;
+
+  for (size_type i = 0; i < N; ++i) {
+    ++start[bucketOf(mixed[i]) + 1];
+  }
+
+  for (size_type b = 0; b < kSlots; ++b) {
+    start[b + 1] += start[b];
+  }
+
+  Array<size_type, kSlots + 1> filled = start;
+
+  for (size_type i = 0; i < N; ++i) {
+    members[filled[bucketOf(mixed[i])]++] = i;
+  }
+
+  // the biggest buckets are placed first, while most slots are still free
+  Array<size_type, kSlots> order;
+
+  for (size_type b = 0; b < kSlots; ++b) {
+    size_type j = b;
+
+    for (; j > 0 && start[b + 1] - start[b] > start[order[j - 1] + 1] - start[order[j - 1]]; --j) {
+      order[j] = order[j - 1];
+    }
+
+    order[j] = b;
+  }
+
+  Array<bool, kSlots> taken;
+
+  for (size_type b : order) {
+    if (start[b] == start[b + 1]) {
+      break;
+    }
+
+    uint64_t seed = 0;
+    bool placed = false;
+
+    while (!placed) {
+      if (++seed > kMaxSeed) {
+        throw ArrayException("StaticMap could not find a perfect hash for the keys");
+      }
+
+      placed = true;
+
+      for (size_type m = start[b]; m < start[b + 1] && placed; ++m) {
+        const size_type slot = slotOf(mixed[members[m]], seed);
+
+        // a slot taken by another bucket or by a key of this one before
+        for (size_type k = start[b]; k < m && placed; ++k) {
+          placed = slotOf(mixed[members[k]], seed) != slot;
+        }
+
+        placed = placed && !taken[slot];
+      }
+    }
+
+    seeds_[b] = seed;
+
+    for (size_type m = start[b]; m < start[b + 1]; ++m) {
+      const size_type slot = slotOf(mixed[members[m]], seed);
+
+      taken[slot] = true;
+      slots_[slot] = members[m];
+    }
+  }
+}
+
+
+/* ========================================================================= */
+/*                                  Helpers                                  */
+/* ========================================================================= */
+
+/**
+ * @brief Creates a StaticMap, N is the number of the pairs given:
+ * constexpr auto map = make_static_map<std::string_view, int>({ {"add", 1}, {"sub", 2} });
+*/
+template <typename Key, typename T, typename Hash = StaticHash<Key>, typename KeyEqual = std::equal_to<Key>,
+          size_t N>
+constexpr StaticMap<Key, T, N, Hash, KeyEqual> make_static_map(const std::pair<Key, T> (&items)[N],
+                                                               Hash hash = Hash(), KeyEqual equal = KeyEqual()) {
+  return StaticMap<Key, T, N, Hash, KeyEqual>(items, hash, equal);
+}
+
+} // namespace s21
+
+#endif // S21_STATIC_MAP_H_
@@ -0,0 +1,394 @@
+#ifndef S21_THREAD_POOL_H_
+#define S21_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "s21_mpmc_queue.h"
+#include "s21_work_stealing_deque.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a work-stealing thread pool
+//
+// Every worker owns a WorkStealingDeque. Tasks submitted from a worker (nested
+// tasks, chunks of a nested parallel_for) go to its own deque, so there is no
+// shared queue everyone fights for. Tasks submitted from outside go to a bounded
+// MpmcQueue. A worker without tasks steals the oldest task of a random victim,
+// then looks into the shared queue, and only then parks.
+//
+// Threads that wait for results (parallel_for, wait) do not just sleep, they
+// run tasks themselves while waiting
+
+class ThreadPool {
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using size_type = size_t;
+
+  using Task = std::function<void()>;
+
+  // capacity of the queue for tasks submitted from outside the pool
+  static constexpr size_type kInjectionCapacity = 1024;
+
+  // number of empty rounds before a worker parks
+  static constexpr int kSpinTries = 64;
+
+  struct Worker {
+    WorkStealingDeque<Task*> deque_;
+    std::thread thread_;
+  };
+
+  // pool and index of the worker the current thread is (if any), running_
+  // is set while any thread (outside helpers too) executes a task of a pool
+  struct CurrentWorker {
+    ThreadPool *pool_ = nullptr;
+    ThreadPool *running_ = nullptr;
+    size_type index_ = 0;
+    unsigned random_ = 2463534242u;
+  };
+
+  std::vector<Worker*> workers_;
+  MpmcQueue<Task*> injection_{ kInjectionCapacity };
+
+  // queued_ counts tasks nobody has taken yet (wakes up workers),
+  // pending_ counts tasks that are not finished yet (used by wait)
+  std::atomic<int64_t> queued_{ 0 };
+  std::atomic<int64_t> pending_{ 0 };
+  std::atomic<size_type> sleeping_{ 0 };
+  std::atomic<bool> stop_{ false };
+
+  std::mutex mutex_;
+  std::condition_variable work_available_;
+  std::condition_variable all_done_;
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Starts threads_count worker threads (all cores by default)
+  */
+  explicit ThreadPool(size_type threads_count = std::thread::hardware_concurrency());
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**
+   * @brief Destructor. Finishes all submitted tasks and joins the workers
+  */
+  ~ThreadPool();
+
+/* ========================================================================= */
+/*                               Main Methods                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Schedules a task for execution
+   *
+   * @note Task should not throw, an exception escaping a task terminates the
+   * program (just like with std::thread)
+  */
+  template <typename Func>
+  void submit(Func &&func) {
+    schedule(new Task(std::forward<Func>(func)));
+  }
+
+  /**
+   * @brief Calls func(i) for every i in [first, last) on all workers and
+   * returns when all calls are finished
+   *
+   * @note Range is cut into chunks of grain indices (by default about four
+   * chunks per worker). Can be called from inside a task. The first
+   * exception thrown by func is rethrown here after all chunks are done
+  */
+  template <typename Func>
+  void parallel_for(size_type first, size_type last, Func func, size_type grain = 0);
+
+  /**
+   * @brief Waits until all submitted tasks are finished, runs tasks meanwhile
+   *
+   * @throws ArrayException if called from a task of this pool (it would wait
+   * for itself), use parallel_for for nested waiting
+  */
+  void wait();
+
+  /**
+   * @brief Returns the number of worker threads
+  */
+  size_type size() const { return workers_.size(); }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  static CurrentWorker& current() {
+    thread_local CurrentWorker worker;
+    return worker;
+  }
+
+  /**
+   * @brief Puts a task into the deque of the current worker or into the
+   * shared queue and wakes a parked worker if there is one
+  */
+  void schedule(Task *task);
+
+  /**
+   * @brief Finds a task: own deque first, then other workers, then the shared queue
+  */
+  bool findTask(Task *&task);
+
+  /**
+   * @brief Runs a task taken by findTask and deletes it
+  */
+  void run(Task *task);
+
+  /**
+   * @brief Main loop of a worker thread
+  */
+  void workerLoop(size_type index);
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+inline ThreadPool::ThreadPool(size_type threads_count) {
+  if (threads_count == 0) {
+    threads_count = 1;
+  }
+
+  // deques must all exist before any worker starts stealing
+  for (size_type i = 0; i < threads_count; ++i) {
+    workers_.push_back(new Worker());
+  }
+
+  for (size_type i = 0; i < threads_count; ++i) {
+    workers_[i]->thread_ = std::thread([this, i]() { workerLoop(i); });
+  }
+}
+
+inline ThreadPool::~ThreadPool() {
+  if (current().pool_ != this && current().running_ != this) {
+    wait();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_.store(true, std::memory_order_seq_cst);
+    work_available_.notify_all();
+  }
+
+  // others can still be stealing from a deque until they are joined too
+  for (Worker *worker : workers_) {
+    worker->thread_.join();
+  }
+
+  for (Worker *worker : workers_) {
+    delete worker;
+  }
+}
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename Func>
+void ThreadPool::parallel_for(size_type first, size_type last, Func func, size_type grain) {
+  if (first >= last) {
+    return;
+  }
+
+  const size_type count = last - first;
+
+  if (grain == 0) {
+    grain = count / (size() * 4);
+    grain = grain == 0 ? 1 : grain;
+  }
+
+  std::atomic<size_type> chunks_left{ (count + grain - 1) / grain };
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  for (size_type begin = first; begin < last; begin += grain) {
+    size_type end = last - begin > grain ? begin + grain : last;
+
+    submit([&, begin, end]() {
+      try {
+        for (size_type i = begin; i < end; ++i) {
+          func(i);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+
+      chunks_left.fetch_sub(1, std::memory_order_release);
+    });
+  }
+
+  // help instead of sleeping, this also makes nested parallel_for safe
+  Task *task = nullptr;
+  while (chunks_left.load(std::memory_order_acquire) > 0) {
+    if (findTask(task)) {
+      run(task);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+inline void ThreadPool::wait() {
+  if (current().pool_ == this || current().running_ == this) {
+    throw ArrayException("ThreadPool::wait cannot be called from its own task");
+  }
+
+  Task *task = nullptr;
+  for (int i = 0; i < kSpinTries && pending_.load(std::memory_order_acquire) > 0; ++i) {
+    if (findTask(task)) {
+      run(task);
+      i = 0;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  all_done_.wait(lock, [this]() { return pending_.load(std::memory_order_acquire) == 0; });
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+inline void ThreadPool::schedule(Task *task) {
+  pending_.fetch_add(1, std::memory_order_relaxed);
+
+  CurrentWorker &worker = current();
+  if (worker.pool_ == this) {
+    workers_[worker.index_]->deque_.push(task);
+  } else {
+    injection_.push(task);
+  }
+
+  // seq_cst pair with the parking worker: either it sees queued_ > 0 or we see it sleeping
+  queued_.fetch_add(1, std::memory_order_seq_cst);
+
+  if (sleeping_.load(std::memory_order_seq_cst) > 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    work_available_.notify_one();
+  }
+}
+
+inline bool ThreadPool::findTask(Task *&task) {
+  CurrentWorker &worker = current();
+  const size_type count = workers_.size();
+  bool found = false;
+
+  if (worker.pool_ == this && workers_[worker.index_]->deque_.pop(task)) {
+    found = true;
+  }
+
+  // xorshift picks the first victim, so that thieves do not all line up
+  // behind the same worker
+  if (!found) {
+    worker.random_ ^= worker.random_ << 13;
+    worker.random_ ^= worker.random_ >> 17;
+    worker.random_ ^= worker.random_ << 5;
+
+    size_type start = worker.random_ % count;
+    for (size_type i = 0; i < count && !found; ++i) {
+      size_type victim = (start + i) % count;
+      if (worker.pool_ != this || victim != worker.index_) {
+        found = workers_[victim]->deque_.steal(task);
+      }
+    }
+  }
+
+  if (!found) {
+    found = injection_.try_pop(task);
+  }
+
+  if (found) {
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  return found;
+}
+
+inline void ThreadPool::run(Task *task) {
+  CurrentWorker &worker = current();
+  ThreadPool *outer = worker.running_;
+
+  worker.running_ = this;
+  (*task)();
+  worker.running_ = outer;
+
+  delete task;
+
+  if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    all_done_.notify_all();
+  }
+}
+
+inline void ThreadPool::workerLoop(size_type index) {
+  CurrentWorker &worker = current();
+  worker.pool_ = this;
+  worker.index_ = index;
+  worker.random_ += static_cast<unsigned>(index) * 7919u;
+
+  Task *task = nullptr;
+  int idle = 0;
+
+  while (true) {
+    if (findTask(task)) {
+      run(task);
+      idle = 0;
+      continue;
+    }
+
+    if (++idle < kSpinTries) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    sleeping_.fetch_add(1, std::memory_order_seq_cst);
+    work_available_.wait(lock, [this]() {
+      return queued_.load(std::memory_order_seq_cst) > 0 || stop_.load(std::memory_order_acquire);
+    });
+    sleeping_.fetch_sub(1, std::memory_order_relaxed);
+
+    if (stop_.load(std::memory_order_acquire) && queued_.load(std::memory_order_acquire) <= 0) {
+      return;
+    }
+
+    idle = 0;
+  }
+}
+
+} // namespace s21
+
+#endif  // S21_THREAD_POOL_H_
@@ -0,0 +1,440 @@
+#ifndef S21_TIMING_WHEEL_H_
+#define S21_TIMING_WHEEL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "s21_container.h"
+#include "s21_intrusive_list.h"
+#include "s21_node_pool.h"
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a hierarchical timing wheel
+//
+// Time is a 64 bit tick counter. Wheel has kLevels levels of 64 slots, level l
+// covers bits [6l, 6l + 6) of a deadline. Timer goes to the level of the
+// highest bit its deadline differs from now() in, and to the slot given by
+// the deadline bits of that level. Every slot is an IntrusiveList (the same
+// circular design with a barrier node as List), so schedule and cancel are
+// O(1) and do not allocate: timers live in blocks of nodes that are reused.
+//
+// advance() jumps straight to the next occupied slot (bit masks of occupied
+// slots make it a couple of instructions per level) and empties it: timers
+// of a higher level are spread over lower levels, timers that are due go to
+// the expired list and are fired. Every timer moves at most once per level
+
+template <typename T>
+class TimingWheel : public Container {
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using tick_type = uint64_t;
+
+  static constexpr int kSlotBits = 6;
+  static constexpr size_type kSlots = size_type(1) << kSlotBits;
+  static constexpr size_type kLevels = (64 + kSlotBits - 1) / kSlotBits;
+
+  struct Timer {
+    IntrusiveListHook hook_;
+
+    union {
+      tick_type deadline_; // while the timer is scheduled
+      Timer *next_free_;   // while the node is in the free list
+    };
+
+    value_type value_;
+
+    Timer(tick_type deadline, const_reference value) : deadline_{ deadline }, value_{ value } {}
+  };
+
+  using Bucket = IntrusiveList<Timer, &Timer::hook_>;
+
+  Bucket slots_[kLevels][kSlots];
+  uint64_t occupied_[kLevels] = {}; // bit i is set if slot i of the level is not empty
+  Bucket expired_;                  // timers that are due, fired by advance
+
+  tick_type now_;
+
+  // the same block allocation as in List, refills of up to 1024 nodes
+  NodePool<Timer, &Timer::next_free_, 1024> pool_;
+
+public:
+
+  /**
+   * @brief Identifies a scheduled timer
+   *
+   * @note Handle is valid until its timer fires or is cancelled, after that
+   * the node can be given to another timer
+  */
+  class Handle {
+    friend class TimingWheel;
+
+    Timer *timer_;
+
+    explicit Handle(Timer *timer) : timer_{ timer } {}
+
+  public:
+    /**
+     * @brief Creates a handle that does not belong to any timer
+    */
+    Handle() : timer_{ nullptr } {}
+
+    bool operator==(const Handle &other) const { return timer_ == other.timer_; }
+
+    bool operator!=(const Handle &other) const { return timer_ != other.timer_; }
+  };
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Creates an empty wheel with the current time set to now
+  */
+  explicit TimingWheel(tick_type now = 0) : now_{ now } {}
+
+  /**
+   * @note Wheel cannot be copied: handles of the copy would point into the original
+  */
+  TimingWheel(const TimingWheel&) = delete;
+  TimingWheel& operator=(const TimingWheel&) = delete;
+
+  /**
+   * @brief Destructor. Destroys all timers without firing them
+  */
+  ~TimingWheel();
+
+/* ========================================================================= */
+/*                              Main Methods                                 */
+/* ========================================================================= */
+
+  /**
+   * @brief Schedules a timer in O(1) and returns its handle
+   *
+   * @note Deadline in the past is the same as now(): timer fires on the next advance
+  */
+  Handle schedule(tick_type deadline, const_reference value);
+
+  /**
+   * @brief Moves a scheduled timer to a new deadline in O(1)
+   *
+   * @return false if the timer has already fired or was cancelled
+  */
+  bool reschedule(Handle handle, tick_type deadline);
+
+  /**
+   * @brief Removes a timer without firing it in O(1)
+   *
+   * @return false if the timer has already fired or was cancelled
+  */
+  bool cancel(Handle handle);
+
+  /**
+   * @brief Moves the current time forward to now and calls func(value) for
+   * every timer with deadline <= now, in order of deadlines
+   *
+   * @note Timer is removed before func is called, so func can schedule and
+   * cancel timers. Timers that func schedules at or before now fire during
+   * the same call. If now is behind the current time only timers that are
+   * already due are fired
+   *
+   * @return the number of fired timers
+  */
+  template <typename Func>
+  size_type advance(tick_type now, Func func);
+
+  /**
+   * @brief Returns the current time
+  */
+  tick_type now() const { return now_; }
+
+  /**
+   * @brief Returns the deadline of a scheduled timer
+   *
+   * @throws ArrayException if the timer has already fired or was cancelled
+  */
+  tick_type deadline(Handle handle) const;
+
+  /**
+   * @brief Removes all timers without firing them, all handles become invalid
+  */
+  void clear();
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Returns true if the handle points to a scheduled timer
+  */
+  static bool scheduled(Handle handle) {
+    return handle.timer_ != nullptr && Bucket::isLinked(*handle.timer_);
+  }
+
+  /**
+   * @brief Puts a timer into the bucket its deadline belongs to
+  */
+  void place(Timer &timer);
+
+  /**
+   * @brief Unlinks a timer from the bucket it is in
+  */
+  void unlink(Timer &timer);
+
+  /**
+   * @brief Finds the closest occupied slot in the future
+   *
+   * @return false if there are no timers in the slots
+  */
+  bool nextSlot(tick_type &time, size_type &level, size_type &slot) const;
+
+  /**
+   * @brief Fires all timers of the expired list
+  */
+  template <typename Func>
+  size_type fireExpired(Func &func);
+
+  Timer* acquireTimer(tick_type deadline, const_reference value);
+
+  void releaseTimer(Timer *timer);
+
+  void destroyTimers(Bucket &bucket);
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+template <typename T>
+TimingWheel<T>::~TimingWheel() {
+  clear();
+}
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename T>
+typename TimingWheel<T>::Handle TimingWheel<T>::schedule(tick_type deadline, const_reference value) {
+  Timer *timer = acquireTimer(deadline, value);
+
+  place(*timer);
+  ++(this->size_);
+
+  return Handle(timer);
+}
+
+template <typename T>
+bool TimingWheel<T>::reschedule(Handle handle, tick_type deadline) {
+  if (!scheduled(handle)) {
+    return false;
+  }
+
+  unlink(*handle.timer_);
+  handle.timer_->deadline_ = deadline;
+  place(*handle.timer_);
+
+  return true;
+}
+
+template <typename T>
+bool TimingWheel<T>::cancel(Handle handle) {
+  if (!scheduled(handle)) {
+    return false;
+  }
+
+  unlink(*handle.timer_);
+  releaseTimer(handle.timer_);
+  --(this->size_);
+
+  return true;
+}
+
+template <typename T>
+template <typename Func>
+typename TimingWheel<T>::size_type TimingWheel<T>::advance(tick_type now, Func func) {
+  size_type fired = fireExpired(func);
+
+  tick_type time = 0;
+  size_type level = 0;
+  size_type slot = 0;
+
+  while (nextSlot(time, level, slot) && time <= now) {
+    now_ = time;
+
+    // timers of the slot share all bits above this level with now_, so they
+    // either are due or go to lower levels
+    Bucket &bucket = slots_[level][slot];
+    occupied_[level] &= ~(uint64_t(1) << slot);
+
+    while (!bucket.empty()) {
+      Timer &timer = bucket.front();
+      bucket.popFront();
+      place(timer);
+    }
+
+    fired += fireExpired(func);
+  }
+
+  // no occupied slot lies between now_ and now, so jumping there keeps
+  // every timer in its level
+  if (now > now_) {
+    now_ = now;
+  }
+
+  return fired;
+}
+
+template <typename T>
+typename TimingWheel<T>::tick_type TimingWheel<T>::deadline(Handle handle) const {
+  if (!scheduled(handle)) {
+    throw ArrayException("Timer is not scheduled");
+  }
+
+  return handle.timer_->deadline_;
+}
+
+template <typename T>
+void TimingWheel<T>::clear() {
+  for (size_type level = 0; level < kLevels; ++level) {
+    for (size_type slot = 0; slot < kSlots; ++slot) {
+      destroyTimers(slots_[level][slot]);
+    }
+
+    occupied_[level] = 0;
+  }
+
+  destroyTimers(expired_);
+
+  this->size_ = 0;
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+template <typename T>
+void TimingWheel<T>::place(Timer &timer) {
+  if (timer.deadline_ <= now_) {
+    expired_.pushBack(timer);
+    return;
+  }
+
+  const int high_bit = 63 - __builtin_clzll(timer.deadline_ ^ now_);
+  const size_type level = static_cast<size_type>(high_bit / kSlotBits);
+  const size_type slot = static_cast<size_type>(timer.deadline_ >> (level * kSlotBits)) & (kSlots - 1);
+
+  slots_[level][slot].pushBack(timer);
+  occupied_[level] |= uint64_t(1) << slot;
+}
+
+template <typename T>
+void TimingWheel<T>::unlink(Timer &timer) {
+  if (timer.deadline_ <= now_) {
+    expired_.remove(timer);
+    return;
+  }
+
+  // levels do not change while now_ moves (see advance), so the bucket is
+  // found the same way as in place
+  const int high_bit = 63 - __builtin_clzll(timer.deadline_ ^ now_);
+  const size_type level = static_cast<size_type>(high_bit / kSlotBits);
+  const size_type slot = static_cast<size_type>(timer.deadline_ >> (level * kSlotBits)) & (kSlots - 1);
+
+  Bucket &bucket = slots_[level][slot];
+  bucket.remove(timer);
+
+  if (bucket.empty()) {
+    occupied_[level] &= ~(uint64_t(1) << slot);
+  }
+}
+
+template <typename T>
+bool TimingWheel<T>::nextSlot(tick_type &time, size_type &level, size_type &slot) const {
+  // occupied slots are always ahead of the digit of now_ at their level, and
+  // a lower level always comes first: its slots end before the next digit of
+  // the level above
+  for (level = 0; level < kLevels; ++level) {
+    const size_type shift = level * kSlotBits;
+    const size_type digit = static_cast<size_type>(now_ >> shift) & (kSlots - 1);
+
+    const uint64_t ahead = digit == kSlots - 1 ? 0 : occupied_[level] & (~uint64_t(0) << (digit + 1));
+    if (ahead == 0) {
+      continue;
+    }
+
+    slot = static_cast<size_type>(__builtin_ctzll(ahead));
+
+    const size_type upper = shift + kSlotBits;
+    const tick_type base = upper >= 64 ? 0 : (now_ >> upper) << upper;
+    time = base + (static_cast<tick_type>(slot) << shift);
+
+    return true;
+  }
+
+  return false;
+}
+
+template <typename T>
+template <typename Func>
+typename TimingWheel<T>::size_type TimingWheel<T>::fireExpired(Func &func) {
+  size_type fired = 0;
+
+  while (!expired_.empty()) {
+    Timer *timer = &expired_.front();
+    expired_.popFront();
+
+    // node is released before the call, func may schedule into it or throw
+    value_type value = std::move(timer->value_);
+    releaseTimer(timer);
+    --(this->size_);
+    ++fired;
+
+    func(value);
+  }
+
+  return fired;
+}
+
+template <typename T>
+typename TimingWheel<T>::Timer* TimingWheel<T>::acquireTimer(tick_type deadline, const_reference value) {
+  // nodes are raw memory until a timer is constructed in them
+  Timer *timer = pool_.acquire(this->size());
+
+  try {
+    return new (timer) Timer(deadline, value);
+  } catch (...) {
+    pool_.release(timer);
+    throw;
+  }
+}
+
+template <typename T>
+void TimingWheel<T>::releaseTimer(Timer *timer) {
+  timer->~Timer();
+  pool_.release(timer);
+}
+
+template <typename T>
+void TimingWheel<T>::destroyTimers(Bucket &bucket) {
+  while (!bucket.empty()) {
+    Timer *timer = &bucket.front();
+    bucket.popFront();
+    releaseTimer(timer);
+  }
+}
+
+} // namespace s21
+
+#endif  // S21_TIMING_WHEEL_H_
@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <iostream>
+#include <utility>
 
 #include "../array_exception.h"
 #include "s21_container.h"
@@ -79,6 +80,8 @@ class Vector : public Container {
 
   pointer data() { return arr_; }
 
+  const T *data() const { return arr_; }
+
   iterator begin() { return iterator{arr_}; }
   iterator end() { return iterator{arr_ + size_}; }
 
@@ -98,8 +101,9 @@ class Vector : public Container {
   void shrink_to_fit();
 
   void clear() {
+    // slots stay alive until delete[], so only old values are released
     for (size_type i = 0; i < size_; ++i) {
-      arr_[i].~value_type();
+      arr_[i] = value_type();
     }
 
     size_ = 0;
@@ -249,6 +253,11 @@ template <typename value_type>
 Vector<value_type>::Vector(const Vector &v) {
   size_ = v.size_;
   capacity_ = v.capacity_;
+  arr_ = nullptr;
+
+  if (capacity_ == 0) { // nothing to copy, an empty vector does not allocate
+    return;
+  }
 
   arr_ = new value_type[capacity_];
 
@@ -287,8 +296,9 @@ void Vector<value_type>::reserve(size_type size) {
 
   value_type *newarr = new value_type[size];
 
+  // old slots are deleted right after, elements are moved, not copied
   for (size_t i = 0; i < size_; ++i) {
-    newarr[i] = arr_[i];
+    newarr[i] = std::move(arr_[i]);
   }
 
   delete[] arr_;
@@ -303,7 +313,7 @@ void Vector<value_type>::shrink_to_fit() {
     value_type *newarr = new value_type[size_];
 
     for (size_t i = 0; i < size_; ++i) {
-      newarr[i] = arr_[i];
+      newarr[i] = std::move(arr_[i]);
     }
 
     delete[] arr_;
@@ -344,7 +354,7 @@ void Vector<value_type>::erase(iterator pos) {
     arr_[size_ - dist + i] = arr_[size_ - dist + i + 1];
   }
 
-  arr_[size_ - 1].~value_type();
+  arr_[size_ - 1] = value_type();
   --size_;
 }
 
@@ -364,7 +374,7 @@ void Vector<value_type>::push_back(const_reference value) {
 template <typename value_type>
 void Vector<value_type>::pop_back() {
   if (size_ > 0) {
-    arr_[size_ - 1].~value_type();
+    arr_[size_ - 1] = value_type();
     --size_;
   }
 }
@@ -427,6 +437,23 @@ typename s21::Vector<value_type>::iterator Vector<value_type>::insert_many(
   return iter;
 }
 
+
+/* ========================================================================= */
+/*                                  Helpers                                  */
+/* ========================================================================= */
+
+/**
+ * @brief Makes room for n more elements in the vector. Capacity at least
+ * doubles, so that many small batches appended to one vector stay linear
+*/
+template <typename T>
+void reserveMore(Vector<T> &vector, size_t n) {
+  if (vector.size() + n > vector.capacity()) {
+    const size_t doubled = vector.capacity() * 2;
+    vector.reserve(vector.size() + n > doubled ? vector.size() + n : doubled);
+  }
+}
+
 }  // namespace s21
 
 #endif  // S21_VECTOR_H_
\ No newline at end of file
@@ -0,0 +1,283 @@
+#ifndef S21_WORK_STEALING_DEQUE_H_
+#define S21_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "../array_exception.h"
+
+namespace s21 {
+
+// Implementation of a Chase-Lev work-stealing deque
+//
+// One thread owns the deque and works at the bottom end like with a stack:
+// push and pop there cost a couple of plain loads and stores. Any other thread
+// can steal from the top end, thieves fight with each other (and with the owner
+// for the very last element) through a compare-and-swap on top_.
+//
+// Elements are kept in a circular array that grows when it gets full. Thieves
+// can still be reading the old array, so old arrays are kept until the deque
+// is destroyed (each one is half the size of the next, so it is at most as
+// much memory as the current array). Elements are copied with plain atomic
+// loads and stores, that is why T has to be trivially copyable (pointers to
+// tasks usually)
+
+template <typename T>
+class WorkStealingDeque { // does not inherit from Container, size is shared between threads
+  static_assert(std::is_trivially_copyable<T>::value,
+                "WorkStealingDeque stores only trivially copyable elements");
+
+private:
+  // type overrides to make class code easy to understand (really..?)
+  using size_type = size_t;
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+
+  static constexpr size_type kCacheLine = 64;
+
+  struct Array {
+    int64_t mask_;
+    std::atomic<value_type> *slots_;
+
+    explicit Array(int64_t capacity) : mask_{ capacity - 1 } {
+      slots_ = new std::atomic<value_type>[capacity];
+    }
+
+    ~Array() { delete[] slots_; }
+
+    int64_t capacity() const { return mask_ + 1; }
+
+    value_type get(int64_t i) const { return slots_[i & mask_].load(std::memory_order_relaxed); }
+
+    void put(int64_t i, value_type value) { slots_[i & mask_].store(value, std::memory_order_relaxed); }
+  };
+
+  // top_ is where thieves take from, bottom_ is where the owner works
+  alignas(kCacheLine) std::atomic<int64_t> top_{ 0 };
+  alignas(kCacheLine) std::atomic<int64_t> bottom_{ 0 };
+  std::atomic<Array*> array_;
+
+  std::vector<Array*> retired_; // old arrays, touched by the owner only
+
+public:
+
+/* ========================================================================= */
+/*                       Constructors and Destructors                        */
+/* ========================================================================= */
+
+  /**
+   * @brief Creates an empty deque with room for capacity elements
+   *
+   * @note Capacity is rounded up to a power of two, deque grows when it is full
+   *
+   * @throws ArrayException if capacity is zero
+  */
+  explicit WorkStealingDeque(size_type capacity = 64);
+
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+  /**
+   * @brief Destructor. Frees the current and all old arrays
+   *
+   * @note No other thread should use the deque at this point
+  */
+  ~WorkStealingDeque();
+
+/* ========================================================================= */
+/*                            Owner Thread Methods                           */
+/* ========================================================================= */
+
+  /**
+   * @brief Inserts an element at the bottom, grows the array if it is full
+  */
+  void push(value_type value);
+
+  /**
+   * @brief Takes the last pushed element into out
+   *
+   * @return false if the deque is empty (or a thief took the last element),
+   * out is not changed then
+  */
+  bool pop(reference out);
+
+/* ========================================================================= */
+/*                               Thief Methods                               */
+/* ========================================================================= */
+
+  /**
+   * @brief Takes the oldest element into out, can be called from any thread
+   *
+   * @return false if the deque is empty or another thread won the race for
+   * the element
+  */
+  bool steal(reference out);
+
+/* ========================================================================= */
+/*                                Information                                */
+/* ========================================================================= */
+
+  /**
+   * @brief Returns the number of elements
+   *
+   * @note Under concurrent modifications the value may already be outdated
+  */
+  size_type size() const {
+    int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    int64_t top = top_.load(std::memory_order_relaxed);
+
+    return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+  }
+
+  /**
+   * @brief Returns true if the deque is empty (see the note for size)
+  */
+  bool empty() const { return size() == 0; }
+
+  /**
+   * @brief Returns the number of elements the current array can hold
+  */
+  size_type capacity() const {
+    return static_cast<size_type>(array_.load(std::memory_order_relaxed)->capacity());
+  }
+
+/* ========================================================================= */
+/*                          Helper Private Methods                           */
+/* ========================================================================= */
+
+private:
+
+  /**
+   * @brief Moves elements [top, bottom) into an array twice as big
+  */
+  Array* grow(Array *old, int64_t top, int64_t bottom);
+};
+
+
+/* ========================================================================= */
+/*                       Constructors Implementation                         */
+/* ========================================================================= */
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(size_type capacity) {
+  if (capacity == 0) {
+    throw ArrayException("Deque capacity should be positive");
+  }
+
+  int64_t rounded = 1;
+  while (static_cast<size_type>(rounded) < capacity) {
+    rounded <<= 1;
+  }
+
+  array_.store(new Array(rounded), std::memory_order_relaxed);
+}
+
+template <typename T>
+WorkStealingDeque<T>::~WorkStealingDeque() {
+  delete array_.load(std::memory_order_relaxed);
+
+  for (Array *old : retired_) {
+    delete old;
+  }
+}
+
+
+/* ========================================================================= */
+/*                         Interface Implementation                          */
+/* ========================================================================= */
+
+template <typename T>
+void WorkStealingDeque<T>::push(value_type value) {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  int64_t top = top_.load(std::memory_order_acquire);
+  Array *array = array_.load(std::memory_order_relaxed);
+
+  if (bottom - top > array->mask_) {
+    array = grow(array, top, bottom);
+  }
+
+  array->put(bottom, value);
+
+  // element must be visible before thieves see the new bottom
+  bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::pop(reference out) {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Array *array = array_.load(std::memory_order_relaxed);
+
+  // bottom is reserved first, then top is checked: seq_cst pair makes sure
+  // that a thief and the owner cannot both miss each other
+  bottom_.store(bottom, std::memory_order_seq_cst);
+  int64_t top = top_.load(std::memory_order_seq_cst);
+
+  if (top > bottom) { // deque was empty
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return false;
+  }
+
+  value_type value = array->get(bottom);
+
+  if (top == bottom) { // last element, race with thieves for it
+    bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                            std::memory_order_relaxed);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+
+    if (!won) {
+      return false; // a thief took it, out is left as it was
+    }
+  }
+
+  out = value;
+  return true;
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::steal(reference out) {
+  int64_t top = top_.load(std::memory_order_seq_cst);
+  int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+
+  if (top >= bottom) {
+    return false;
+  }
+
+  Array *array = array_.load(std::memory_order_acquire);
+  value_type value = array->get(top);
+
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    return false; // someone else took it
+  }
+
+  out = value;
+  return true;
+}
+
+
+/* ========================================================================= */
+/*                    Private Helper Methods Implementation                  */
+/* ========================================================================= */
+
+template <typename T>
+typename WorkStealingDeque<T>::Array*
+    WorkStealingDeque<T>::grow(Array *old, int64_t top, int64_t bottom) {
+  Array *array = new Array(old->capacity() * 2);
+
+  for (int64_t i = top; i < bottom; ++i) {
+    array->put(i, old->get(i));
+  }
+
+  retired_.push_back(old);
+  array_.store(array, std::memory_order_release);
+
+  return array;
+}
+
+} // namespace s21
+
+#endif  // S21_WORK_STEALING_DEQUE_H_
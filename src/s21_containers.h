@@ -14,7 +14,8 @@
 #include "lib_src/s21_map.h"
 #include "lib_src/s21_set.h"
 
-// other containers (Queue and Stack inherit from Deque, Deque does not inherit Container)
+// other containers (Queue inherits from Deque, Stack keeps elements in its own
+// inline buffer, neither of them inherits Container)
 #include "lib_src/s21_queue.h"
 #include "lib_src/s21_stack.h"
 
@@ -2,12 +2,63 @@
 #define S21_CONTAINERSPLUS_H_
 
 // additional collections
-// include array, multiset
+// include array, static map, multiset, multimap, btree map, hash map, hash set, flat map, flat set, flat multiset, frozen set, frozen map,
+// priority queue, pairing heap, radix heap, intrusive list, timing wheel,
+// concurrent list, concurrent stack, concurrent hash map, spsc queue, mpmc queue, work-stealing deque, thread pool, channel (C++20)
 
 // sequential containers (inherit directly from SequentialContainer)
 #include "lib_src/s21_array.h"
 
+// read-only map built at compile time (perfect hash over Arrays, constexpr)
+#include "lib_src/s21_static_map.h"
+
 // associative containers (inherit directly from AssociativeContainer)
 #include "lib_src/s21_multiset.h"
+#include "lib_src/s21_multimap.h"
+
+// associative containers on a B+ tree (many keys per node, linked leaves)
+#include "lib_src/s21_btree_map.h"
+
+// unordered associative containers (open addressing, inherit from HashTable)
+#include "lib_src/s21_hash_map.h"
+#include "lib_src/s21_hash_set.h"
+
+// sorted vector containers (binary search, inherit from FlatBase)
+#include "lib_src/s21_flat_map.h"
+#include "lib_src/s21_flat_set.h"
+#include "lib_src/s21_flat_multiset.h"
+
+// read-only sorted containers (Eytzinger layout, inherit from FrozenBase)
+#include "lib_src/s21_frozen_set.h"
+#include "lib_src/s21_frozen_map.h"
+
+// adaptors (contain another container)
+#include "lib_src/s21_priority_queue.h"
+
+// heaps with stable handles (node based)
+#include "lib_src/s21_pairing_heap.h"
+#include "lib_src/s21_radix_heap.h"
+
+// other containers (do not own their elements)
+#include "lib_src/s21_intrusive_list.h"
+
+// timers (slots are intrusive lists)
+#include "lib_src/s21_timing_wheel.h"
+
+// thread-safe containers (lock-free)
+#include "lib_src/s21_concurrent_list.h"
+#include "lib_src/s21_concurrent_stack.h"
+#include "lib_src/s21_spsc_queue.h"
+#include "lib_src/s21_mpmc_queue.h"
+#include "lib_src/s21_work_stealing_deque.h"
+
+// thread pool (work-stealing, uses the containers above)
+#include "lib_src/s21_thread_pool.h"
+
+// thread-safe containers (lock striping over the containers above)
+#include "lib_src/s21_concurrent_hash_map.h"
+
+// coroutines (C++20 only, empty with older standards)
+#include "lib_src/s21_channel.h"
 
 #endif  // S21_CONTAINERSPLUS_H_
\ No newline at end of file
@@ -1,8 +1,23 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
 #include <iostream>
-// #include <vector>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <new>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 #include <utility>
 
 #include "../array_exception.h"
@@ -10,6 +25,25 @@
 #include "../s21_containersplus.h"
 #include "../lib_src/s21_base_tree.h"
 
+// every allocation of the test binary is counted, so that tests could check
+// how many allocations a container really makes
+static std::atomic<size_t> allocations_count{ 0 };
+
+__attribute__((noinline)) void* operator new(size_t size) {
+  ++allocations_count;
+
+  void *p = std::malloc(size == 0 ? 1 : size);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+
+  return p;
+}
+
+// not inlined, otherwise optimizer sees free() of a pointer from operator new
+__attribute__((noinline)) void operator delete(void *p) noexcept { std::free(p); }
+
+__attribute__((noinline)) void operator delete(void *p, size_t) noexcept { std::free(p); }
 
 /* ========================================================================= */
 /*                                   List                                    */
@@ -455,6 +489,29 @@ TEST(multiple_insertions, insert_many_front) {
   EXPECT_EQ(list.get(4), 3);
 }
 
+TEST(multiple_insertions, insert_many_constructs_in_place) {
+  s21::List<std::unique_ptr<int>> list;
+  s21::List<std::unique_ptr<int>>::Iterator it = list.begin();
+
+  // move-only elements: nothing is copied on the way into the nodes
+  list.insert_many_back(std::make_unique<int>(3), std::make_unique<int>(4));
+  list.insert_many_front(std::make_unique<int>(2), std::make_unique<int>(1));
+  it = list.end();
+  list.insert_many(it, std::make_unique<int>(5));
+
+  EXPECT_EQ(list.size(), 5);
+  int expected = 1;
+  for (const auto &item : list) {
+    EXPECT_EQ(*item, expected++);
+  }
+
+  std::string moved(64, 'a');
+  s21::List<std::string> strings;
+  strings.insert_many_back(std::move(moved), "literal");
+  EXPECT_EQ(strings.front(), std::string(64, 'a'));
+  EXPECT_EQ(strings.back(), "literal");
+}
+
 TEST(multiple_insertions, insert_many_back) {
   s21::List<int> list;
 
@@ -618,6 +675,22 @@ TEST(modifying_a_list, pop_front) {
   EXPECT_FALSE(list.contains(1));
 }
 
+TEST(modifying_a_list, pop_front_many) {
+  s21::List<int> list{ 1, 2, 3, 4, 5 };
+  int out[5] = {};
+
+  EXPECT_EQ(list.popFront(out, 3), 3);
+  EXPECT_EQ(out[0], 1);
+  EXPECT_EQ(out[2], 3);
+  EXPECT_EQ(list.size(), 2);
+  EXPECT_EQ(list.front(), 4);
+  EXPECT_EQ(list.get(1), 5);
+
+  EXPECT_EQ(list.popFront(out, 10), 2);
+  EXPECT_EQ(out[1], 5);
+  EXPECT_TRUE(list.empty());
+}
+
 TEST(special_list_operations, swapping_two_lists) {
   s21::List<int> list;
   list.insert(0, 1);
@@ -857,6 +930,419 @@ TEST(special_list_operations, sorting_a_list_2) {
   list.sort();
 }
 
+TEST(indexing_a_list, sequential_get_in_both_directions) {
+  s21::List<int> list;
+
+  for (int i = 0; i < 100; ++i) {
+    list.pushBack(i);
+  }
+
+  for (size_t i = 0; i < list.size(); ++i) {
+    EXPECT_EQ(list.get(i), static_cast<int>(i));
+  }
+
+  for (size_t i = list.size(); i > 0; --i) {
+    EXPECT_EQ(list.get(i - 1), static_cast<int>(i - 1));
+  }
+
+  // jumping around the cursor
+  EXPECT_EQ(list.get(50), 50);
+  EXPECT_EQ(list.get(52), 52);
+  EXPECT_EQ(list.get(48), 48);
+  EXPECT_EQ(list.get(99), 99);
+  EXPECT_EQ(list.get(0), 0);
+}
+
+TEST(indexing_a_list, cursor_survives_modifications) {
+  s21::List<int> list;
+  std::vector<int> expected;
+
+  for (int i = 0; i < 50; ++i) {
+    list.pushBack(i);
+    expected.push_back(i);
+  }
+
+  EXPECT_EQ(list.get(25), 25); // cursor is set in the middle
+
+  list.insert(10, 100); // before the cursor
+  expected.insert(expected.begin() + 10, 100);
+  list.removeAt(40); // after the cursor
+  expected.erase(expected.begin() + 40);
+  list.pushFront(-1);
+  expected.insert(expected.begin(), -1);
+  list.popBack();
+  expected.pop_back();
+  list.remove(30);
+  expected.erase(expected.begin() + 32);
+
+  s21::List<int>::Iterator it = list.begin();
+  ++it;
+  list.erase(it);
+  expected.erase(expected.begin() + 1);
+
+  ASSERT_EQ(list.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(list.get(i), expected[i]);
+  }
+
+  for (size_t i = expected.size(); i > 0; --i) {
+    list.set(i - 1, static_cast<int>(i));
+    EXPECT_EQ(list.get(i - 1), static_cast<int>(i));
+  }
+
+  list.clear();
+  EXPECT_THROW(list.get(0), s21::ArrayException);
+  list.pushBack(7);
+  EXPECT_EQ(list.get(0), 7);
+}
+
+TEST(indexing_a_list, cursor_after_moving_a_list) {
+  s21::List<int> list{ 1, 2, 3, 4, 5 };
+  EXPECT_EQ(list.get(3), 4);
+
+  s21::List<int> moved(std::move(list));
+  EXPECT_EQ(moved.get(2), 3);
+  EXPECT_EQ(moved.get(4), 5);
+
+  list.pushBack(10);
+  EXPECT_EQ(list.get(0), 10);
+
+  s21::List<int> empty;
+  moved = std::move(empty);
+  EXPECT_TRUE(moved.empty());
+  moved.pushBack(1);
+  EXPECT_EQ(moved.get(0), 1);
+  EXPECT_EQ(moved.size(), 1);
+}
+
+TEST(bulk_list_operations, range_constructor) {
+  std::vector<int> source{ 1, 2, 3, 4, 5 };
+  s21::List<int> list(source.begin(), source.end());
+
+  EXPECT_EQ(list.size(), 5);
+  for (size_t i = 0; i < source.size(); ++i) {
+    EXPECT_EQ(list.get(i), source[i]);
+  }
+
+  s21::List<int> copy(list.begin(), list.end());
+  EXPECT_EQ(copy.size(), 5);
+  EXPECT_EQ(copy.back(), 5);
+
+  s21::List<int> empty(source.begin(), source.begin());
+  EXPECT_TRUE(empty.empty());
+}
+
+TEST(bulk_list_operations, insert_range_at_position) {
+  s21::List<int> list{ 1, 5 };
+  int source[] = { 2, 3, 4 };
+
+  s21::List<int>::Iterator pos = list.begin();
+  ++pos;
+
+  s21::List<int>::Iterator first = list.insert(pos, source, source + 3);
+  EXPECT_EQ(*first, 2);
+  EXPECT_EQ(*pos, 5);
+
+  EXPECT_EQ(list.size(), 5);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(list.get(i), i + 1);
+  }
+
+  s21::List<int>::Iterator same = list.insert(pos, source, source);
+  EXPECT_TRUE(same == pos);
+  EXPECT_EQ(list.size(), 5);
+}
+
+TEST(bulk_list_operations, insert_single_pass_range) {
+  std::istringstream input("2 3 4");
+  s21::List<int> list{ 1, 5 };
+
+  s21::List<int>::Iterator pos = list.begin();
+  ++pos;
+
+  // a stream can be read only once, its elements are not counted beforehand
+  s21::List<int>::Iterator first = list.insert(pos, std::istream_iterator<int>(input), std::istream_iterator<int>());
+  EXPECT_EQ(*first, 2);
+
+  EXPECT_EQ(list.size(), 5);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(list.get(i), i + 1);
+  }
+
+  std::istringstream empty;
+  s21::List<int> none(std::istream_iterator<int>(empty), std::istream_iterator<int>{});
+  EXPECT_TRUE(none.empty());
+}
+
+TEST(bulk_list_operations, append_range) {
+  s21::List<int> list{ 1, 2 };
+  s21::List<int> other{ 3, 4 };
+  std::vector<int> source{ 5, 6 };
+
+  list.append_range(other);
+  list.append_range(source);
+
+  EXPECT_EQ(list.size(), 6);
+  EXPECT_EQ(other.size(), 2);
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(list.get(i), i + 1);
+  }
+}
+
+TEST(bulk_list_operations, single_allocation_per_range) {
+  std::vector<int> source(1000, 42);
+
+  size_t before = allocations_count;
+  s21::List<int> list(source.begin(), source.end());
+  EXPECT_EQ(allocations_count - before, 1U);
+
+  before = allocations_count;
+  s21::List<int> copy(list);
+  EXPECT_EQ(allocations_count - before, 1U);
+
+  before = allocations_count;
+  list.insert_many_back(1, 2, 3, 4, 5);
+  EXPECT_EQ(allocations_count - before, 1U);
+
+  // removed nodes are reused by the next insertions
+  for (int i = 0; i < 10; ++i) {
+    list.popFront();
+  }
+  before = allocations_count;
+  for (int i = 0; i < 10; ++i) {
+    list.pushBack(i);
+  }
+  EXPECT_EQ(allocations_count - before, 0U);
+  EXPECT_EQ(list.size(), 1005);
+  EXPECT_EQ(list.back(), 9);
+}
+
+struct ThrowingCopy {
+  static int copies_left;
+  static int alive;
+  int value = 0;
+
+  ThrowingCopy(int v = 0) : value{ v } { ++alive; }
+  ThrowingCopy(const ThrowingCopy& other) : value{ other.value } {
+    if (copies_left-- == 0) {
+      throw std::runtime_error("copy failed");
+    }
+    ++alive;
+  }
+  ~ThrowingCopy() { --alive; }
+};
+
+int ThrowingCopy::copies_left = 0;
+int ThrowingCopy::alive = 0;
+
+TEST(bulk_list_operations, failed_bulk_insert_leaves_list_unchanged) {
+  ThrowingCopy::copies_left = 100;
+  {
+    std::vector<ThrowingCopy> source{ 1, 2, 3, 4 };
+    s21::List<ThrowingCopy> list;
+    list.pushBack(ThrowingCopy(0));
+
+    ThrowingCopy::copies_left = 2;
+    EXPECT_THROW(list.insert(list.end(), source.begin(), source.end()), std::runtime_error);
+
+    EXPECT_EQ(list.size(), 1);
+    EXPECT_EQ(list.front().value, 0);
+
+    ThrowingCopy::copies_left = 100;
+    list.append_range(source);
+    EXPECT_EQ(list.size(), 5);
+    EXPECT_EQ(list.back().value, 4);
+  }
+
+  // nil node holds a default constructed value too, all others are destroyed
+  EXPECT_EQ(ThrowingCopy::alive, 0);
+}
+
+TEST(bulk_list_operations, repeated_bulk_insert_reuses_free_nodes) {
+  s21::Queue<int> queue;
+  queue.insert_many_back(1, 2, 3, 4, 5, 6, 7, 8);
+  for (int i = 0; i < 8; ++i) {
+    queue.pop();
+  }
+
+  size_t before = allocations_count;
+  for (int round = 0; round < 1000; ++round) {
+    queue.insert_many_back(1, 2, 3, 4, 5, 6, 7, 8);
+    for (int i = 0; i < 8; ++i) {
+      queue.pop();
+    }
+  }
+  EXPECT_EQ(allocations_count - before, 0U);
+  EXPECT_TRUE(queue.empty());
+
+  int values[100] = {};
+  s21::List<int> list;
+  list.insert(list.end(), values, values + 100);
+  list.remove_if([](int) { return true; });
+
+  before = allocations_count;
+  for (int round = 0; round < 1000; ++round) {
+    list.insert(list.end(), values, values + 100);
+    list.remove_if([](int) { return true; });
+  }
+  EXPECT_EQ(allocations_count - before, 0U);
+
+  // a bigger burst takes a new block only for the nodes the free list lacks,
+  // once empty the list keeps just its biggest block
+  list.insert(list.end(), values, values + 50);
+  before = allocations_count;
+  list.insert(list.end(), values, values + 100);
+  EXPECT_EQ(allocations_count - before, 1U);
+  list.remove_if([](int) { return true; });
+
+  before = allocations_count;
+  list.insert(list.end(), values, values + 100);
+  EXPECT_EQ(allocations_count - before, 0U);
+  EXPECT_EQ(list.size(), 100);
+}
+
+TEST(bulk_list_operations, shrink_to_fit_frees_unused_blocks) {
+  int values[100] = {};
+  s21::List<int> list;
+
+  for (int i = 0; i < 100; ++i) {
+    values[i] = i;
+  }
+  list.insert(list.end(), values, values + 100);
+  list.insert(list.end(), values, values + 100); // a second block
+
+  for (int i = 0; i < 100; ++i) {
+    list.popBack();
+  }
+  list.popFront(); // a free node in the first block
+
+  // the second block is kept until asked, its nodes are reused
+  size_t before = allocations_count;
+  list.insert(list.end(), values, values + 100);
+  EXPECT_EQ(allocations_count - before, 0U);
+  for (int i = 0; i < 100; ++i) {
+    list.popBack();
+  }
+
+  list.shrink_to_fit();
+
+  EXPECT_EQ(list.size(), 99);
+  for (int i = 0; i < 99; ++i) {
+    EXPECT_EQ(list.get(i), i + 1);
+  }
+
+  // the node freed in the first block stays, the second block is gone
+  before = allocations_count;
+  list.pushFront(0);
+  EXPECT_EQ(allocations_count - before, 0U);
+  list.insert(list.end(), values, values + 100);
+  EXPECT_EQ(allocations_count - before, 1U);
+  EXPECT_EQ(list.size(), 200);
+
+  list.clear();
+  list.shrink_to_fit();
+  EXPECT_TRUE(list.empty());
+}
+
+TEST(filtering_a_list, remove_if) {
+  s21::List<int> list{ 1, 2, 3, 4, 5, 6, 7, 8 };
+
+  EXPECT_EQ(list.remove_if([](int x) { return x % 2 == 0; }), 4U);
+  EXPECT_EQ(list.size(), 4);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(list.get(i), 2 * i + 1);
+  }
+
+  EXPECT_EQ(list.remove_if([](int) { return false; }), 0U);
+  EXPECT_EQ(list.remove_if([](int) { return true; }), 4U);
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.remove_if([](int) { return true; }), 0U);
+}
+
+TEST(filtering_a_list, remove_if_touches_every_node_once) {
+  s21::List<int> list{ 5, 1, 5, 2, 5, 5, 3 };
+  size_t calls = 0;
+
+  list.remove_if([&calls](int x) {
+    ++calls;
+    return x == 5;
+  });
+
+  EXPECT_EQ(calls, 7U);
+  EXPECT_EQ(list.size(), 3);
+}
+
+TEST(filtering_a_list, remove_all) {
+  s21::List<int> list{ 5, 1, 5, 2, 5, 5, 3, 5 };
+
+  EXPECT_EQ(list.remove_all(5), 5U);
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list.get(0), 1);
+  EXPECT_EQ(list.get(1), 2);
+  EXPECT_EQ(list.get(2), 3);
+  EXPECT_EQ(list.remove_all(42), 0U);
+}
+
+// destroyed values compare unequal to everything, reading one after it is
+// destroyed shows up as a wrong count
+struct Poisoned {
+  int value;
+
+  Poisoned(int v = 0) : value{ v } {}
+  ~Poisoned() { value = -1; }
+
+  bool operator==(const Poisoned &other) const { return value != -1 && value == other.value; }
+};
+
+TEST(filtering_a_list, remove_all_of_an_element_of_the_list) {
+  s21::List<Poisoned> list{ 5, 1, 5, 2, 5 };
+
+  EXPECT_EQ(list.remove_all(list.front()), 3U);
+  EXPECT_EQ(list.size(), 2);
+  EXPECT_EQ(list.front().value, 1);
+  EXPECT_EQ(list.back().value, 2);
+
+  // long strings live on the heap, a destroyed one is freed
+  const std::string a(64, 'a');
+  const std::string b(64, 'b');
+  s21::List<std::string> strings{ a, b, a, a };
+
+  EXPECT_EQ(strings.remove_all(strings.front()), 3U);
+  EXPECT_EQ(strings.size(), 1);
+  EXPECT_EQ(strings.front(), b);
+}
+
+TEST(filtering_a_list, unique_with_predicate) {
+  s21::List<int> list{ 1, 2, 4, 10, 11, 13, 30 };
+
+  // removes elements closer than 3 to the last kept one
+  size_t removed = list.unique([](int kept, int current) { return current - kept < 3; });
+
+  EXPECT_EQ(removed, 2U);
+  EXPECT_EQ(list.size(), 5);
+  EXPECT_EQ(list.get(0), 1);
+  EXPECT_EQ(list.get(1), 4);
+  EXPECT_EQ(list.get(2), 10);
+  EXPECT_EQ(list.get(3), 13);
+  EXPECT_EQ(list.get(4), 30);
+
+  s21::List<int> duplicates{ 7, 7, 7 };
+  EXPECT_EQ(duplicates.unique(), 2U);
+  EXPECT_EQ(duplicates.size(), 1);
+
+  s21::List<int> empty;
+  EXPECT_EQ(empty.unique(), 0U);
+}
+
+TEST(filtering_a_list, erase_if) {
+  s21::List<std::string> list{ "apple", "", "pear", "", "plum" };
+
+  EXPECT_EQ(s21::erase_if(list, [](const std::string& s) { return s.empty(); }), 2U);
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list.front(), "apple");
+  EXPECT_EQ(list.back(), "plum");
+}
+
 
 /* ========================================================================= */
 /*                                   Stack                                   */
@@ -991,6 +1477,180 @@ TEST(inserting_in_stack, insert_many_front) {
   stack.pop();
 }
 
+TEST(redacting_a_stack, inline_buffer_spill) {
+  s21::Stack<std::string, 4> stack;
+
+  EXPECT_EQ(stack.capacity(), 4);
+  for (int i = 0; i < 100; ++i) {
+    stack.push(std::to_string(i));
+  }
+  EXPECT_EQ(stack.size(), 100);
+  EXPECT_GE(stack.capacity(), 100);
+
+  // top is mutable
+  stack.top() += "!";
+  EXPECT_EQ(stack.top(), "99!");
+
+  // pushing an element of the stack itself while it grows
+  s21::Stack<std::string, 1> small{ "a" };
+  small.push(small.top());
+  small.push(small.top());
+  EXPECT_EQ(small.size(), 3);
+  EXPECT_EQ(small.top(), "a");
+
+  s21::Stack<std::string, 4> moved(std::move(stack));
+  EXPECT_TRUE(stack.empty());
+  EXPECT_EQ(moved.size(), 100);
+
+  for (int i = 99; i >= 0; --i) {
+    EXPECT_EQ(moved.top().substr(0, std::to_string(i).size()), std::to_string(i));
+    moved.pop();
+  }
+  EXPECT_TRUE(moved.empty());
+}
+
+TEST(redacting_a_stack, push_many_pop_n_reserve) {
+  s21::Stack<int> stack;
+  stack.reserve(1000);
+  EXPECT_EQ(stack.capacity(), 1000);
+
+  s21::Vector<int> values;
+  for (int i = 0; i < 50; ++i) {
+    values.push_back(i);
+  }
+  stack.push_many(values.begin(), values.end());
+  stack.push_many({ 50, 51 });
+  EXPECT_EQ(stack.size(), 52);
+  EXPECT_EQ(stack.top(), 51);
+
+  int popped[5] = {};
+  EXPECT_EQ(stack.pop_n(popped, 5), 5);
+  EXPECT_EQ(popped[0], 51);
+  EXPECT_EQ(popped[4], 47);
+
+  EXPECT_EQ(stack.pop_n(40), 40);
+  EXPECT_EQ(stack.top(), 6);
+  EXPECT_EQ(stack.pop_n(100), 7);
+  EXPECT_TRUE(stack.empty());
+  EXPECT_EQ(stack.pop_n(1), 0);
+
+  // list iterators declare no category, a stream is walked only once
+  s21::List<int> list{ 1, 2, 3 };
+  stack.push_many(list.begin(), list.end());
+  std::istringstream input("4 5");
+  stack.push_many(std::istream_iterator<int>(input), std::istream_iterator<int>());
+  EXPECT_EQ(stack.size(), 5);
+  EXPECT_EQ(stack.top(), 5);
+  EXPECT_EQ(stack.pop_n(5), 5);
+
+  // elements do not need a default constructor
+  s21::Stack<std::pair<const int, std::string>, 2> pairs;
+  pairs.push({ 1, "one" });
+  pairs.push({ 2, "two" });
+  pairs.push({ 3, "three" });
+  EXPECT_EQ(pairs.top().second, "three");
+}
+
+TEST(redacting_a_stack, drain) {
+  s21::Stack<int, 4> stack{ 1, 2, 3, 4, 5, 6 };
+  s21::Vector<int> out{ 0 };
+
+  EXPECT_EQ(stack.drain(out, 4), 4);
+  EXPECT_EQ(stack.size(), 2);
+  ASSERT_EQ(out.size(), 5);
+  EXPECT_EQ(out[1], 6);
+  EXPECT_EQ(out[4], 3);
+
+  EXPECT_EQ(stack.drain(out), 2);
+  EXPECT_TRUE(stack.empty());
+  EXPECT_EQ(out.back(), 1);
+  EXPECT_EQ(stack.drain(out), 0);
+}
+
+
+struct ThrowingMove {
+  static int moves_left;
+  static int alive;
+  int value = 0;
+
+  ThrowingMove(int v = 0) : value{ v } { ++alive; }
+  ThrowingMove(const ThrowingMove& other) : value{ other.value } { ++alive; }
+  ThrowingMove(ThrowingMove&& other) : value{ other.value } {
+    if (moves_left-- == 0) {
+      throw std::runtime_error("move failed");
+    }
+    other.value = -1;
+    ++alive;
+  }
+  ThrowingMove& operator=(ThrowingMove&& other) {
+    if (moves_left-- == 0) {
+      throw std::runtime_error("move failed");
+    }
+    value = other.value;
+    other.value = -1;
+    return *this;
+  }
+  ~ThrowingMove() { --alive; }
+};
+
+int ThrowingMove::moves_left = 0;
+int ThrowingMove::alive = 0;
+
+TEST(redacting_a_stack, throwing_moves_keep_the_stack_consistent) {
+  ThrowingMove::moves_left = 100;
+  {
+    s21::Stack<ThrowingMove, 2> stack;
+    stack.push(ThrowingMove(1));
+    stack.push(ThrowingMove(2));
+
+    // the array grows: elements with a move that may throw are copied, a
+    // failed move could not leave moved-from elements in the stack
+    ThrowingMove::moves_left = 1;
+    ThrowingMove third(3);
+    stack.push(third);
+    EXPECT_EQ(stack.size(), 3);
+
+    ThrowingMove::moves_left = 100;
+    stack.push(ThrowingMove(4));
+
+    s21::Stack<ThrowingMove, 2> copy(stack);
+    for (int value = 4; value > 0; --value) {
+      EXPECT_EQ(copy.top().value, value);
+      copy.pop();
+    }
+
+    // popped elements leave the count at once, the one that failed stays
+    ThrowingMove out[4];
+    ThrowingMove::moves_left = 2;
+    EXPECT_THROW(stack.pop_n(out, 4), std::runtime_error);
+    EXPECT_EQ(stack.size(), 2);
+    EXPECT_EQ(stack.top().value, 2);
+    EXPECT_EQ(out[1].value, 3);
+
+    ThrowingMove::moves_left = 100;
+  }
+
+  // every element was destroyed exactly once
+  EXPECT_EQ(ThrowingMove::alive, 0);
+
+  // a copy failing while the array grows leaves the stack as it was
+  ThrowingCopy::copies_left = 100;
+  const int alive = ThrowingCopy::alive;
+  {
+    s21::Stack<ThrowingCopy, 2> stack;
+    stack.push(ThrowingCopy(1));
+    stack.push(ThrowingCopy(2));
+
+    ThrowingCopy::copies_left = 2; // the pushed value and the first element
+    EXPECT_THROW(stack.push(ThrowingCopy(3)), std::runtime_error);
+    EXPECT_EQ(stack.size(), 2);
+    EXPECT_EQ(stack.top().value, 2);
+
+    ThrowingCopy::copies_left = 100;
+  }
+  EXPECT_EQ(ThrowingCopy::alive, alive);
+}
+
 
 /* ========================================================================= */
 /*                                  Queue                                    */
@@ -1131,6 +1791,37 @@ TEST(inserting_in_a_queue, insert_many_back) {
   EXPECT_EQ(queue.front(), 6);
 }
 
+TEST(redacting_a_queue, pop_n_and_drain) {
+  s21::Queue<std::string> queue;
+  for (int i = 0; i < 10; ++i) {
+    queue.push(std::to_string(i));
+  }
+
+  std::string first[3];
+  EXPECT_EQ(queue.pop_n(first, 3), 3);
+  EXPECT_EQ(first[0], "0");
+  EXPECT_EQ(first[2], "2");
+  EXPECT_EQ(queue.front(), "3");
+
+  EXPECT_EQ(queue.pop_n(2), 2);
+  EXPECT_EQ(queue.front(), "5");
+
+  s21::Vector<std::string> out;
+  EXPECT_EQ(queue.drain(out, 2), 2);
+  EXPECT_EQ(queue.drain(out), 3);
+  EXPECT_TRUE(queue.empty());
+  ASSERT_EQ(out.size(), 5);
+  EXPECT_EQ(out[0], "5");
+  EXPECT_EQ(out[4], "9");
+
+  // nodes are reused after a drain
+  queue.push("again");
+  EXPECT_EQ(queue.front(), "again");
+  EXPECT_EQ(queue.back(), "again");
+  EXPECT_EQ(queue.drain(out, 0), 0);
+  EXPECT_EQ(queue.pop_n(5), 1);
+}
+
 
 /* ========================================================================= */
 /*                                Base Tree                                  */
@@ -2376,796 +3067,3576 @@ TEST(Map, merging_two_maps) {
 
 
 /* ========================================================================= */
-/*                                 Vector                                    */
+/*                          Hash Map and Hash Set                            */
 /* ========================================================================= */
 
-TEST(Creating_vector, vector_of_pairs) {
-  // s21::List<int> list;
-
-  // s21::Vector<std::pair<s21::List<int>::Iterator, bool>> vector(10);
+TEST(HashMap, map_interface) {
+  s21::HashMap<int, int> map{ std::make_pair(1, 10), std::make_pair(2, 20) };
 
-  // vector.push_back(std::make_pair(list.begin(), true));
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(1), 10);
+  EXPECT_THROW(map.at(3), s21::ArrayException);
+
+  EXPECT_TRUE(map.insert(3, 30).second);
+  EXPECT_FALSE(map.insert(std::make_pair(3, 31)).second);
+  EXPECT_EQ(*(map.insert(4, 40).first), 40);
+  EXPECT_EQ(map.insert(4, 41).first->second, 40);
+
+  EXPECT_EQ(map[5], 0); // value initialized
+  map[5] = 50;
+  EXPECT_EQ(map.at(5), 50);
+
+  EXPECT_FALSE(map.insert_or_assign(1, 11).second);
+  EXPECT_TRUE(map.insert_or_assign(6, 60).second);
+  EXPECT_EQ(map.at(1), 11);
+  EXPECT_EQ(map.size(), 6);
+
+  int key_sum = 0;
+  int value_sum = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    key_sum += it->first;
+    value_sum += *it;
+  }
+  EXPECT_EQ(key_sum, 21);
+  EXPECT_EQ(value_sum, 11 + 20 + 30 + 40 + 50 + 60);
 
-  // EXPECT_EQ(vector.size(), 1);
+  auto it = map.insert(2, 0).first;
+  EXPECT_TRUE(map.erase(it));
+  EXPECT_FALSE(map.contains(2));
+  EXPECT_TRUE(map.remove(3));
+  EXPECT_FALSE(map.remove(3));
+  EXPECT_EQ(map.size(), 4);
 
-  // std::pair<int, int>* p = new std::pair<int, int>();
-  // printf("p->first = %d, p->second = %d\n", p->first, p->second);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
 }
 
-TEST(Creating_vector, empty_vector) {
-  s21::Vector<int> vector;
-  EXPECT_EQ(vector.size(), 0);
-  EXPECT_TRUE(vector.empty());
-}
+TEST(HashMap, inserting_a_value_of_the_map_itself) {
+  // a rehash moves the elements, a moved-from long string is left empty
+  const std::string value(64, 'v');
+  s21::HashMap<int, std::string> map;
+  s21::HashMap<int, std::string> assigned;
+  map.insert(0, value);
+  assigned.insert(0, value);
 
-TEST(Creating_vector, constructor_with_param) {
-  s21::Vector<int> vector(11);
+  for (int key = 1; key < 200; ++key) {
+    ASSERT_TRUE(map.insert(key, map.at(key - 1)).second);
+    ASSERT_EQ(map.at(key), value) << key;
 
-  EXPECT_EQ(vector.size(), 11);
+    ASSERT_TRUE(assigned.insert_or_assign(key, assigned.at(0)).second);
+    ASSERT_EQ(assigned.at(key), value) << key;
+  }
 }
 
-TEST(Creating_vector, constructor_with_initializer_list) {
-  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
-  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
+TEST(HashMap, random_operations_match_std_unordered_map) {
+  s21::HashMap<std::string, int> map;
+  std::unordered_map<std::string, int> expected;
+  unsigned state = 1;
 
-  EXPECT_EQ(s21_vector.size(), std_vector.size());
+  // small key space: lots of erases, deleted slots are reused and cleaned up
+  for (int i = 0; i < 50000; ++i) {
+    state = state * 1103515245u + 12345u;
+    std::string key = "key" + std::to_string((state >> 8) % 2000);
 
-  for (size_t i = 0; i < s21_vector.size(); ++i) {
-    EXPECT_EQ(s21_vector[i], std_vector[i]);
+    if ((state >> 24) % 3 == 0) {
+      EXPECT_EQ(map.remove(key), expected.erase(key) == 1);
+    } else {
+      EXPECT_EQ(map.insert(key, i).second, expected.emplace(key, i).second);
+    }
   }
-}
 
-TEST(Creating_vector, constructor_copy) {
-  s21::Vector<int> vector(5);
+  EXPECT_EQ(map.size(), expected.size());
+  EXPECT_LE(map.load_factor(), 0.875);
+  for (const auto &item : expected) {
+    EXPECT_EQ(map.at(item.first), item.second);
+  }
 
-  vector[0] = 10;
-  vector[1] = 12;
-  vector[2] = 13;
-  vector[3] = 14;
-  vector[4] = 15;
+  size_t visited = 0;
+  for (auto it = map.cbegin(); it != map.cend(); ++it) {
+    EXPECT_EQ(expected.at(it->first), *it);
+    ++visited;
+  }
+  EXPECT_EQ(visited, expected.size());
+}
 
-  s21::Vector<int> vectorCopy(vector);
+TEST(HashMap, copy_move_swap_and_merge) {
+  s21::HashMap<int, std::string> map{ std::make_pair(1, "one"), std::make_pair(2, "two") };
 
-  EXPECT_EQ(vectorCopy.size(), vector.size());
+  s21::HashMap<int, std::string> copy(map);
+  copy[3] = "three";
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_EQ(copy.at(1), "one");
 
-  for (size_t i = 0; i < vectorCopy.size(); ++i) {
-    EXPECT_EQ(vectorCopy[i], vector[i]);
-  }
+  s21::HashMap<int, std::string> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_TRUE(copy.empty());
+  EXPECT_FALSE(copy.contains(1));
+
+  s21::HashMap<int, std::string> other{ std::make_pair(3, "drei"), std::make_pair(4, "four") };
+  map.swap(other);
+  EXPECT_EQ(map.at(3), "drei");
+  EXPECT_EQ(other.at(1), "one");
+
+  map.merge(moved); // existing keys are kept
+  EXPECT_EQ(map.size(), 4);
+  EXPECT_EQ(map.at(3), "drei");
+  EXPECT_EQ(map.at(2), "two");
+
+  other = std::move(map);
+  EXPECT_EQ(other.size(), 4);
 }
 
-TEST(Creating_vector, constructor_move) {
-  s21::Vector<int> vector(5);
+TEST(HashSet, set_interface) {
+  s21::HashSet<int> set{ 5, 1, 3 };
 
-  vector[0] = 20;
-  vector[1] = 21;
-  vector[2] = 22;
-  vector[3] = 23;
-  vector[4] = 24;
+  auto vector = set.insert_many(1, 7, 7);
+  EXPECT_EQ(vector.size(), 3);
+  EXPECT_FALSE(vector.at(0).second);
+  EXPECT_TRUE(vector.at(1).second);
+  EXPECT_FALSE(vector.at(2).second);
+  EXPECT_EQ(*(vector.at(0).first), 1);
+  EXPECT_EQ(*(vector.at(2).first), 7);
+  EXPECT_EQ(set.size(), 4);
 
-  s21::Vector<int> vectorCopy(std::move(vector));
+  EXPECT_EQ(*set.find(3), 3);
+  EXPECT_THROW(set.find(4), s21::ArrayException);
+  EXPECT_TRUE(set.erase(set.find(3)));
+  EXPECT_FALSE(set.contains(3));
 
-  EXPECT_EQ(vectorCopy.size(), 5);
-  EXPECT_EQ(vector.size(), 0);
+  // many keys: table grows several times, all of them are found afterwards
+  for (int i = 100; i < 10100; ++i) {
+    EXPECT_TRUE(set.insert(i).second);
+  }
+  for (int i = 100; i < 10100; i += 2) {
+    EXPECT_TRUE(set.remove(i));
+  }
+  EXPECT_EQ(set.size(), 3 + 5000);
 
-  for (size_t i = 0; i < vectorCopy.size(); ++i) {
-    EXPECT_EQ(vectorCopy[i], 20 + i);
+  int sum = 0;
+  for (auto it = set.begin(); it != set.end(); ++it) {
+    sum += *it < 100 ? *it : 0;
+  }
+  EXPECT_EQ(sum, 1 + 5 + 7);
+  for (int i = 100; i < 10100; ++i) {
+    EXPECT_EQ(set.contains(i), i % 2 == 1);
   }
-}
 
-TEST(Destructor_vector, destructor) {
-  s21::Vector<int> vector(2);
+  set.reserve(100000);
+  EXPECT_GE(set.bucket_count(), 100000U);
+  EXPECT_TRUE(set.contains(101));
+}
+
+
+TEST(HashSet, group_matching) {
+  alignas(16) int8_t ctrl[16];
+  unsigned state = 7;
+
+  // random mixes of full slots, empty and deleted markers, the portable match
+  // may report extra slots (keys are compared anyway), but never miss one
+  for (int round = 0; round < 1000; ++round) {
+    for (int8_t &byte : ctrl) {
+      state = state * 1103515245u + 12345u;
+      unsigned kind = (state >> 16) % 4;
+      byte = kind == 0 ? s21::HashControl::kEmpty
+           : kind == 1 ? s21::HashControl::kDeleted
+                       : static_cast<int8_t>((state >> 8) % 4);
+    }
+
+    uint32_t expected_h2 = 0;
+    uint32_t expected_empty = 0;
+    uint32_t expected_free = 0;
+    for (int i = 0; i < 16; ++i) {
+      expected_h2 |= static_cast<uint32_t>(ctrl[i] == 2) << i;
+      expected_empty |= static_cast<uint32_t>(ctrl[i] == s21::HashControl::kEmpty) << i;
+      expected_free |= static_cast<uint32_t>(ctrl[i] < 0) << i;
+    }
+
+    s21::HashGroupPortable portable(ctrl);
+    EXPECT_EQ(portable.match(2) & expected_h2, expected_h2);
+    EXPECT_EQ(portable.matchEmpty(), expected_empty);
+    EXPECT_EQ(portable.matchEmptyOrDeleted(), expected_free);
+
+#if defined(__SSE2__)
+    s21::HashGroupSse2 sse(ctrl);
+    EXPECT_EQ(sse.match(2), expected_h2);
+    EXPECT_EQ(sse.matchEmpty(), expected_empty);
+    EXPECT_EQ(sse.matchEmptyOrDeleted(), expected_free);
+#endif
+  }
+}
 
-  vector[0] = 20;
-  vector[1] = 21;
 
-  vector.~Vector();
+/* ========================================================================= */
+/*                   Flat Map, Flat Set and Flat Multiset                    */
+/* ========================================================================= */
 
-  EXPECT_EQ(vector.size(), 0);
-}
+TEST(FlatMap, map_interface) {
+  s21::FlatMap<int, int> map{ std::make_pair(2, 20), std::make_pair(1, 10), std::make_pair(2, 21) };
 
-TEST(Assignment_operator_moving_object, Assignment_operator_moving_object) {
-  s21::Vector<int> vector(5);
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(2), 20); // the first of equal keys is kept
+  EXPECT_THROW(map.at(3), s21::ArrayException);
+
+  EXPECT_TRUE(map.insert(4, 40).second);
+  EXPECT_FALSE(map.insert(std::make_pair(4, 41)).second);
+  EXPECT_EQ(*(map.insert(3, 30).first), 30);
+
+  EXPECT_EQ(map[5], 0); // value initialized
+  map[5] = 50;
+  EXPECT_EQ(map.at(5), 50);
+
+  EXPECT_FALSE(map.insert_or_assign(1, 11).second);
+  EXPECT_TRUE(map.insert_or_assign(6, 60).second);
+  EXPECT_EQ(map.at(1), 11);
+
+  int expected_key = 1;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    EXPECT_EQ(it.key(), expected_key);
+    EXPECT_EQ(it.pair().second, *it);
+    ++expected_key;
+  }
+  EXPECT_EQ(expected_key, 7);
 
-  vector[0] = 20;
-  vector[1] = 21;
-  vector[2] = 22;
-  vector[3] = 23;
-  vector[4] = 24;
+  EXPECT_EQ(map.lower_bound(3).key(), 3);
+  EXPECT_EQ(map.upper_bound(3).key(), 4);
+  EXPECT_EQ(map.upper_bound(6), map.end());
 
-  s21::Vector<int> vectorCopy(5);
-  vectorCopy = (std::move(vector));
+  EXPECT_TRUE(map.erase(map.find(2)));
+  EXPECT_FALSE(map.contains(2));
+  EXPECT_EQ(map.at(3), 30); // values moved along with the keys
+  EXPECT_TRUE(map.remove(3));
+  EXPECT_FALSE(map.remove(3));
+  EXPECT_EQ(map.size(), 4);
 
-  EXPECT_EQ(vectorCopy.size(), 5);
-  EXPECT_EQ(vector.size(), 0);
+  auto result = map.insert_many(std::make_pair(9, 90), std::make_pair(0, 0), std::make_pair(4, 0),
+                                std::make_pair(9, 91));
+  ASSERT_EQ(result.size(), 4);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_TRUE(result[1].second);
+  EXPECT_FALSE(result[2].second);
+  EXPECT_FALSE(result[3].second);
+  EXPECT_EQ(*result[3].first, 90);
+  EXPECT_EQ(result[2].first.key(), 4);
+  EXPECT_EQ(map.at(4), 40);
+  EXPECT_EQ(map.size(), 6);
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(FlatMap, const_map_gives_const_iterators) {
+  using Map = s21::FlatMap<int, int>;
+
+  static_assert(std::is_same<decltype(*std::declval<const Map&>().find(0)), const int&>::value);
+  static_assert(std::is_same<decltype(*std::declval<const Map&>().lower_bound(0)), const int&>::value);
+  static_assert(std::is_same<decltype(*std::declval<const Map&>().upper_bound(0)), const int&>::value);
+  static_assert(std::is_same<decltype(*std::declval<Map&>().find(0)), int&>::value);
+
+  Map map{ { 1, 10 }, { 2, 20 } };
+  const Map &view = map;
+
+  *map.find(1) = 11;
+  s21::FlatMap<int, int>::ConstIterator it = map.find(2); // mutable converts to const
+  EXPECT_EQ(*it, 20);
+  EXPECT_EQ(*view.find(1), 11);
+  EXPECT_EQ(view.lower_bound(2), it);
+  EXPECT_EQ(view.upper_bound(2), view.cend());
+}
+
+TEST(FlatMap, random_operations_match_std_map) {
+  s21::FlatMap<std::string, int> map;
+  std::map<std::string, int> expected;
+  unsigned state = 7;
+
+  for (int round = 0; round < 100; ++round) {
+    std::vector<std::pair<std::string, int>> batch;
+
+    for (int i = 0; i < 50; ++i) {
+      state = state * 1103515245u + 12345u;
+      std::string key = "key" + std::to_string((state >> 8) % 1000);
+
+      if ((state >> 24) % 4 == 0) {
+        EXPECT_EQ(map.remove(key), expected.erase(key) == 1);
+      } else if ((state >> 24) % 4 == 1) {
+        EXPECT_EQ(map.insert(key, i).second, expected.emplace(key, i).second);
+      } else {
+        batch.emplace_back(key, i);
+      }
+    }
+
+    map.insert_range(batch.begin(), batch.end());
+    expected.insert(batch.begin(), batch.end());
+  }
 
-  for (size_t i = 0; i < vectorCopy.size(); ++i) {
-    EXPECT_EQ(vectorCopy[i], 20 + i);
+  ASSERT_EQ(map.size(), expected.size());
+  auto it = map.cbegin();
+  for (const auto &item : expected) {
+    EXPECT_EQ(it.key(), item.first);
+    EXPECT_EQ(*it, item.second);
+    ++it;
   }
+  EXPECT_EQ(it, map.cend());
+
+  s21::FlatMap<std::string, int> other{ std::make_pair(std::string("a"), 1) };
+  other.merge(map);
+  EXPECT_EQ(other.size(), expected.size() + 1);
+  other.swap(map);
+  EXPECT_EQ(map.at("a"), 1);
+  EXPECT_EQ(other.size(), expected.size());
 }
 
-TEST(Functions_vector, implimentation_at) {
-  s21::Vector<int> s21_vector = {10, 20, 30};
-  std::vector<int> std_vector = {10, 20, 30};
+TEST(FlatSet, set_interface) {
+  s21::FlatSet<int> set{ 5, 1, 3, 1 };
 
-  for (size_t i = 0; i < s21_vector.size(); ++i) {
-    EXPECT_EQ(s21_vector.at(i), std_vector.at(i));
+  EXPECT_EQ(set.size(), 3);
+  EXPECT_TRUE(set.insert(4).second);
+  EXPECT_FALSE(set.insert(3).second);
+  EXPECT_EQ(*set.insert(2).first, 2);
+
+  int expected = 1;
+  for (auto it = set.begin(); it != set.end(); ++it) {
+    EXPECT_EQ(*it, expected++);
   }
 
-  EXPECT_THROW(s21_vector.at(10), s21::ArrayException);
+  auto last = set.end();
+  EXPECT_EQ(*(--last), 5);
+  EXPECT_THROW(--set.begin(), s21::ArrayException);
+  EXPECT_THROW(++set.end(), s21::ArrayException);
+  EXPECT_THROW(*set.end(), s21::ArrayException);
 
-  s21::Vector<int> const const_s21_vector = s21_vector;
-  std::vector<int> const const_std_vector = std_vector;
+  EXPECT_EQ(*set.find(4), 4);
+  EXPECT_THROW(set.find(6), s21::ArrayException);
+  EXPECT_EQ(*set.lower_bound(0), 1);
+  EXPECT_EQ(set.upper_bound(5), set.end());
 
-  for (size_t i = 0; i < const_s21_vector.size(); ++i) {
-    EXPECT_EQ(const_s21_vector.at(i), const_std_vector.at(i));
+  EXPECT_TRUE(set.erase(set.find(1)));
+  EXPECT_FALSE(set.erase(set.end()));
+  EXPECT_TRUE(set.remove(5));
+  EXPECT_FALSE(set.contains(5));
+
+  auto result = set.insert_many(9, 2, 7, 7);
+  ASSERT_EQ(result.size(), 4);
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_TRUE(result[2].second);
+  EXPECT_FALSE(result[3].second);
+  EXPECT_EQ(*result[0].first, 9);
+  EXPECT_EQ(*result[3].first, 7);
+  EXPECT_EQ(set.size(), 5);
+
+  s21::FlatSet<int> other{ 1, 2, 100 };
+  other.merge(set);
+  EXPECT_EQ(other.size(), 7);
+
+  s21::FlatSet<int> moved(std::move(other));
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(moved.size(), 7);
+  moved.swap(set);
+  EXPECT_EQ(set.size(), 7);
+  EXPECT_EQ(moved.size(), 5);
+}
+
+TEST(FlatMultiset, multiset_interface) {
+  s21::FlatMultiset<int> multiset{ 3, 1, 3, 2 };
+
+  EXPECT_EQ(multiset.size(), 4);
+  EXPECT_TRUE(multiset.insert(3).second);
+  EXPECT_EQ(multiset.count(3), 3);
+  EXPECT_EQ(multiset.count(4), 0);
+
+  auto range = multiset.equal_range(3);
+  EXPECT_EQ(range.first, multiset.find(3));
+  EXPECT_EQ(range.second, multiset.end());
+  EXPECT_EQ(range.first.index(), 2);
+
+  auto result = multiset.insert_many(2, 0, 2);
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_TRUE(result[0].second && result[1].second && result[2].second);
+  EXPECT_EQ(result[1].first.index(), 0);
+  EXPECT_EQ(result[0].first.index() + 1, result[2].first.index()); // insertion order kept
+  EXPECT_EQ(multiset.count(2), 3);
+  EXPECT_EQ(multiset.size(), 8);
+
+  int previous = -1;
+  for (auto it = multiset.cbegin(); it != multiset.cend(); ++it) {
+    EXPECT_LE(previous, *it);
+    previous = *it;
   }
 
-  EXPECT_THROW(const_s21_vector.at(10), s21::ArrayException);
-}
+  EXPECT_TRUE(multiset.erase(multiset.find(2)));
+  EXPECT_EQ(multiset.count(2), 2);
+  EXPECT_TRUE(multiset.remove(3));
+  EXPECT_FALSE(multiset.contains(3));
+  EXPECT_FALSE(multiset.remove(3));
+  EXPECT_EQ(multiset.size(), 4);
+  EXPECT_THROW(multiset.find(3), s21::ArrayException);
 
-TEST(Functions_vector, implimentation_operator_index) {
-  s21::Vector<int> s21_vector = {10, 20, 30};
-  std::vector<int> std_vector = {10, 20, 30};
+  s21::FlatMultiset<int> other{ 1, 1 };
+  other.merge(multiset);
+  EXPECT_EQ(other.count(1), 3);
+}
 
-  for (size_t i = 0; i < s21_vector.size(); ++i) {
-    EXPECT_EQ(s21_vector[i], std_vector[i]);
-  }
 
-  s21::Vector<int> const const_s21_vector = s21_vector;
-  std::vector<int> const const_std_vector = std_vector;
+/* ========================================================================= */
+/*                        Frozen Set and Frozen Map                          */
+/* ========================================================================= */
 
-  for (size_t i = 0; i < const_s21_vector.size(); ++i) {
-    EXPECT_EQ(const_s21_vector[i], const_std_vector[i]);
+TEST(FrozenSet, matches_std_set_for_every_size) {
+  // every size gives a different shape of the last level
+  for (int size = 0; size <= 70; ++size) {
+    std::vector<int> values;
+    for (int i = 0; i < size; ++i) {
+      values.push_back(3 * i);
+    }
+
+    s21::FrozenSet<int> set(values.rbegin(), values.rend());
+    std::set<int> expected(values.begin(), values.end());
+    ASSERT_EQ(set.size(), expected.size());
+
+    auto it = set.begin();
+    for (int value : expected) {
+      ASSERT_EQ(*it, value);
+      ++it;
+    }
+    EXPECT_EQ(it, set.end());
+
+    for (int probe = -2; probe <= 3 * size + 1; ++probe) {
+      auto lower = expected.lower_bound(probe);
+      auto upper = expected.upper_bound(probe);
+
+      EXPECT_EQ(set.contains(probe), expected.count(probe) == 1);
+      EXPECT_EQ(set.lower_bound(probe) == set.end(), lower == expected.end());
+      EXPECT_EQ(set.upper_bound(probe) == set.end(), upper == expected.end());
+      if (lower != expected.end()) {
+        EXPECT_EQ(*set.lower_bound(probe), *lower);
+      }
+      if (upper != expected.end()) {
+        EXPECT_EQ(*set.upper_bound(probe), *upper);
+      }
+    }
   }
 }
 
-TEST(Functions_vector, implimentation_front) {
-  s21::Vector<int> s21_vector = {10, 20, 30};
-  std::vector<int> std_vector = {10, 20, 30};
+TEST(FrozenSet, built_from_set_and_vector) {
+  s21::Set<std::string> tree{ "pear", "apple", "plum", "fig" };
+  s21::FrozenSet<std::string> set(tree);
+
+  EXPECT_EQ(set.size(), 4);
+  EXPECT_TRUE(set.contains("fig"));
+  EXPECT_FALSE(set.contains("kiwi"));
+  EXPECT_EQ(*set.find("plum"), "plum");
+  EXPECT_THROW(set.find("kiwi"), s21::ArrayException);
+  EXPECT_EQ(*set.begin(), "apple");
+
+  auto last = set.end();
+  EXPECT_EQ(*(--last), "plum");
+  EXPECT_EQ(*(--last), "pear");
+  EXPECT_THROW(--set.begin(), s21::ArrayException);
+  EXPECT_THROW(++set.end(), s21::ArrayException);
+  EXPECT_THROW(*set.end(), s21::ArrayException);
+
+  s21::Vector<int> vector{ 5, 1, 5, 3, 1 };
+  s21::FrozenSet<int> numbers(vector);
+  EXPECT_EQ(numbers.size(), 3);
+
+  s21::FrozenSet<int> copy(numbers);
+  s21::FrozenSet<int> moved(std::move(numbers));
+  EXPECT_TRUE(numbers.empty());
+  EXPECT_EQ(numbers.begin(), numbers.end());
+  EXPECT_TRUE(copy.contains(3));
+  EXPECT_TRUE(moved.contains(5));
+
+  s21::FrozenSet<int> empty;
+  empty.swap(moved);
+  EXPECT_EQ(empty.size(), 3);
+  EXPECT_TRUE(moved.empty());
+  EXPECT_FALSE(moved.contains(1));
+}
+
+TEST(FrozenSet, built_from_trees_with_other_comparators) {
+  s21::Set<int, std::greater<int>> descending{ 4, 1, 7, 3, 6, 2, 5 };
+  s21::FrozenSet<int, std::greater<int>> set(descending);
+
+  EXPECT_EQ(*set.begin(), 7);
+  for (int i = 1; i <= 7; ++i) {
+    EXPECT_TRUE(set.contains(i)) << i;
+  }
 
-  s21::Vector<int> const const_s21_vector = s21_vector;
-  std::vector<int> const const_std_vector = std_vector;
+  // a tree sorted differently is not taken as if it were sorted, its elements are sorted again
+  static_assert(!std::is_constructible<s21::FrozenSet<int, std::greater<int>>, const s21::Set<int>&>::value);
+  static_assert(!std::is_constructible<s21::FrozenMap<int, int, std::greater<int>>,
+                                       const s21::Map<int, int>&>::value);
 
-  EXPECT_EQ(const_s21_vector.front(), const_std_vector.front());
+  s21::Set<int> ascending{ 4, 1, 7, 3, 6, 2, 5 };
+  s21::Vector<int> elements;
+  for (auto it = ascending.begin(); it != ascending.end(); ++it) {
+    elements.push_back(*it);
+  }
+  s21::FrozenSet<int, std::greater<int>> resorted(elements);
 
-  s21::Vector<int> const const_s21_vector_empty;
+  EXPECT_EQ(*resorted.begin(), 7);
+  for (int i = 1; i <= 7; ++i) {
+    EXPECT_TRUE(resorted.contains(i)) << i;
+  }
 
-  EXPECT_THROW(const_s21_vector_empty.front(), s21::ArrayException);
+  s21::Map<int, char, std::greater<int>> tree{ { 1, 'a' }, { 3, 'c' }, { 2, 'b' } };
+  s21::FrozenMap<int, char, std::greater<int>> map(tree);
+
+  EXPECT_EQ(map.begin().key(), 3);
+  EXPECT_EQ(map.at(1), 'a');
+  EXPECT_EQ(map.at(2), 'b');
+}
+
+TEST(FrozenSet, throwing_copies_destroy_only_built_keys) {
+  struct ByValue {
+    bool operator()(const ThrowingCopy &a, const ThrowingCopy &b) const { return a.value < b.value; }
+  };
+  using Frozen = s21::FrozenSet<ThrowingCopy, ByValue>;
+
+  ThrowingCopy::copies_left = 1000;
+  const int alive = ThrowingCopy::alive;
+  {
+    std::vector<ThrowingCopy> source;
+    for (int i = 0; i < 20; ++i) {
+      source.emplace_back((i * 7) % 20);
+    }
+
+    // every copy in turn fails: building stops somewhere in the middle of the
+    // in-order walk over the slots
+    bool built = false;
+    for (int budget = 0; !built; ++budget) {
+      ThrowingCopy::copies_left = budget;
+      try {
+        Frozen set(source.begin(), source.end());
+        built = true;
+        EXPECT_EQ(set.size(), 20);
+      } catch (const std::runtime_error &) {
+      }
+      EXPECT_EQ(ThrowingCopy::alive, alive + 20) << budget;
+    }
+
+    ThrowingCopy::copies_left = 1000;
+    const Frozen set(source.begin(), source.end());
+
+    for (int budget = 0; budget < 20; ++budget) {
+      ThrowingCopy::copies_left = budget;
+      EXPECT_THROW(Frozen copy(set), std::runtime_error);
+      EXPECT_EQ(ThrowingCopy::alive, alive + 40) << budget;
+    }
+
+    ThrowingCopy::copies_left = 1000;
+  }
+  EXPECT_EQ(ThrowingCopy::alive, alive);
 }
 
-TEST(Functions_vector, implimentation_back) {
-  s21::Vector<int> s21_vector = {12, 22, 32};
-  std::vector<int> std_vector = {12, 22, 32};
-
-  s21::Vector<int> const const_s21_vector = s21_vector;
-  std::vector<int> const const_std_vector = std_vector;
+TEST(FrozenMap, const_map_gives_const_iterators) {
+  using Map = s21::FrozenMap<int, int>;
 
-  EXPECT_EQ(const_s21_vector.back(), const_std_vector.back());
+  static_assert(std::is_same<decltype(*std::declval<const Map&>().find(0)), const int&>::value);
+  static_assert(std::is_same<decltype(*std::declval<const Map&>().lower_bound(0)), const int&>::value);
+  static_assert(std::is_same<decltype(*std::declval<const Map&>().upper_bound(0)), const int&>::value);
+  static_assert(std::is_same<decltype(*std::declval<Map&>().find(0)), int&>::value);
 
-  s21::Vector<int> const const_s21_vector_empty;
+  Map map{ { 1, 10 }, { 2, 20 } };
+  const Map &view = map;
 
-  EXPECT_THROW(const_s21_vector_empty.back(), s21::ArrayException);
+  *map.find(1) = 11;
+  s21::FrozenMap<int, int>::ConstIterator it = map.find(2); // mutable converts to const
+  EXPECT_EQ(*it, 20);
+  EXPECT_EQ(*view.find(1), 11);
+  EXPECT_EQ(view.lower_bound(2), it);
+  EXPECT_EQ(view.upper_bound(2), view.cend());
 }
 
-TEST(Functions_vector, implimentation_data) {
-  s21::Vector<int> s21_vector;
-  std::vector<int> std_vector;
+TEST(FrozenMap, map_interface) {
+  s21::Map<int, std::string> tree;
+  for (int i = 0; i < 100; ++i) {
+    tree.insert(2 * i, std::to_string(i));
+  }
 
-  s21_vector.push_back(154);
-  std_vector.push_back(154);
+  s21::FrozenMap<int, std::string> map(tree);
+  EXPECT_EQ(map.size(), 100);
+  EXPECT_EQ(map.at(42), "21");
+  EXPECT_THROW(map.at(43), s21::ArrayException);
+  EXPECT_EQ(map.lower_bound(43).key(), 44);
+  EXPECT_EQ(*map.upper_bound(44), "23");
+  EXPECT_EQ(map.upper_bound(198), map.end());
+
+  map.at(42) = "changed";
+  EXPECT_EQ(*map.find(42), "changed");
+  *map.find(0) = "zero";
+
+  int expected_key = 0;
+  for (auto it = map.cbegin(); it != map.cend(); ++it) {
+    EXPECT_EQ(it.key(), expected_key);
+    expected_key += 2;
+  }
+  EXPECT_EQ(expected_key, 200);
+  EXPECT_EQ(*map.begin(), "zero");
 
-  EXPECT_EQ(*s21_vector.data(), 154);
-  EXPECT_EQ(*s21_vector.data(), *std_vector.data());
+  s21::FrozenMap<std::string, int> small{ std::make_pair("b", 2), std::make_pair("a", 1),
+                                          std::make_pair("b", 3) };
+  EXPECT_EQ(small.size(), 2);
+  EXPECT_EQ(small.at("b"), 2); // the first of equal keys is kept
+
+  s21::FrozenMap<std::string, int> copy(small);
+  s21::FrozenMap<std::string, int> moved(std::move(small));
+  EXPECT_TRUE(small.empty());
+  EXPECT_EQ(copy.at("a"), 1);
+  EXPECT_EQ(moved.at("a"), 1);
 }
 
-TEST(Functions_vector, implimentation_begin) {
-  s21::Vector<int> s21_vector = {12, 22, 32};
-  std::vector<int> std_vector = {12, 22, 32};
 
-  s21::Vector<int>::iterator s21_it = s21_vector.begin();
-  std::vector<int>::iterator std_it = std_vector.begin();
+/* ========================================================================= */
+/*                                BTree Map                                  */
+/* ========================================================================= */
 
-  while (std_it != std_vector.end()) {
-    EXPECT_EQ(*std_it, *s21_it);
+TEST(BTreeMap, map_interface) {
+  s21::BTreeMap<int, int> map{ std::make_pair(1, 10), std::make_pair(2, 20) };
 
-    ++s21_it;
-    ++std_it;
-  }
-}
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(1), 10);
+  EXPECT_THROW(map.at(3), s21::ArrayException);
 
-TEST(Functions_vector, implimentation_end) {
-  s21::Vector<int> s21_vector;
-  std::vector<int> std_vector;
+  EXPECT_TRUE(map.insert(3, 30).second);
+  EXPECT_FALSE(map.insert(std::make_pair(3, 31)).second);
+  EXPECT_EQ(*(map.insert(4, 40).first), 40);
 
-  s21_vector.push_back(12);
-  s21_vector.push_back(22);
-  s21_vector.push_back(32);
+  EXPECT_EQ(map[5], 0); // value initialized
+  map[5] = 50;
+  EXPECT_EQ(map.at(5), 50);
 
-  std_vector.push_back(12);
-  std_vector.push_back(22);
-  std_vector.push_back(32);
+  EXPECT_FALSE(map.insert_or_assign(1, 11).second);
+  EXPECT_TRUE(map.insert_or_assign(6, 60).second);
+  EXPECT_EQ(map.at(1), 11);
 
-  s21::Vector<int>::iterator s21_it = s21_vector.end();
+  EXPECT_EQ(map.lower_bound(0).key(), 1);
+  EXPECT_EQ(map.upper_bound(3).key(), 4);
+  EXPECT_EQ(map.lower_bound(7), map.end());
 
-  std::vector<int>::iterator std_it = std_vector.end();
+  auto last = map.end();
+  EXPECT_EQ(*(--last), 60);
+  EXPECT_THROW(--map.begin(), s21::ArrayException);
+  EXPECT_THROW(++map.end(), s21::ArrayException);
+  EXPECT_THROW(*map.end(), s21::ArrayException);
 
-  --s21_it;
-  --std_it;
+  EXPECT_TRUE(map.erase(map.find(2)));
+  EXPECT_FALSE(map.contains(2));
+  EXPECT_FALSE(map.erase(map.end()));
+  EXPECT_TRUE(map.remove(3));
+  EXPECT_FALSE(map.remove(3));
+  EXPECT_EQ(map.size(), 4);
 
-  while (std_it != std_vector.begin()) {
-    EXPECT_EQ(*std_it, *s21_it);
+  auto result = map.insert_many(std::make_pair(7, 70), std::make_pair(1, 0));
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_EQ(*result[1].first, 11);
 
-    --s21_it;
-    --std_it;
-  }
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
 }
 
-TEST(Functions_vector, implimentation_cbegin) {
-  s21::Vector<int> s21_vector;
-  std::vector<int> std_vector;
-
-  s21_vector.push_back(12);
-  s21_vector.push_back(22);
-  s21_vector.push_back(32);
+TEST(BTreeMap, const_map_gives_const_iterators) {
+  using Map = s21::BTreeMap<int, int>;
 
-  std_vector.push_back(12);
-  std_vector.push_back(22);
-  std_vector.push_back(32);
+  static_assert(std::is_same<decltype(*std::declval<const Map&>().find(0)), const int&>::value);
+  static_assert(std::is_same<decltype(*std::declval<const Map&>().lower_bound(0)), const int&>::value);
+  static_assert(std::is_same<decltype(*std::declval<const Map&>().upper_bound(0)), const int&>::value);
+  static_assert(std::is_same<decltype(*std::declval<Map&>().find(0)), int&>::value);
 
-  s21::Vector<int> const const_s21_vector(s21_vector);
-  std::vector<int> const const_std_vector(std_vector);
+  Map map{ std::make_pair(1, 10), std::make_pair(2, 20) };
+  const Map &view = map;
 
-  EXPECT_EQ(*(const_s21_vector.begin()), *(const_std_vector.begin()));
+  *map.find(1) = 11;
+  s21::BTreeMap<int, int>::ConstIterator it = map.find(2); // mutable converts to const
+  EXPECT_EQ(*it, 20);
+  EXPECT_EQ(*view.find(1), 11);
+  EXPECT_EQ(view.at(1), 11);
+  EXPECT_EQ(view.lower_bound(2), it);
+  EXPECT_EQ(view.upper_bound(2), view.cend());
 }
 
-TEST(Functions_vector, implimentation_cend) {
-  s21::Vector<int> s21_vector;
-  std::vector<int> std_vector;
-
-  s21_vector.push_back(12);
-  s21_vector.push_back(22);
-  s21_vector.push_back(32);
+TEST(BTreeMap, random_operations_match_std_map) {
+  // smallest nodes: 4 elements per leaf, 4 keys per inner node, so there are
+  // lots of splits, borrows and merges on every level
+  s21::BTreeMap<int, int, 64> map;
+  std::map<int, int> expected;
+  unsigned state = 5;
 
-  std_vector.push_back(12);
-  std_vector.push_back(22);
-  std_vector.push_back(32);
+  EXPECT_EQ(map.leaf_capacity(), 4);
+  EXPECT_EQ(map.inner_capacity(), 4);
 
-  s21::Vector<int> const const_s21_vector(s21_vector);
-  std::vector<int> const const_std_vector(std_vector);
+  for (int i = 0; i < 40000; ++i) {
+    state = state * 1103515245u + 12345u;
+    const int key = (state >> 8) % 3000;
 
-  EXPECT_EQ(*(--const_s21_vector.end()), *(--const_std_vector.end()));
-}
+    // grow first, then shrink down to nothing
+    const bool grow = i < 20000 ? (state >> 24) % 4 != 0 : (state >> 24) % 4 == 0;
 
-// TEST(Functions_vector, implimentation_rbegin) {
-//   s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};;
-//   std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};;
+    if (grow) {
+      EXPECT_EQ(map.insert(key, i).second, expected.emplace(key, i).second);
+    } else {
+      EXPECT_EQ(map.remove(key), expected.erase(key) == 1);
+    }
+  }
 
-//   s21::Vector<int>::reverse_iterator s21_rit = s21_vector.rbegin();
+  for (int key = 0; key < 3000; ++key) {
+    map.remove(key);
+    expected.erase(key);
+
+    if (key % 500 == 0 || key == 2999) {
+      ASSERT_EQ(map.size(), expected.size());
+
+      auto it = map.cbegin();
+      for (const auto &item : expected) {
+        ASSERT_EQ(it.key(), item.first);
+        ASSERT_EQ(*it, item.second);
+        ++it;
+      }
+      EXPECT_EQ(it, map.cend());
+
+      auto back = map.cend();
+      for (auto item = expected.rbegin(); item != expected.rend(); ++item) {
+        --back;
+        ASSERT_EQ(back.key(), item->first);
+      }
+    }
+  }
 
-//   std::vector<int>::reverse_iterator std_rit = std_vector.rbegin();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.cbegin(), map.cend());
+}
 
-//   while(std_rit != std_vector.rend())
-//   {
-//     std::cout << *std_rit << " " << *s21_rit << std::endl;
-//     EXPECT_EQ(*std_rit, *s21_rit);
+TEST(BTreeMap, copy_move_swap_and_merge) {
+  s21::BTreeMap<std::string, int, 128> map;
+  for (int i = 0; i < 1000; ++i) {
+    map.insert("key" + std::to_string(i), i);
+  }
 
-//     ++std_rit;
-//     ++s21_rit;
-//   }
-// }
+  s21::BTreeMap<std::string, int, 128> copy(map);
+  copy["extra"] = 1;
+  EXPECT_EQ(map.size(), 1000);
+  EXPECT_EQ(copy.size(), 1001);
+  EXPECT_EQ(copy.at("key500"), 500);
+
+  // leaves of the copy are linked in order
+  size_t visited = 0;
+  std::string previous;
+  for (auto it = copy.cbegin(); it != copy.cend(); ++it) {
+    EXPECT_LT(previous, it.key());
+    previous = it.key();
+    ++visited;
+  }
+  EXPECT_EQ(visited, 1001);
 
-TEST(Functions_vector, implimentation_reserve) {
-  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
-  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
+  s21::BTreeMap<std::string, int, 128> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(copy.begin(), copy.end());
+  EXPECT_EQ(moved.size(), 1001);
 
-  s21_vector.reserve(44);
-  std_vector.reserve(44);
+  s21::BTreeMap<std::string, int, 128> other{ std::make_pair(std::string("a"), 1) };
+  other.swap(moved);
+  EXPECT_EQ(other.size(), 1001);
+  EXPECT_EQ(moved.size(), 1);
 
-  EXPECT_EQ(s21_vector.capacity(), std_vector.capacity());
-  EXPECT_EQ(s21_vector.capacity(), 44);
+  moved.merge(map);
+  EXPECT_EQ(moved.size(), 1001);
+  EXPECT_EQ(moved.at("a"), 1);
 }
 
-TEST(Functions_vector, implimentation_capacity) {
-  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
-  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
 
-  EXPECT_EQ(s21_vector.capacity(), std_vector.capacity());
-}
+/* ========================================================================= */
+/*                            Transparent Lookup                             */
+/* ========================================================================= */
 
-TEST(Functions_vector, implimentation_shrink_to_fit) {
-  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
-  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
+// keys are longer than the small string buffer, so building one allocates
+static const char* const kLongKeys[] = {
+  "transparent lookup key number one",
+  "transparent lookup key number two",
+  "transparent lookup key number three",
+};
 
-  s21_vector.reserve(80);
-  std_vector.reserve(80);
+TEST(TransparentLookup, map_lookups_do_not_allocate) {
+  s21::Map<std::string, int, std::less<>> map;
 
-  s21_vector.shrink_to_fit();
-  std_vector.shrink_to_fit();
+  for (int i = 0; i < 3; ++i) {
+    map.insert(kLongKeys[i], i);
+  }
 
-  EXPECT_EQ(s21_vector.size(), 6);
-  EXPECT_EQ(s21_vector.capacity(), 6);
+  const std::string_view view = kLongKeys[1];
+  const char* missing = "transparent lookup key that is missing";
 
-  EXPECT_EQ(s21_vector.size(), std_vector.size());
-  EXPECT_EQ(s21_vector.capacity(), std_vector.capacity());
-}
+  size_t before = allocations_count;
 
-TEST(Functions_vector, implimentation_clear) {
-  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
-  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
+  EXPECT_EQ(map.at(view), 1);
+  EXPECT_EQ(map.at(kLongKeys[2]), 2);
+  EXPECT_EQ(*map.find(view), 1);
+  EXPECT_TRUE(map.contains(view));
+  EXPECT_FALSE(map.contains(missing));
+  EXPECT_EQ(map.count(kLongKeys[0]), 1U);
+  EXPECT_EQ(map.count(missing), 0U);
+  EXPECT_EQ(*map.lower_bound(std::string_view("transparent lookup key number t")), 2);
 
-  s21_vector.clear();
-  std_vector.clear();
+  EXPECT_EQ(allocations_count - before, 0U);
 
-  EXPECT_EQ(s21_vector.size(), 0);
-  EXPECT_EQ(s21_vector.size(), std_vector.size());
+  EXPECT_THROW(map.at(missing), s21::ArrayException);
 }
 
-TEST(Functions_vector, implimentation_insert) {
-  s21::Vector<int> s21_vector;
-  std::vector<int> std_vector;
+TEST(TransparentLookup, set_lookups_do_not_allocate) {
+  s21::Set<std::string, std::less<>> set;
 
-  for (size_t i = 0; i < 10; ++i) {
-    std_vector.push_back(i * 3);
-    s21_vector.push_back(i * 3);
+  for (const char* key : kLongKeys) {
+    set.insert(key);
   }
 
-  s21_vector.insert(++s21_vector.begin(), 33);
-  std_vector.insert(++std_vector.begin(), 33);
+  const std::string_view view = kLongKeys[0];
 
-  for (size_t i = 0; i < s21_vector.size(); ++i) {
-    EXPECT_EQ(s21_vector[i], std_vector[i]);
-  }
+  size_t before = allocations_count;
 
-  s21_vector.insert(s21_vector.end(), 44);
-  std_vector.insert(std_vector.end(), 44);
+  EXPECT_EQ(*set.find(view), kLongKeys[0]);
+  EXPECT_TRUE(set.contains(kLongKeys[2]));
+  EXPECT_EQ(set.count(view), 1U);
+  EXPECT_EQ(set.count("transparent lookup key that is missing"), 0U);
+  EXPECT_EQ(*set.lower_bound(std::string_view("transparent lookup key number s")), kLongKeys[2]);
+  EXPECT_EQ(set.lower_bound(std::string_view("zzz")), set.end());
 
-  for (size_t i = 0; i < s21_vector.size(); ++i) {
-    EXPECT_EQ(s21_vector[i], std_vector[i]);
-  }
+  EXPECT_EQ(allocations_count - before, 0U);
 }
 
-TEST(Functions_vector, implimentation_erase) {
-  s21::Vector<int> s21_vector;
-  std::vector<int> std_vector;
+TEST(TransparentLookup, multiset_lookups_do_not_allocate) {
+  s21::Multiset<std::string, std::less<>> multiset;
 
-  for (size_t i = 0; i < 10; ++i) {
-    std_vector.push_back(i);
-    s21_vector.push_back(i);
-  }
+  multiset.insert(kLongKeys[0]);
+  multiset.insert(kLongKeys[1]);
+  multiset.insert(kLongKeys[1]);
+  multiset.insert(kLongKeys[2]);
 
-  s21_vector.erase(++s21_vector.begin());
-  std_vector.erase(++std_vector.begin());
+  const std::string_view view = kLongKeys[1];
 
-  for (size_t i = 0; i < std_vector.size(); ++i) {
-    EXPECT_EQ(s21_vector[i], std_vector[i]);
-  }
+  size_t before = allocations_count;
 
-  s21_vector.erase(--s21_vector.end());
-  std_vector.erase(--std_vector.end());
+  EXPECT_EQ(*multiset.find(view), kLongKeys[1]);
+  EXPECT_TRUE(multiset.contains(view));
+  EXPECT_EQ(multiset.count(view), 2U);
+  EXPECT_EQ(multiset.count("transparent lookup key that is missing"), 0U);
+  EXPECT_EQ(*multiset.lower_bound(view), kLongKeys[1]);
+  EXPECT_EQ(*multiset.upper_bound(kLongKeys[0]), kLongKeys[2]);
+  EXPECT_EQ(multiset.upper_bound(view), multiset.end());
 
-  for (size_t i = 0; i < s21_vector.size(); ++i) {
-    EXPECT_EQ(s21_vector[i], std_vector[i]);
-  }
+  EXPECT_EQ(allocations_count - before, 0U);
 }
 
-TEST(Functions_vector, implimentation_push_back) {
-  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
-  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
-
-  for (size_t i = 0; i < 10; ++i) {
-    std_vector.push_back(i);
-    s21_vector.push_back(i);
-  }
+TEST(TransparentLookup, default_comparator_still_converts_keys) {
+  s21::Map<std::string, int> map{ {"a", 1}, {"b", 2} };
+  s21::Multiset<int> multiset{ 3, 1, 3 };
 
-  for (size_t i = 0; i < std_vector.size(); ++i) {
-    EXPECT_EQ(s21_vector[i], std_vector[i]);
-  }
+  EXPECT_EQ(map.at("b"), 2);
+  EXPECT_EQ(map.count("c"), 0U);
+  EXPECT_EQ(multiset.count(2), 0U);
+  EXPECT_EQ(multiset.count(3), 2U);
 }
 
-TEST(Functions_vector, implimentation_pop_back) {
-  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
-  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
 
-  s21_vector.pop_back();
-  std_vector.pop_back();
+/* ========================================================================= */
+/*                             Tree Comparators                              */
+/* ========================================================================= */
 
-  for (size_t i = 0; i < std_vector.size(); ++i) {
-    EXPECT_EQ(s21_vector[i], std_vector[i]);
+static size_t comparisons_count = 0;
+
+struct CountingLess {
+  bool operator()(int a, int b) const {
+    ++comparisons_count;
+    return a < b;
   }
+};
 
-  EXPECT_EQ(s21_vector.size(), std_vector.size());
-}
+// orders from the biggest to the smallest
+struct CountingThreeWay {
+  int operator()(int a, int b) const {
+    ++comparisons_count;
+    return (b > a) - (b < a);
+  }
+};
 
-TEST(Functions_vector, implimentation_swap) {
-  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
-  s21::Vector<int> s21_vector_swap = {22, 33, 77, 88};
-  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
-  std::vector<int> std_vector_swap = {22, 33, 77, 88};
+// keys inserted level by level make a full tree of depth 4
+static const int kLevelOrder[] = { 8, 4, 12, 2, 6, 10, 14, 1, 3, 5, 7, 9, 11, 13, 15 };
 
-  s21_vector.swap(s21_vector_swap);
-  std_vector.swap(std_vector_swap);
+TEST(TreeComparators, less_makes_one_comparison_per_level) {
+  s21::Set<int, CountingLess> set;
 
-  for (size_t i = 0; i < std_vector.size(); ++i) {
-    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  for (int key : kLevelOrder) {
+    set.insert(key);
   }
 
-  for (size_t i = 0; i < std_vector_swap.size(); ++i) {
-    EXPECT_EQ(s21_vector_swap[i], std_vector_swap[i]);
+  for (int key = 0; key <= 16; ++key) {
+    comparisons_count = 0;
+    EXPECT_EQ(set.contains(key), key >= 1 && key <= 15);
+    // every level and one more to check the candidate
+    EXPECT_LE(comparisons_count, 5U);
   }
 }
 
-TEST(Functions_vector, implimentation_swap_one_vector_is_empty) {
-  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
-  s21::Vector<int> s21_vector_swap;
-  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
-  std::vector<int> std_vector_swap;
-
-  s21_vector.swap(s21_vector_swap);
-  std_vector.swap(std_vector_swap);
+TEST(TreeComparators, three_way_makes_one_comparison_per_level) {
+  s21::Map<int, int, CountingThreeWay> map;
 
-  for (size_t i = 0; i < std_vector.size(); ++i) {
-    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  for (int key : kLevelOrder) {
+    map.insert(key, key * 10);
   }
 
-  for (size_t i = 0; i < std_vector_swap.size(); ++i) {
-    EXPECT_EQ(s21_vector_swap[i], std_vector_swap[i]);
+  comparisons_count = 0;
+  EXPECT_EQ(map.at(8), 80);
+  EXPECT_EQ(comparisons_count, 1U);
+
+  for (int key = 1; key <= 15; ++key) {
+    comparisons_count = 0;
+    EXPECT_EQ(map.at(key), key * 10);
+    EXPECT_LE(comparisons_count, 4U);
   }
+
+  comparisons_count = 0;
+  EXPECT_FALSE(map.contains(16));
+  EXPECT_LE(comparisons_count, 4U);
 }
 
-TEST(Functions_vector, insert_many_back) {
-  s21::Vector<int> s21_vector = {1, 4, 5};
+TEST(TreeComparators, insert_of_a_present_key_descends_once) {
+  s21::Map<int, int, CountingLess> map;
+  s21::Set<int, CountingLess> set;
 
-  s21_vector.insert_many_back(55, 88, 99);
+  for (int key : kLevelOrder) {
+    map.insert(key, key * 10);
+    set.insert(key);
+  }
 
-  EXPECT_EQ(s21_vector.size(), 6);
+  // no lookup before the insertion: as many comparisons as finding the key
+  for (int key = 1; key <= 15; ++key) {
+    comparisons_count = 0;
+    map.find(key);
+    const size_t lookup = comparisons_count;
 
-  EXPECT_EQ(s21_vector[0], 1);
-  EXPECT_EQ(s21_vector[1], 4);
-  EXPECT_EQ(s21_vector[2], 5);
-  EXPECT_EQ(s21_vector[3], 55);
-  EXPECT_EQ(s21_vector[4], 88);
-  EXPECT_EQ(s21_vector[5], 99);
+    comparisons_count = 0;
+    EXPECT_FALSE(map.insert(key, 0).second);
+    EXPECT_EQ(comparisons_count, lookup);
+
+    comparisons_count = 0;
+    map[key] += 1;
+    EXPECT_EQ(comparisons_count, lookup);
+
+    comparisons_count = 0;
+    EXPECT_FALSE(set.insert(key).second);
+    EXPECT_EQ(comparisons_count, lookup);
+  }
+
+  EXPECT_EQ(map.at(7), 71);
+  EXPECT_EQ(map[16], 0);
+  EXPECT_EQ(map.size(), 16);
 }
 
-TEST(Functions_vector, insert_many_back_empty) {
-  s21::Vector<int> s21_vector;
+TEST(TreeComparators, three_way_order) {
+  s21::Multiset<int, CountingThreeWay> multiset{ 2, 5, 1, 5, 3 };
 
-  s21_vector.insert_many_back(55, 88, 99);
+  std::vector<int> order;
+  for (auto it = multiset.begin(); it != multiset.end(); ++it) {
+    order.push_back(*it);
+  }
 
-  EXPECT_EQ(s21_vector.size(), 3);
+  EXPECT_EQ(order, std::vector<int>({ 5, 5, 3, 2, 1 }));
+  EXPECT_EQ(multiset.count(5), 2U);
+  EXPECT_EQ(*multiset.lower_bound(4), 3);
+  EXPECT_EQ(*multiset.upper_bound(5), 3);
 
-  EXPECT_EQ(s21_vector[0], 55);
-  EXPECT_EQ(s21_vector[1], 88);
-  EXPECT_EQ(s21_vector[2], 99);
+  auto range = multiset.equal_range(5);
+  EXPECT_EQ(*range.first, 5);
+  EXPECT_EQ(*range.second, 3);
+
+  EXPECT_TRUE(multiset.remove(5));
+  EXPECT_TRUE(multiset.remove(3));
+  EXPECT_FALSE(multiset.remove(4));
+  EXPECT_EQ(multiset.count(5), 1U);
+  EXPECT_EQ(multiset.size(), 3U);
 }
 
-TEST(Functions_vector, insert_many) {
-  s21::Vector<int> s21_vector = {1, 2, 3, 4, 5, 6};
 
-  s21::Vector<int>::iterator iter = s21_vector.begin();
-  iter++;
-  iter++;
+/* ========================================================================= */
+/*                                 Multimap                                  */
+/* ========================================================================= */
 
-  s21_vector.insert_many(iter, 10, 11, 12);
+TEST(Multimap, keeps_every_value) {
+  s21::Multimap<int, std::string> map{ {2, "b1"}, {1, "a1"}, {2, "b2"}, {3, "c1"}, {2, "b3"} };
 
-  EXPECT_EQ(s21_vector.size(), 9);
+  EXPECT_EQ(map.size(), 5U);
+  EXPECT_EQ(map.count(2), 3U);
+  EXPECT_EQ(map.count(4), 0U);
+  EXPECT_TRUE(map.contains(3));
 
-  EXPECT_EQ(s21_vector[0], 1);
-  EXPECT_EQ(s21_vector[1], 2);
-  EXPECT_EQ(s21_vector[2], 10);
-  EXPECT_EQ(s21_vector[3], 11);
-  EXPECT_EQ(s21_vector[4], 12);
-  EXPECT_EQ(s21_vector[5], 3);
-  EXPECT_EQ(s21_vector[6], 4);
-  EXPECT_EQ(s21_vector[7], 5);
-  EXPECT_EQ(s21_vector[8], 6);
+  std::vector<std::pair<int, std::string>> items;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    items.emplace_back(it.key(), *it);
+  }
+
+  const std::vector<std::pair<int, std::string>> expected{
+    {1, "a1"}, {2, "b1"}, {2, "b2"}, {2, "b3"}, {3, "c1"} };
+  EXPECT_EQ(items, expected);
+
+  auto it = map.find(3);
+  --it;
+  EXPECT_EQ(*it, "b3");
+  --it;
+  --it;
+  --it;
+  EXPECT_EQ(*it, "a1");
+  EXPECT_EQ(it, map.begin());
 }
 
-TEST(Functions_vector, insert_many_to_begin) {
-  s21::Vector<int> s21_vector = {1, 2, 3, 4, 5, 6};
+TEST(Multimap, equal_range_walks_the_bucket) {
+  s21::Multimap<int, int> map;
 
-  s21::Vector<int>::iterator iter = s21_vector.begin();
+  for (int i = 0; i < 100; ++i) {
+    map.insert(i % 4, i);
+  }
 
-  s21_vector.insert_many(iter, 20, 21, 22);
+  auto range = map.equal_range(2);
+  std::vector<int> values;
+  for (auto it = range.first; it != range.second; ++it) {
+    EXPECT_EQ(it.key(), 2);
+    values.push_back(*it);
+  }
 
-  EXPECT_EQ(s21_vector.size(), 9);
+  ASSERT_EQ(values.size(), 25U);
+  for (int i = 0; i < 25; ++i) {
+    EXPECT_EQ(values[i], 4 * i + 2);
+  }
 
-  EXPECT_EQ(s21_vector[0], 20);
-  EXPECT_EQ(s21_vector[1], 21);
-  EXPECT_EQ(s21_vector[2], 22);
-  EXPECT_EQ(s21_vector[3], 1);
-  EXPECT_EQ(s21_vector[4], 2);
-  EXPECT_EQ(s21_vector[5], 3);
-  EXPECT_EQ(s21_vector[6], 4);
-  EXPECT_EQ(s21_vector[7], 5);
-  EXPECT_EQ(s21_vector[8], 6);
+  EXPECT_EQ(range.second.key(), 3);
+  EXPECT_EQ(range.second, map.upper_bound(2));
+  EXPECT_EQ(map.equal_range(3).second, map.end());
+
+  auto missing = map.equal_range(7);
+  EXPECT_EQ(missing.first, missing.second);
+  EXPECT_EQ(missing.first, map.end());
 }
 
-TEST(Functions_vector, insert_many_to_end) {
-  s21::Vector<int> s21_vector = {1, 2, 3, 4, 5, 6};
+TEST(Multimap, erase_and_remove) {
+  s21::Multimap<int, int> map{ {5, 50}, {5, 51}, {5, 52}, {3, 30}, {8, 80}, {4, 40}, {7, 70} };
 
-  s21::Vector<int>::iterator iter = s21_vector.end();
+  auto it = map.find(5);
+  ++it;
+  EXPECT_TRUE(map.erase(it));
+  EXPECT_EQ(map.size(), 6U);
+  EXPECT_EQ(map.count(5), 2U);
+  EXPECT_EQ(*map.find(5), 50);
+  EXPECT_EQ(*(++map.find(5)), 52);
 
-  s21_vector.insert_many(iter, 10, 11, 12);
+  // the root has two children, its bucket is replaced by the successor's
+  EXPECT_TRUE(map.remove(5));
+  EXPECT_EQ(map.size(), 4U);
+  EXPECT_FALSE(map.contains(5));
+  EXPECT_FALSE(map.remove(5));
+  EXPECT_EQ(*map.find(7), 70);
 
-  EXPECT_EQ(s21_vector.size(), 9);
+  EXPECT_TRUE(map.erase(map.find(3)));
+  EXPECT_EQ(map.size(), 3U);
+  EXPECT_THROW(map.find(3), s21::ArrayException);
 
-  EXPECT_EQ(s21_vector[0], 1);
-  EXPECT_EQ(s21_vector[1], 2);
-  EXPECT_EQ(s21_vector[2], 3);
-  EXPECT_EQ(s21_vector[3], 4);
-  EXPECT_EQ(s21_vector[4], 5);
-  EXPECT_EQ(s21_vector[5], 6);
-  EXPECT_EQ(s21_vector[6], 10);
-  EXPECT_EQ(s21_vector[7], 11);
-  EXPECT_EQ(s21_vector[8], 12);
+  s21::Multimap<int, int> other{ {7, 71}, {9, 90} };
+  map.merge(other);
+  EXPECT_EQ(map.size(), 5U);
+  EXPECT_EQ(map.count(7), 2U);
+  EXPECT_EQ(*(++map.find(7)), 71);
+
+  s21::Multimap<int, int> copy(map);
+  map.clear();
+  EXPECT_EQ(copy.size(), 5U);
+  EXPECT_EQ(copy.count(7), 2U);
 }
 
-TEST(Functions_vector, insert_many_to_empty_vector) {
-  s21::Vector<int> s21_vector;
+TEST(Multimap, transparent_lookup) {
+  s21::Multimap<std::string, int, std::less<>> map;
 
-  s21::Vector<int>::iterator iter = s21_vector.begin();
+  map.insert(kLongKeys[0], 1);
+  map.insert(kLongKeys[0], 2);
+  map.insert(kLongKeys[1], 3);
 
-  s21_vector.insert_many(iter, 10, 11, 12);
+  const std::string_view view = kLongKeys[0];
 
-  EXPECT_EQ(s21_vector.size(), 3);
+  size_t before = allocations_count;
 
-  EXPECT_EQ(s21_vector[0], 10);
-  EXPECT_EQ(s21_vector[1], 11);
-  EXPECT_EQ(s21_vector[2], 12);
+  EXPECT_EQ(map.count(view), 2U);
+  EXPECT_EQ(*map.find(view), 1);
+  auto range = map.equal_range(view);
+  EXPECT_EQ(*range.first, 1);
+  EXPECT_EQ(*range.second, 3);
+
+  EXPECT_EQ(allocations_count - before, 0U);
 }
 
 
 /* ========================================================================= */
-/*                                 Array                                     */
+/*                                Static Map                                 */
 /* ========================================================================= */
 
-TEST(Array, creating_an_array) {
-  s21::Array<int, 5> array;
+// tables below are built by the compiler, static_assert checks them while the
+// tests compile
+enum class Opcode { kAdd, kSub, kMul, kJmp, kRet };
+
+constexpr auto kOpcodes = s21::make_static_map<std::string_view, Opcode>({
+  { "sub", Opcode::kSub }, { "ret", Opcode::kRet }, { "add", Opcode::kAdd },
+  { "jmp", Opcode::kJmp }, { "mul", Opcode::kMul },
+});
+
+static_assert(kOpcodes.size() == 5);
+static_assert(kOpcodes.at("add") == Opcode::kAdd);
+static_assert(kOpcodes.at("ret") == Opcode::kRet);
+static_assert(kOpcodes.contains("jmp") && !kOpcodes.contains("div") && !kOpcodes.contains(""));
+static_assert(kOpcodes.lookup("div") == nullptr && *kOpcodes.lookup("mul") == Opcode::kMul);
+static_assert(kOpcodes.begin().key() == "sub" && kOpcodes.find("add").index() == 2);
+
+constexpr auto kNames = s21::make_static_map<Opcode, std::string_view>({
+  { Opcode::kAdd, "add" }, { Opcode::kSub, "sub" }, { Opcode::kMul, "mul" },
+});
+
+static_assert(kNames.at(Opcode::kMul) == "mul" && !kNames.contains(Opcode::kJmp));
+
+// keys differ only in the high bits, the hash still has to tell them apart
+struct Spread {
+  std::pair<uint64_t, size_t> items[256] = {};
+
+  constexpr Spread() {
+    for (size_t i = 0; i < 256; ++i) {
+      items[i].first = static_cast<uint64_t>(i) << 48;
+      items[i].second = i;
+    }
+  }
+};
 
-  EXPECT_FALSE(array.empty());
-  EXPECT_EQ(array.size(), 5);
+constexpr auto kSpread = s21::make_static_map(Spread().items);
 
-  // EXPECT_EQ(array[0], 0);
-  // EXPECT_EQ(array[1], 0);
-  // EXPECT_EQ(array[2], 0);
-  // EXPECT_EQ(array[3], 0);
-  // EXPECT_EQ(array[4], 0);
+constexpr bool findsAllSpread() {
+  for (size_t i = 0; i < 256; ++i) {
+    if (kSpread.at(static_cast<uint64_t>(i) << 48) != i || kSpread.contains((static_cast<uint64_t>(i) << 48) + 1)) {
+      return false;
+    }
+  }
 
-  EXPECT_THROW(array.at(5), s21::ArrayException);
-  EXPECT_THROW(array.at(-1), s21::ArrayException);
+  return true;
 }
 
-TEST(Array, creating_an_array_using_initializer_list) {
-  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
-
-  EXPECT_FALSE(array.empty());
-  EXPECT_EQ(array.size(), 5);
+static_assert(findsAllSpread());
 
-  EXPECT_EQ(array[0], 1);
-  EXPECT_EQ(array[1], 2);
-  EXPECT_EQ(array[2], 3);
-  EXPECT_EQ(array[3], 4);
-  EXPECT_EQ(array[4], 5);
-}
+TEST(StaticMap, finds_every_key_and_no_other) {
+  std::pair<int, int> items[1000] = {};
 
-TEST(Array, creating_an_array_using_copy_constructor) {
-  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+  for (int i = 0; i < 1000; ++i) {
+    items[i] = { i * 64, i };
+  }
 
-  s21::Array<int, 5> array2 = array;
+  s21::StaticMap<int, int, 1000> map(items);
 
-  EXPECT_EQ(array.size(), 5);
-  EXPECT_EQ(array2.size(), 5);
+  for (int key = -64; key < 64 * 1000 + 64; ++key) {
+    if (key >= 0 && key < 64 * 1000 && key % 64 == 0) {
+      EXPECT_EQ(map.at(key), key / 64) << key;
+    } else {
+      EXPECT_FALSE(map.contains(key)) << key;
+    }
+  }
 
-  EXPECT_EQ(array[0], 1);
-  EXPECT_EQ(array[1], 2);
-  EXPECT_EQ(array[2], 3);
-  EXPECT_EQ(array[3], 4);
-  EXPECT_EQ(array[4], 5);
+  s21::StaticMap<int, int, 1> single({ { 4, 40 } });
 
-  EXPECT_EQ(array2[0], 1);
-  EXPECT_EQ(array2[1], 2);
-  EXPECT_EQ(array2[2], 3);
-  EXPECT_EQ(array2[3], 4);
-  EXPECT_EQ(array2[4], 5);
+  EXPECT_EQ(single.at(4), 40);
+  EXPECT_FALSE(single.contains(3));
+  EXPECT_FALSE(single.contains(5));
 }
 
-TEST(Array, creating_an_array_using_move_constructor) {
-  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+TEST(StaticMap, missing_keys_and_duplicates_throw) {
+  EXPECT_THROW(kOpcodes.at("div"), s21::ArrayException);
+  EXPECT_THROW(kOpcodes.find("div"), s21::ArrayException);
+  EXPECT_THROW(*kOpcodes.end(), s21::ArrayException);
+  EXPECT_THROW((s21::make_static_map<int, int>({ { 1, 1 }, { 2, 2 }, { 1, 3 } })), s21::ArrayException);
+}
 
-  s21::Array<int, 5> array2 = std::move(array);
+TEST(StaticMap, iterates_in_given_order_without_allocations) {
+  size_t before = allocations_count;
 
-  EXPECT_EQ(array.size(), 5);
-  EXPECT_EQ(array2.size(), 5);
+  std::string names;
+  for (auto it = kOpcodes.cbegin(); it != kOpcodes.cend(); ++it) {
+    names += it.key()[0];
+  }
 
-  EXPECT_EQ(array[0], 0);
-  EXPECT_EQ(array[1], 0);
-  EXPECT_EQ(array[2], 0);
-  EXPECT_EQ(array[3], 0);
-  EXPECT_EQ(array[4], 0);
+  s21::StaticMap<std::string_view, Opcode, 5> copy = kOpcodes;
+  EXPECT_EQ(*copy.find("jmp"), Opcode::kJmp);
+  EXPECT_EQ(allocations_count - before, 0U);
 
-  EXPECT_EQ(array2[0], 1);
-  EXPECT_EQ(array2[1], 2);
-  EXPECT_EQ(array2[2], 3);
-  EXPECT_EQ(array2[3], 4);
-  EXPECT_EQ(array2[4], 5);
+  EXPECT_EQ(names, "srajm");
 }
 
-TEST(Array, creating_an_array_using_move_assignment) {
-  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+/* ========================================================================= */
+/*                                 Vector                                    */
+/* ========================================================================= */
 
-  s21::Array<int, 5> array2;
+TEST(Creating_vector, vector_of_pairs) {
+  // s21::List<int> list;
 
-  EXPECT_EQ(array.size(), 5);
-  EXPECT_EQ(array2.size(), 5);
+  // s21::Vector<std::pair<s21::List<int>::Iterator, bool>> vector(10);
 
-  array2 = std::move(array);
+  // vector.push_back(std::make_pair(list.begin(), true));
 
-  EXPECT_EQ(array.size(), 5);
-  EXPECT_EQ(array2.size(), 5);
+  // EXPECT_EQ(vector.size(), 1);
 
-  EXPECT_EQ(array[0], 0);
-  EXPECT_EQ(array[1], 0);
-  EXPECT_EQ(array[2], 0);
-  EXPECT_EQ(array[3], 0);
-  EXPECT_EQ(array[4], 0);
+  // std::pair<int, int>* p = new std::pair<int, int>();
+  // printf("p->first = %d, p->second = %d\n", p->first, p->second);
+}
 
-  EXPECT_EQ(array2[0], 1);
-  EXPECT_EQ(array2[1], 2);
-  EXPECT_EQ(array2[2], 3);
-  EXPECT_EQ(array2[3], 4);
-  EXPECT_EQ(array2[4], 5);
+TEST(Creating_vector, empty_vector) {
+  s21::Vector<int> vector;
+  EXPECT_EQ(vector.size(), 0);
+  EXPECT_TRUE(vector.empty());
 }
 
-TEST(Array, testing_access_methods) {
-  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+TEST(Creating_vector, constructor_with_param) {
+  s21::Vector<int> vector(11);
 
-  EXPECT_EQ(array.size(), 5);
+  EXPECT_EQ(vector.size(), 11);
+}
+
+TEST(Creating_vector, constructor_with_initializer_list) {
+  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
+  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
+
+  EXPECT_EQ(s21_vector.size(), std_vector.size());
+
+  for (size_t i = 0; i < s21_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+}
+
+TEST(Creating_vector, constructor_copy) {
+  s21::Vector<int> vector(5);
+
+  vector[0] = 10;
+  vector[1] = 12;
+  vector[2] = 13;
+  vector[3] = 14;
+  vector[4] = 15;
+
+  s21::Vector<int> vectorCopy(vector);
+
+  EXPECT_EQ(vectorCopy.size(), vector.size());
+
+  for (size_t i = 0; i < vectorCopy.size(); ++i) {
+    EXPECT_EQ(vectorCopy[i], vector[i]);
+  }
+}
+
+TEST(Creating_vector, constructor_move) {
+  s21::Vector<int> vector(5);
+
+  vector[0] = 20;
+  vector[1] = 21;
+  vector[2] = 22;
+  vector[3] = 23;
+  vector[4] = 24;
+
+  s21::Vector<int> vectorCopy(std::move(vector));
+
+  EXPECT_EQ(vectorCopy.size(), 5);
+  EXPECT_EQ(vector.size(), 0);
+
+  for (size_t i = 0; i < vectorCopy.size(); ++i) {
+    EXPECT_EQ(vectorCopy[i], 20 + i);
+  }
+}
+
+TEST(Destructor_vector, destructor) {
+  s21::Vector<int> vector(2);
+
+  vector[0] = 20;
+  vector[1] = 21;
+
+  vector.~Vector();
+
+  EXPECT_EQ(vector.size(), 0);
+}
+
+TEST(Assignment_operator_moving_object, Assignment_operator_moving_object) {
+  s21::Vector<int> vector(5);
+
+  vector[0] = 20;
+  vector[1] = 21;
+  vector[2] = 22;
+  vector[3] = 23;
+  vector[4] = 24;
+
+  s21::Vector<int> vectorCopy(5);
+  vectorCopy = (std::move(vector));
+
+  EXPECT_EQ(vectorCopy.size(), 5);
+  EXPECT_EQ(vector.size(), 0);
+
+  for (size_t i = 0; i < vectorCopy.size(); ++i) {
+    EXPECT_EQ(vectorCopy[i], 20 + i);
+  }
+}
+
+TEST(Functions_vector, implimentation_at) {
+  s21::Vector<int> s21_vector = {10, 20, 30};
+  std::vector<int> std_vector = {10, 20, 30};
+
+  for (size_t i = 0; i < s21_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector.at(i), std_vector.at(i));
+  }
+
+  EXPECT_THROW(s21_vector.at(10), s21::ArrayException);
+
+  s21::Vector<int> const const_s21_vector = s21_vector;
+  std::vector<int> const const_std_vector = std_vector;
+
+  for (size_t i = 0; i < const_s21_vector.size(); ++i) {
+    EXPECT_EQ(const_s21_vector.at(i), const_std_vector.at(i));
+  }
+
+  EXPECT_THROW(const_s21_vector.at(10), s21::ArrayException);
+}
+
+TEST(Functions_vector, implimentation_operator_index) {
+  s21::Vector<int> s21_vector = {10, 20, 30};
+  std::vector<int> std_vector = {10, 20, 30};
+
+  for (size_t i = 0; i < s21_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+
+  s21::Vector<int> const const_s21_vector = s21_vector;
+  std::vector<int> const const_std_vector = std_vector;
+
+  for (size_t i = 0; i < const_s21_vector.size(); ++i) {
+    EXPECT_EQ(const_s21_vector[i], const_std_vector[i]);
+  }
+}
+
+TEST(Functions_vector, implimentation_front) {
+  s21::Vector<int> s21_vector = {10, 20, 30};
+  std::vector<int> std_vector = {10, 20, 30};
+
+  s21::Vector<int> const const_s21_vector = s21_vector;
+  std::vector<int> const const_std_vector = std_vector;
+
+  EXPECT_EQ(const_s21_vector.front(), const_std_vector.front());
+
+  s21::Vector<int> const const_s21_vector_empty;
+
+  EXPECT_THROW(const_s21_vector_empty.front(), s21::ArrayException);
+}
+
+TEST(Functions_vector, implimentation_back) {
+  s21::Vector<int> s21_vector = {12, 22, 32};
+  std::vector<int> std_vector = {12, 22, 32};
+
+  s21::Vector<int> const const_s21_vector = s21_vector;
+  std::vector<int> const const_std_vector = std_vector;
+
+  EXPECT_EQ(const_s21_vector.back(), const_std_vector.back());
+
+  s21::Vector<int> const const_s21_vector_empty;
+
+  EXPECT_THROW(const_s21_vector_empty.back(), s21::ArrayException);
+}
+
+TEST(Functions_vector, implimentation_data) {
+  s21::Vector<int> s21_vector;
+  std::vector<int> std_vector;
+
+  s21_vector.push_back(154);
+  std_vector.push_back(154);
+
+  EXPECT_EQ(*s21_vector.data(), 154);
+  EXPECT_EQ(*s21_vector.data(), *std_vector.data());
+}
+
+TEST(Functions_vector, implimentation_begin) {
+  s21::Vector<int> s21_vector = {12, 22, 32};
+  std::vector<int> std_vector = {12, 22, 32};
+
+  s21::Vector<int>::iterator s21_it = s21_vector.begin();
+  std::vector<int>::iterator std_it = std_vector.begin();
+
+  while (std_it != std_vector.end()) {
+    EXPECT_EQ(*std_it, *s21_it);
+
+    ++s21_it;
+    ++std_it;
+  }
+}
+
+TEST(Functions_vector, implimentation_end) {
+  s21::Vector<int> s21_vector;
+  std::vector<int> std_vector;
+
+  s21_vector.push_back(12);
+  s21_vector.push_back(22);
+  s21_vector.push_back(32);
+
+  std_vector.push_back(12);
+  std_vector.push_back(22);
+  std_vector.push_back(32);
+
+  s21::Vector<int>::iterator s21_it = s21_vector.end();
+
+  std::vector<int>::iterator std_it = std_vector.end();
+
+  --s21_it;
+  --std_it;
+
+  while (std_it != std_vector.begin()) {
+    EXPECT_EQ(*std_it, *s21_it);
+
+    --s21_it;
+    --std_it;
+  }
+}
+
+TEST(Functions_vector, implimentation_cbegin) {
+  s21::Vector<int> s21_vector;
+  std::vector<int> std_vector;
+
+  s21_vector.push_back(12);
+  s21_vector.push_back(22);
+  s21_vector.push_back(32);
+
+  std_vector.push_back(12);
+  std_vector.push_back(22);
+  std_vector.push_back(32);
+
+  s21::Vector<int> const const_s21_vector(s21_vector);
+  std::vector<int> const const_std_vector(std_vector);
+
+  EXPECT_EQ(*(const_s21_vector.begin()), *(const_std_vector.begin()));
+}
+
+TEST(Functions_vector, implimentation_cend) {
+  s21::Vector<int> s21_vector;
+  std::vector<int> std_vector;
+
+  s21_vector.push_back(12);
+  s21_vector.push_back(22);
+  s21_vector.push_back(32);
+
+  std_vector.push_back(12);
+  std_vector.push_back(22);
+  std_vector.push_back(32);
+
+  s21::Vector<int> const const_s21_vector(s21_vector);
+  std::vector<int> const const_std_vector(std_vector);
+
+  EXPECT_EQ(*(--const_s21_vector.end()), *(--const_std_vector.end()));
+}
+
+// TEST(Functions_vector, implimentation_rbegin) {
+//   s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};;
+//   std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};;
+
+//   s21::Vector<int>::reverse_iterator s21_rit = s21_vector.rbegin();
+
+//   std::vector<int>::reverse_iterator std_rit = std_vector.rbegin();
+
+//   while(std_rit != std_vector.rend())
+//   {
+//     std::cout << *std_rit << " " << *s21_rit << std::endl;
+//     EXPECT_EQ(*std_rit, *s21_rit);
+
+//     ++std_rit;
+//     ++s21_rit;
+//   }
+// }
+
+TEST(Functions_vector, implimentation_reserve) {
+  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
+  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
+
+  s21_vector.reserve(44);
+  std_vector.reserve(44);
+
+  EXPECT_EQ(s21_vector.capacity(), std_vector.capacity());
+  EXPECT_EQ(s21_vector.capacity(), 44);
+}
+
+TEST(Functions_vector, implimentation_capacity) {
+  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
+  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
+
+  EXPECT_EQ(s21_vector.capacity(), std_vector.capacity());
+}
+
+TEST(Functions_vector, implimentation_shrink_to_fit) {
+  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
+  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
+
+  s21_vector.reserve(80);
+  std_vector.reserve(80);
+
+  s21_vector.shrink_to_fit();
+  std_vector.shrink_to_fit();
+
+  EXPECT_EQ(s21_vector.size(), 6);
+  EXPECT_EQ(s21_vector.capacity(), 6);
+
+  EXPECT_EQ(s21_vector.size(), std_vector.size());
+  EXPECT_EQ(s21_vector.capacity(), std_vector.capacity());
+}
+
+TEST(Functions_vector, implimentation_clear) {
+  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
+  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
+
+  s21_vector.clear();
+  std_vector.clear();
+
+  EXPECT_EQ(s21_vector.size(), 0);
+  EXPECT_EQ(s21_vector.size(), std_vector.size());
+}
+
+TEST(Functions_vector, implimentation_insert) {
+  s21::Vector<int> s21_vector;
+  std::vector<int> std_vector;
+
+  for (size_t i = 0; i < 10; ++i) {
+    std_vector.push_back(i * 3);
+    s21_vector.push_back(i * 3);
+  }
+
+  s21_vector.insert(++s21_vector.begin(), 33);
+  std_vector.insert(++std_vector.begin(), 33);
+
+  for (size_t i = 0; i < s21_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+
+  s21_vector.insert(s21_vector.end(), 44);
+  std_vector.insert(std_vector.end(), 44);
+
+  for (size_t i = 0; i < s21_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+}
+
+TEST(Functions_vector, implimentation_erase) {
+  s21::Vector<int> s21_vector;
+  std::vector<int> std_vector;
+
+  for (size_t i = 0; i < 10; ++i) {
+    std_vector.push_back(i);
+    s21_vector.push_back(i);
+  }
+
+  s21_vector.erase(++s21_vector.begin());
+  std_vector.erase(++std_vector.begin());
+
+  for (size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+
+  s21_vector.erase(--s21_vector.end());
+  std_vector.erase(--std_vector.end());
+
+  for (size_t i = 0; i < s21_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+}
+
+TEST(Functions_vector, implimentation_push_back) {
+  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
+  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
+
+  for (size_t i = 0; i < 10; ++i) {
+    std_vector.push_back(i);
+    s21_vector.push_back(i);
+  }
+
+  for (size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+}
+
+TEST(Functions_vector, implimentation_pop_back) {
+  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
+  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
+
+  s21_vector.pop_back();
+  std_vector.pop_back();
+
+  for (size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+
+  EXPECT_EQ(s21_vector.size(), std_vector.size());
+}
+
+TEST(Functions_vector, implimentation_swap) {
+  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
+  s21::Vector<int> s21_vector_swap = {22, 33, 77, 88};
+  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
+  std::vector<int> std_vector_swap = {22, 33, 77, 88};
+
+  s21_vector.swap(s21_vector_swap);
+  std_vector.swap(std_vector_swap);
+
+  for (size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+
+  for (size_t i = 0; i < std_vector_swap.size(); ++i) {
+    EXPECT_EQ(s21_vector_swap[i], std_vector_swap[i]);
+  }
+}
+
+TEST(Functions_vector, implimentation_swap_one_vector_is_empty) {
+  s21::Vector<int> s21_vector = {1, 3, 5, 8, 10, 25};
+  s21::Vector<int> s21_vector_swap;
+  std::vector<int> std_vector = {1, 3, 5, 8, 10, 25};
+  std::vector<int> std_vector_swap;
+
+  s21_vector.swap(s21_vector_swap);
+  std_vector.swap(std_vector_swap);
+
+  for (size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+
+  for (size_t i = 0; i < std_vector_swap.size(); ++i) {
+    EXPECT_EQ(s21_vector_swap[i], std_vector_swap[i]);
+  }
+}
+
+TEST(Functions_vector, insert_many_back) {
+  s21::Vector<int> s21_vector = {1, 4, 5};
+
+  s21_vector.insert_many_back(55, 88, 99);
+
+  EXPECT_EQ(s21_vector.size(), 6);
+
+  EXPECT_EQ(s21_vector[0], 1);
+  EXPECT_EQ(s21_vector[1], 4);
+  EXPECT_EQ(s21_vector[2], 5);
+  EXPECT_EQ(s21_vector[3], 55);
+  EXPECT_EQ(s21_vector[4], 88);
+  EXPECT_EQ(s21_vector[5], 99);
+}
+
+TEST(Functions_vector, insert_many_back_empty) {
+  s21::Vector<int> s21_vector;
+
+  s21_vector.insert_many_back(55, 88, 99);
+
+  EXPECT_EQ(s21_vector.size(), 3);
+
+  EXPECT_EQ(s21_vector[0], 55);
+  EXPECT_EQ(s21_vector[1], 88);
+  EXPECT_EQ(s21_vector[2], 99);
+}
+
+TEST(Functions_vector, insert_many) {
+  s21::Vector<int> s21_vector = {1, 2, 3, 4, 5, 6};
+
+  s21::Vector<int>::iterator iter = s21_vector.begin();
+  iter++;
+  iter++;
+
+  s21_vector.insert_many(iter, 10, 11, 12);
+
+  EXPECT_EQ(s21_vector.size(), 9);
+
+  EXPECT_EQ(s21_vector[0], 1);
+  EXPECT_EQ(s21_vector[1], 2);
+  EXPECT_EQ(s21_vector[2], 10);
+  EXPECT_EQ(s21_vector[3], 11);
+  EXPECT_EQ(s21_vector[4], 12);
+  EXPECT_EQ(s21_vector[5], 3);
+  EXPECT_EQ(s21_vector[6], 4);
+  EXPECT_EQ(s21_vector[7], 5);
+  EXPECT_EQ(s21_vector[8], 6);
+}
+
+TEST(Functions_vector, insert_many_to_begin) {
+  s21::Vector<int> s21_vector = {1, 2, 3, 4, 5, 6};
+
+  s21::Vector<int>::iterator iter = s21_vector.begin();
+
+  s21_vector.insert_many(iter, 20, 21, 22);
+
+  EXPECT_EQ(s21_vector.size(), 9);
+
+  EXPECT_EQ(s21_vector[0], 20);
+  EXPECT_EQ(s21_vector[1], 21);
+  EXPECT_EQ(s21_vector[2], 22);
+  EXPECT_EQ(s21_vector[3], 1);
+  EXPECT_EQ(s21_vector[4], 2);
+  EXPECT_EQ(s21_vector[5], 3);
+  EXPECT_EQ(s21_vector[6], 4);
+  EXPECT_EQ(s21_vector[7], 5);
+  EXPECT_EQ(s21_vector[8], 6);
+}
+
+TEST(Functions_vector, insert_many_to_end) {
+  s21::Vector<int> s21_vector = {1, 2, 3, 4, 5, 6};
+
+  s21::Vector<int>::iterator iter = s21_vector.end();
+
+  s21_vector.insert_many(iter, 10, 11, 12);
+
+  EXPECT_EQ(s21_vector.size(), 9);
+
+  EXPECT_EQ(s21_vector[0], 1);
+  EXPECT_EQ(s21_vector[1], 2);
+  EXPECT_EQ(s21_vector[2], 3);
+  EXPECT_EQ(s21_vector[3], 4);
+  EXPECT_EQ(s21_vector[4], 5);
+  EXPECT_EQ(s21_vector[5], 6);
+  EXPECT_EQ(s21_vector[6], 10);
+  EXPECT_EQ(s21_vector[7], 11);
+  EXPECT_EQ(s21_vector[8], 12);
+}
+
+TEST(Functions_vector, insert_many_to_empty_vector) {
+  s21::Vector<int> s21_vector;
+
+  s21::Vector<int>::iterator iter = s21_vector.begin();
+
+  s21_vector.insert_many(iter, 10, 11, 12);
+
+  EXPECT_EQ(s21_vector.size(), 3);
+
+  EXPECT_EQ(s21_vector[0], 10);
+  EXPECT_EQ(s21_vector[1], 11);
+  EXPECT_EQ(s21_vector[2], 12);
+}
+
+
+/* ========================================================================= */
+/*                                 Array                                     */
+/* ========================================================================= */
+
+TEST(Array, creating_an_array) {
+  s21::Array<int, 5> array;
+
+  EXPECT_FALSE(array.empty());
+  EXPECT_EQ(array.size(), 5);
+
+  // EXPECT_EQ(array[0], 0);
+  // EXPECT_EQ(array[1], 0);
+  // EXPECT_EQ(array[2], 0);
+  // EXPECT_EQ(array[3], 0);
+  // EXPECT_EQ(array[4], 0);
+
+  EXPECT_THROW(array.at(5), s21::ArrayException);
+  EXPECT_THROW(array.at(-1), s21::ArrayException);
+}
+
+TEST(Array, creating_an_array_using_initializer_list) {
+  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+
+  EXPECT_FALSE(array.empty());
+  EXPECT_EQ(array.size(), 5);
+
+  EXPECT_EQ(array[0], 1);
+  EXPECT_EQ(array[1], 2);
+  EXPECT_EQ(array[2], 3);
+  EXPECT_EQ(array[3], 4);
+  EXPECT_EQ(array[4], 5);
+}
+
+TEST(Array, creating_an_array_using_copy_constructor) {
+  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+
+  s21::Array<int, 5> array2 = array;
+
+  EXPECT_EQ(array.size(), 5);
+  EXPECT_EQ(array2.size(), 5);
+
+  EXPECT_EQ(array[0], 1);
+  EXPECT_EQ(array[1], 2);
+  EXPECT_EQ(array[2], 3);
+  EXPECT_EQ(array[3], 4);
+  EXPECT_EQ(array[4], 5);
+
+  EXPECT_EQ(array2[0], 1);
+  EXPECT_EQ(array2[1], 2);
+  EXPECT_EQ(array2[2], 3);
+  EXPECT_EQ(array2[3], 4);
+  EXPECT_EQ(array2[4], 5);
+}
+
+TEST(Array, creating_an_array_using_move_constructor) {
+  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+
+  s21::Array<int, 5> array2 = std::move(array);
+
+  EXPECT_EQ(array.size(), 5);
+  EXPECT_EQ(array2.size(), 5);
+
+  EXPECT_EQ(array[0], 0);
+  EXPECT_EQ(array[1], 0);
+  EXPECT_EQ(array[2], 0);
+  EXPECT_EQ(array[3], 0);
+  EXPECT_EQ(array[4], 0);
+
+  EXPECT_EQ(array2[0], 1);
+  EXPECT_EQ(array2[1], 2);
+  EXPECT_EQ(array2[2], 3);
+  EXPECT_EQ(array2[3], 4);
+  EXPECT_EQ(array2[4], 5);
+}
+
+TEST(Array, creating_an_array_using_move_assignment) {
+  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+
+  s21::Array<int, 5> array2;
+
+  EXPECT_EQ(array.size(), 5);
+  EXPECT_EQ(array2.size(), 5);
+
+  array2 = std::move(array);
+
+  EXPECT_EQ(array.size(), 5);
+  EXPECT_EQ(array2.size(), 5);
+
+  EXPECT_EQ(array[0], 0);
+  EXPECT_EQ(array[1], 0);
+  EXPECT_EQ(array[2], 0);
+  EXPECT_EQ(array[3], 0);
+  EXPECT_EQ(array[4], 0);
+
+  EXPECT_EQ(array2[0], 1);
+  EXPECT_EQ(array2[1], 2);
+  EXPECT_EQ(array2[2], 3);
+  EXPECT_EQ(array2[3], 4);
+  EXPECT_EQ(array2[4], 5);
+}
+
+TEST(Array, testing_access_methods) {
+  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+
+  EXPECT_EQ(array.size(), 5);
+
+  EXPECT_EQ(array[0], 1);
+  EXPECT_EQ(array[1], 2);
+  EXPECT_EQ(array[2], 3);
+  EXPECT_EQ(array[3], 4);
+  EXPECT_EQ(array[4], 5);
+
+  EXPECT_EQ(array.at(0), 1);
+  EXPECT_EQ(array.at(1), 2);
+  EXPECT_EQ(array.at(2), 3);
+  EXPECT_EQ(array.at(3), 4);
+  EXPECT_EQ(array.at(4), 5);
+
+  EXPECT_THROW(array.at(-1), s21::ArrayException);
+  EXPECT_THROW(array.at(5), s21::ArrayException);
+}
+
+TEST(Array, testing_const_access_methods) {
+  const s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+
+  EXPECT_EQ(array.size(), 5);
 
   EXPECT_EQ(array[0], 1);
   EXPECT_EQ(array[1], 2);
   EXPECT_EQ(array[2], 3);
-  EXPECT_EQ(array[3], 4);
-  EXPECT_EQ(array[4], 5);
+  EXPECT_EQ(array[3], 4);
+  EXPECT_EQ(array[4], 5);
+
+  EXPECT_EQ(array.at(0), 1);
+  EXPECT_EQ(array.at(1), 2);
+  EXPECT_EQ(array.at(2), 3);
+  EXPECT_EQ(array.at(3), 4);
+  EXPECT_EQ(array.at(4), 5);
+
+  EXPECT_THROW(array.at(-1), s21::ArrayException);
+  EXPECT_THROW(array.at(5), s21::ArrayException);
+}
+
+TEST(Array, testing_other_access_methods) {
+  const s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+
+  EXPECT_EQ(array.size(), 5);
+
+  EXPECT_EQ(array.front(), 1);
+  EXPECT_EQ(array.back(), 5);
+}
+
+TEST(Array, getting_access_to_the_underlying_data) {
+  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+
+  EXPECT_EQ(array.size(), 5);
+
+  int* data = array.data();
+
+  EXPECT_EQ(data[0], 1);
+  EXPECT_EQ(data[1], 2);
+  EXPECT_EQ(data[2], 3);
+  EXPECT_EQ(data[3], 4);
+  EXPECT_EQ(data[4], 5);
+
+  data[2] = 9;
+  EXPECT_EQ(data[2], 9);
+}
+
+TEST(Array, getting_access_to_the_underlying_data_const) {
+  const s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+
+  EXPECT_EQ(array.size(), 5);
+
+  const int* data = array.data();
+
+  EXPECT_EQ(data[0], 1);
+  EXPECT_EQ(data[1], 2);
+  EXPECT_EQ(data[2], 3);
+  EXPECT_EQ(data[3], 4);
+  EXPECT_EQ(data[4], 5);
+}
+
+TEST(Array, testing_iterators) {
+  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+
+  EXPECT_EQ(array.size(), 5);
+
+  int* it = array.begin();
+  int count = 0;
+  while (it != array.end()) {
+    EXPECT_EQ(*it, ++count);
+    ++it;
+  }
+}
+
+TEST(Array, testing_const_iterators) {
+  const s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+
+  EXPECT_EQ(array.size(), 5);
+
+  const int* it = array.cbegin();
+  int count = 0;
+  while (it != array.cend()) {
+    EXPECT_EQ(*it, ++count);
+    ++it;
+  }
+}
+
+TEST(Array, swapping_two_array) {
+  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+  s21::Array<int, 5> array2{ 5, 4, 3, 2, 1 };
+
+  EXPECT_EQ(array.size(), 5);
+  EXPECT_EQ(array2.size(), 5);
+
+  array.swap(array2);
+
+  EXPECT_EQ(array.size(), 5);
+  EXPECT_EQ(array2.size(), 5);
+
+  EXPECT_EQ(array[0], 5);
+  EXPECT_EQ(array[1], 4);
+  EXPECT_EQ(array[2], 3);
+  EXPECT_EQ(array[3], 2);
+  EXPECT_EQ(array[4], 1);
+
+  EXPECT_EQ(array2[0], 1);
+  EXPECT_EQ(array2[1], 2);
+  EXPECT_EQ(array2[2], 3);
+  EXPECT_EQ(array2[3], 4);
+  EXPECT_EQ(array2[4], 5);
+}
+
+TEST(Array, autofilling_array) {
+  s21::Array<int, 5> array;
+
+  EXPECT_EQ(array.size(), 5);
+
+  array.fill(999);
+
+  EXPECT_EQ(array.size(), 5);
+
+  EXPECT_EQ(array[0], 999);
+  EXPECT_EQ(array[1], 999);
+  EXPECT_EQ(array[2], 999);
+  EXPECT_EQ(array[3], 999);
+  EXPECT_EQ(array[4], 999);
+}
+
+
+/* ========================================================================= */
+/*                               Intrusive List                              */
+/* ========================================================================= */
+
+struct PooledItem {
+  int value = 0;
+  s21::IntrusiveListHook hook;
+
+  PooledItem(int v = 0) : value{ v } {}
+};
+
+using ItemList = s21::IntrusiveList<PooledItem, &PooledItem::hook>;
+
+TEST(IntrusiveList, linking_and_iterating) {
+  PooledItem items[] = { 1, 2, 3 };
+  ItemList list;
+
+  EXPECT_TRUE(list.empty());
+
+  list.pushBack(items[1]);
+  list.pushBack(items[2]);
+  list.pushFront(items[0]);
+
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list.front().value, 1);
+  EXPECT_EQ(list.back().value, 3);
+
+  int expected = 1;
+  for (ItemList::Iterator it = list.begin(); it != list.end(); ++it) {
+    EXPECT_EQ((*it).value, expected);
+    EXPECT_EQ(&*it, &items[expected - 1]); // no copies are made
+    ++expected;
+  }
+
+  ItemList::Iterator it = list.end();
+  --it;
+  EXPECT_EQ(it->value, 3);
+}
+
+TEST(IntrusiveList, unlinking_by_reference) {
+  PooledItem items[] = { 1, 2, 3, 4 };
+  ItemList list;
+
+  for (PooledItem &item : items) {
+    list.pushBack(item);
+  }
+
+  EXPECT_TRUE(list.remove(items[2]));
+  EXPECT_FALSE(ItemList::isLinked(items[2]));
+  EXPECT_FALSE(list.remove(items[2]));
+
+  EXPECT_EQ(list.size(), 3);
+
+  list.popFront();
+  list.popBack();
+
+  EXPECT_EQ(list.size(), 1);
+  EXPECT_EQ(list.front().value, 2);
+  EXPECT_FALSE(ItemList::isLinked(items[0]));
+  EXPECT_FALSE(ItemList::isLinked(items[3]));
+
+  list.clear();
+  EXPECT_TRUE(list.empty());
+  EXPECT_FALSE(ItemList::isLinked(items[1]));
+
+  EXPECT_THROW(list.front(), s21::ArrayException);
+  EXPECT_THROW(list.back(), s21::ArrayException);
+}
+
+TEST(IntrusiveList, insert_and_erase) {
+  PooledItem items[] = { 1, 2, 3 };
+  ItemList list;
+
+  list.pushBack(items[0]);
+  list.pushBack(items[2]);
+
+  ItemList::Iterator it = list.insert(ItemList::iteratorTo(items[2]), items[1]);
+  EXPECT_EQ(it->value, 2);
+  EXPECT_EQ(list.size(), 3);
+
+  EXPECT_THROW(list.pushBack(items[1]), s21::ArrayException);
+
+  EXPECT_TRUE(list.erase(it));
+  EXPECT_EQ(it->value, 3);
+
+  it = list.end();
+  EXPECT_FALSE(list.erase(it));
+  EXPECT_EQ(list.size(), 2);
+}
+
+TEST(IntrusiveList, splicing_and_moving) {
+  PooledItem items[] = { 1, 2, 3, 4, 5 };
+  ItemList first;
+  ItemList second;
+
+  first.pushBack(items[0]);
+  first.pushBack(items[4]);
+  second.pushBack(items[1]);
+  second.pushBack(items[2]);
+  second.pushBack(items[3]);
+
+  first.splice(ItemList::iteratorTo(items[4]), second);
+
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(first.size(), 5);
+
+  int expected = 1;
+  for (ItemList::ConstIterator it = first.cbegin(); it != first.cend(); ++it) {
+    EXPECT_EQ(it->value, expected++);
+  }
+
+  ItemList moved(std::move(first));
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(moved.size(), 5);
+  EXPECT_EQ(moved.back().value, 5);
+
+  first.swap(moved);
+  EXPECT_EQ(first.size(), 5);
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(first.front().value, 1);
+}
+
+TEST(IntrusiveList, allocations_compared_to_list) {
+  const int n = 1000;
+  PooledItem *pool = new PooledItem[n];
+
+  size_t before = allocations_count;
+  {
+    s21::List<PooledItem*> list;
+    for (int i = 0; i < n; ++i) {
+      list.pushBack(&pool[i]);
+    }
+  }
+  size_t list_allocations = allocations_count - before;
+
+  before = allocations_count;
+  {
+    ItemList list;
+    for (int i = 0; i < n; ++i) {
+      list.pushBack(pool[i]);
+    }
+    EXPECT_EQ(list.size(), static_cast<size_t>(n));
+  }
+  size_t intrusive_allocations = allocations_count - before;
+
+  EXPECT_GT(list_allocations, 0U);
+  EXPECT_EQ(intrusive_allocations, 0U);
+
+  delete[] pool;
+}
+
+
+/* ========================================================================= */
+/*                              Concurrent List                              */
+/* ========================================================================= */
+
+TEST(ConcurrentList, single_threaded_operations) {
+  s21::ConcurrentList<int> list{ 5, 1, 3 };
+
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_TRUE(list.contains(1));
+  EXPECT_TRUE(list.contains(3));
+  EXPECT_TRUE(list.contains(5));
+  EXPECT_FALSE(list.contains(2));
+
+  EXPECT_FALSE(list.insert(3)); // no duplicates
+  EXPECT_TRUE(list.insert(2));
+  EXPECT_TRUE(list.insert(0));
+  EXPECT_TRUE(list.insert(10));
+  EXPECT_EQ(list.size(), 6);
+
+  EXPECT_TRUE(list.remove(0));
+  EXPECT_TRUE(list.remove(10));
+  EXPECT_TRUE(list.remove(3));
+  EXPECT_FALSE(list.remove(3));
+  EXPECT_FALSE(list.contains(3));
+  EXPECT_EQ(list.size(), 3);
+
+  EXPECT_TRUE(list.remove(1));
+  EXPECT_TRUE(list.remove(2));
+  EXPECT_TRUE(list.remove(5));
+  EXPECT_TRUE(list.empty());
+  EXPECT_FALSE(list.remove(5));
+}
+
+TEST(ConcurrentList, stress_disjoint_inserts_and_removes) {
+  const int threads_count = 4;
+  const int per_thread = 500;
+  s21::ConcurrentList<int> list;
+  std::vector<std::thread> threads;
+
+  // every thread owns keys t, t + threads_count, ...
+  for (int t = 0; t < threads_count; ++t) {
+    threads.emplace_back([&list, t]() {
+      for (int i = 0; i < per_thread; ++i) {
+        EXPECT_TRUE(list.insert(i * threads_count + t));
+      }
+      for (int i = 0; i < per_thread; i += 2) {
+        EXPECT_TRUE(list.remove(i * threads_count + t));
+      }
+      for (int i = 0; i < per_thread; ++i) {
+        EXPECT_EQ(list.contains(i * threads_count + t), i % 2 == 1);
+      }
+    });
+  }
+
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(list.size(), static_cast<size_t>(threads_count * per_thread / 2));
+  for (int key = 0; key < threads_count * per_thread; ++key) {
+    EXPECT_EQ(list.contains(key), (key / threads_count) % 2 == 1);
+  }
+}
+
+TEST(ConcurrentList, stress_contended_keys) {
+  const int threads_count = 4;
+  const int rounds = 5000;
+  const int keys = 64;
+  s21::ConcurrentList<int> list;
+  std::atomic<long> inserted{ 0 };
+  std::atomic<long> removed{ 0 };
+  std::vector<std::thread> threads;
+
+  // all threads fight for the same small set of keys, every successful
+  // insert and remove is counted, in the end counts must match the list
+  for (int t = 0; t < threads_count; ++t) {
+    threads.emplace_back([&, t]() {
+      unsigned state = 12345u + t;
+      for (int i = 0; i < rounds; ++i) {
+        state = state * 1103515245u + 12345u;
+        int key = (state >> 16) % keys;
+
+        switch ((state >> 8) % 3) {
+          case 0:
+            inserted += list.insert(key);
+            break;
+          case 1:
+            removed += list.remove(key);
+            break;
+          default:
+            list.contains(key);
+        }
+      }
+    });
+  }
+
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  size_t present = 0;
+  for (int key = 0; key < keys; ++key) {
+    present += list.contains(key);
+  }
+
+  EXPECT_EQ(static_cast<long>(present), inserted - removed);
+  EXPECT_EQ(list.size(), present);
+}
+
+
+/* ========================================================================= */
+/*                             Concurrent Stack                              */
+/* ========================================================================= */
+
+TEST(ConcurrentStack, single_threaded_operations) {
+  s21::ConcurrentStack<std::string> stack;
+  std::string value;
+
+  EXPECT_TRUE(stack.empty());
+  EXPECT_FALSE(stack.pop(value));
+  EXPECT_FALSE(stack.top(value));
+
+  EXPECT_TRUE(stack.push("one"));
+  EXPECT_TRUE(stack.push(std::string("two")));
+  EXPECT_TRUE(stack.push("three"));
+  EXPECT_EQ(stack.size(), 3);
+
+  EXPECT_TRUE(stack.top(value));
+  EXPECT_EQ(value, "three");
+  EXPECT_EQ(stack.size(), 3);
+
+  EXPECT_TRUE(stack.pop(value));
+  EXPECT_EQ(value, "three");
+  EXPECT_TRUE(stack.pop(value));
+  EXPECT_EQ(value, "two");
+  EXPECT_TRUE(stack.pop(value));
+  EXPECT_EQ(value, "one");
+  EXPECT_TRUE(stack.empty());
+  EXPECT_FALSE(stack.pop(value));
+
+  // destructor deletes what is left
+  stack.push("left");
+}
+
+TEST(ConcurrentStack, bounded_push_fails_when_full) {
+  s21::ConcurrentStack<int> stack(2);
+  int value = 0;
+
+  EXPECT_EQ(stack.capacity(), 2);
+  EXPECT_TRUE(stack.push(1));
+  EXPECT_TRUE(stack.push(2));
+  EXPECT_FALSE(stack.push(3));
+  EXPECT_EQ(stack.size(), 2);
+
+  EXPECT_TRUE(stack.pop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_TRUE(stack.push(4));
+  EXPECT_TRUE(stack.pop(value));
+  EXPECT_EQ(value, 4);
+}
+
+TEST(ConcurrentStack, stress_every_element_is_popped_once) {
+  const int threads_count = 4;
+  const int per_thread = 20000;
+  s21::ConcurrentStack<int> stack;
+  std::vector<std::atomic<int>> seen(threads_count * per_thread);
+  std::vector<std::thread> threads;
+
+  // every thread pushes its own values and pops whatever is on top, pushes and
+  // pops alternate so that the top stays contended and elimination kicks in
+  for (int t = 0; t < threads_count; ++t) {
+    threads.emplace_back([&, t]() {
+      int value = 0;
+      for (int i = 0; i < per_thread; ++i) {
+        EXPECT_TRUE(stack.push(t * per_thread + i));
+        if (i % 2 == 1 && stack.pop(value)) {
+          ++seen[value];
+        }
+        stack.top(value);
+      }
+    });
+  }
+
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  int value = 0;
+  while (stack.pop(value)) {
+    ++seen[value];
+  }
+
+  EXPECT_TRUE(stack.empty());
+  EXPECT_EQ(stack.size(), 0);
+  for (const std::atomic<int> &count : seen) {
+    EXPECT_EQ(count.load(), 1);
+  }
+}
+
+TEST(ConcurrentStack, stress_bounded_free_list) {
+  const int threads_count = 4;
+  const int rounds = 20000;
+  const size_t buffers = 8;
+  s21::ConcurrentStack<int*> free_list(buffers);
+  int pool[buffers] = {};
+  std::vector<std::thread> threads;
+
+  for (size_t i = 0; i < buffers; ++i) {
+    EXPECT_TRUE(free_list.push(&pool[i]));
+  }
+  EXPECT_FALSE(free_list.push(&pool[0]));
+
+  // buffers are taken and given back, a buffer is never owned by two threads
+  // (thread sanitizer would report the race on its contents otherwise)
+  for (int t = 0; t < threads_count; ++t) {
+    threads.emplace_back([&]() {
+      int *buffer = nullptr;
+      for (int i = 0; i < rounds; ++i) {
+        if (free_list.pop(buffer)) {
+          ++*buffer;
+          EXPECT_TRUE(free_list.push(buffer));
+        }
+      }
+    });
+  }
+
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(free_list.size(), buffers);
+
+  int total = 0;
+  for (size_t i = 0; i < buffers; ++i) {
+    total += pool[i];
+  }
+  EXPECT_GT(total, 0);
+}
+
+
+/* ========================================================================= */
+/*                                SPSC Queue                                 */
+/* ========================================================================= */
+
+TEST(SpscQueue, capacity_is_rounded_up) {
+  s21::SpscQueue<int> queue(5);
+
+  EXPECT_EQ(queue.capacity(), 8);
+  EXPECT_TRUE(queue.empty());
+
+  EXPECT_THROW(s21::SpscQueue<int> bad(0), s21::ArrayException);
+}
+
+TEST(SpscQueue, push_pop_front) {
+  s21::SpscQueue<std::string> queue(4);
+
+  EXPECT_THROW(queue.front(), s21::ArrayException);
+  queue.pop(); // nothing happens
+
+  EXPECT_TRUE(queue.push("one"));
+  EXPECT_TRUE(queue.push("two"));
+  EXPECT_TRUE(queue.emplace(3, 'x'));
+  EXPECT_TRUE(queue.push("four"));
+  EXPECT_FALSE(queue.push("five")); // full
+  EXPECT_EQ(queue.size(), 4);
+
+  EXPECT_EQ(queue.front(), "one");
+  queue.pop();
+  EXPECT_EQ(queue.front(), "two");
+
+  std::string out;
+  EXPECT_TRUE(queue.pop(out));
+  EXPECT_EQ(out, "two");
+  EXPECT_TRUE(queue.pop(out));
+  EXPECT_EQ(out, "xxx");
+
+  // ring wraps around, leftovers are destroyed by the destructor
+  EXPECT_TRUE(queue.push("five"));
+  EXPECT_TRUE(queue.push("six"));
+  EXPECT_TRUE(queue.push("seven"));
+  EXPECT_FALSE(queue.push("eight"));
+  EXPECT_EQ(queue.front(), "four");
+}
+
+TEST(SpscQueue, batch_push_and_pop) {
+  s21::SpscQueue<int> queue(8);
+  int items[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+  int out[10] = {};
+
+  EXPECT_EQ(queue.push_n(items, 3), 3);
+  EXPECT_EQ(queue.pop_n(out, 2), 2);
+  EXPECT_EQ(out[0], 0);
+  EXPECT_EQ(out[1], 1);
+
+  // only 7 slots are free
+  EXPECT_EQ(queue.push_n(items + 3, 7), 7);
+  EXPECT_EQ(queue.push_n(items, 1), 0);
+
+  EXPECT_EQ(queue.pop_n(out, 10), 8);
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(out[i], i + 2);
+  }
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.pop_n(out, 1), 0);
+}
+
+TEST(SpscQueue, throwing_batches_keep_the_queue_consistent) {
+  ThrowingCopy::copies_left = 100;
+  {
+    s21::SpscQueue<ThrowingCopy> queue(8);
+    ThrowingCopy items[4] = { 1, 2, 3, 4 };
+
+    // the third copy fails, the two made before it are rolled back
+    ThrowingCopy::copies_left = 2;
+    EXPECT_THROW(queue.push_n(items, 4), std::runtime_error);
+    EXPECT_TRUE(queue.empty());
+
+    ThrowingCopy::copies_left = 100;
+    EXPECT_EQ(queue.push_n(items, 4), 4);
+  }
+  EXPECT_EQ(ThrowingCopy::alive, 0);
+
+  ThrowingMove::moves_left = 100;
+  {
+    s21::SpscQueue<ThrowingMove> queue(8);
+    ThrowingMove items[4] = { 1, 2, 3, 4 };
+    ThrowingMove out[4];
+    EXPECT_EQ(queue.push_n(items, 4), 4);
+
+    // two elements are moved out and removed, the third stays in the queue
+    ThrowingMove::moves_left = 2;
+    EXPECT_THROW(queue.pop_n(out, 4), std::runtime_error);
+    EXPECT_EQ(out[1].value, 2);
+    EXPECT_EQ(queue.size(), 2);
+    EXPECT_EQ(queue.front().value, 3);
+
+    ThrowingMove::moves_left = 100;
+    EXPECT_EQ(queue.pop_n(out, 4), 2);
+    EXPECT_EQ(out[1].value, 4);
+  }
+  EXPECT_EQ(ThrowingMove::alive, 0);
+}
+
+TEST(SpscQueue, producer_and_consumer_threads) {
+  const int count = 200000;
+  s21::SpscQueue<int> queue(64);
+
+  std::thread producer([&queue]() {
+    int batch[16];
+    int next = 0;
+
+    while (next < count) {
+      int n = 0;
+      while (n < 16 && next + n < count) {
+        batch[n] = next + n;
+        ++n;
+      }
+
+      if (n == 1) {
+        next += queue.push(batch[0]);
+      } else {
+        next += static_cast<int>(queue.push_n(batch, n));
+      }
+      std::this_thread::yield();
+    }
+  });
+
+  // elements must come out exactly once and in order
+  long long sum = 0;
+  int expected = 0;
+  bool in_order = true;
+  int out[32];
+
+  while (expected < count) {
+    int n = static_cast<int>(queue.pop_n(out, 32));
+    for (int i = 0; i < n; ++i) {
+      in_order = in_order && out[i] == expected;
+      sum += out[i];
+      ++expected;
+    }
+    if (n == 0) {
+      std::this_thread::yield();
+    }
+  }
+
+  producer.join();
+
+  EXPECT_TRUE(in_order);
+  EXPECT_EQ(sum, static_cast<long long>(count) * (count - 1) / 2);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(SpscQueue, size_seen_from_another_thread_stays_in_range) {
+  const int count = 20000;
+  s21::SpscQueue<int> queue(8);
+  std::atomic<bool> done{ false };
+  std::atomic<bool> in_range{ true };
+
+  // a third thread reading the size while the consumer moves the head. Its
+  // reads may be stale, but a head read after the tail could be ahead of it
+  // and the difference would wrap around
+  std::thread observer([&]() {
+    while (!done.load()) {
+      if (queue.size() > static_cast<size_t>(count)) {
+        in_range = false;
+      }
+    }
+  });
+
+  std::thread producer([&queue]() {
+    for (int next = 0; next < count;) {
+      if (queue.push(next)) {
+        ++next;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  int value = 0;
+  for (int popped = 0; popped < count;) {
+    if (queue.pop(value)) {
+      ++popped;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  producer.join();
+  done = true;
+  observer.join();
+
+  EXPECT_TRUE(in_range);
+}
+
+
+/* ========================================================================= */
+/*                                MPMC Queue                                 */
+/* ========================================================================= */
+
+TEST(MpmcQueue, try_push_and_try_pop) {
+  s21::MpmcQueue<std::string> queue(3);
+  std::string out;
+
+  EXPECT_EQ(queue.capacity(), 4);
+  EXPECT_FALSE(queue.try_pop(out));
+
+  EXPECT_TRUE(queue.try_push("one"));
+  EXPECT_TRUE(queue.try_push("two"));
+  EXPECT_TRUE(queue.try_push("three"));
+  EXPECT_TRUE(queue.try_push("four"));
+  EXPECT_FALSE(queue.try_push("five")); // full
+  EXPECT_EQ(queue.size(), 4);
+
+  EXPECT_TRUE(queue.try_pop(out));
+  EXPECT_EQ(out, "one");
+  EXPECT_TRUE(queue.try_pop(out));
+  EXPECT_EQ(out, "two");
+
+  // ring wraps around, leftovers are destroyed by the destructor
+  EXPECT_TRUE(queue.try_push("five"));
+  EXPECT_TRUE(queue.try_pop(out));
+  EXPECT_EQ(out, "three");
+  EXPECT_EQ(queue.size(), 2);
+
+  EXPECT_THROW(s21::MpmcQueue<int> bad(0), s21::ArrayException);
+}
+
+TEST(MpmcQueue, close_drains_remaining_elements) {
+  s21::MpmcQueue<int> queue(8);
+  int out = 0;
+
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_TRUE(queue.push(2));
+  queue.close();
+
+  EXPECT_TRUE(queue.closed());
+  EXPECT_FALSE(queue.push(3));
+  EXPECT_FALSE(queue.try_push(3));
+
+  EXPECT_TRUE(queue.pop(out));
+  EXPECT_EQ(out, 1);
+  EXPECT_TRUE(queue.pop(out));
+  EXPECT_EQ(out, 2);
+  EXPECT_FALSE(queue.pop(out));
+}
+
+TEST(MpmcQueue, close_wakes_parked_threads) {
+  s21::MpmcQueue<int> empty_queue(2);
+  s21::MpmcQueue<int> full_queue(2);
+  full_queue.push(1);
+  full_queue.push(2);
+
+  std::atomic<int> finished{ 0 };
+  std::thread consumer([&]() {
+    int out = 0;
+    EXPECT_FALSE(empty_queue.pop(out));
+    ++finished;
+  });
+  std::thread producer([&]() {
+    EXPECT_FALSE(full_queue.push(3));
+    ++finished;
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_EQ(finished, 0);
+
+  empty_queue.close();
+  full_queue.close();
+  consumer.join();
+  producer.join();
+
+  EXPECT_EQ(finished, 2);
+  EXPECT_EQ(full_queue.size(), 2);
+}
+
+TEST(MpmcQueue, close_racing_pushes_strands_nothing) {
+  for (int round = 0; round < 200; ++round) {
+    s21::MpmcQueue<int> queue(1024);
+    std::atomic<int> pushed{ 0 };
+    std::atomic<int> popped{ 0 };
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < 2; ++p) {
+      threads.emplace_back([&]() {
+        for (int i = 0; i < 200; ++i) {
+          pushed += queue.try_push(i) ? 1 : 0;
+        }
+      });
+    }
+
+    threads.emplace_back([&]() {
+      int value = 0;
+      while (queue.pop(value)) {
+        ++popped;
+      }
+    });
+
+    std::this_thread::yield();
+    queue.close();
+
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+
+    // every push that reported success was handed to the consumer
+    ASSERT_EQ(popped, pushed) << round;
+    ASSERT_TRUE(queue.empty());
+  }
+}
+
+TEST(MpmcQueue, many_producers_and_consumers) {
+  const int producers_count = 3;
+  const int consumers_count = 3;
+  const int per_producer = 20000;
+  s21::MpmcQueue<int> queue(16); // small ring, so threads park a lot
+  std::atomic<long long> sum{ 0 };
+  std::atomic<int> popped{ 0 };
+  std::vector<std::thread> threads;
+
+  for (int p = 0; p < producers_count; ++p) {
+    threads.emplace_back([&, p]() {
+      for (int i = 0; i < per_producer; ++i) {
+        EXPECT_TRUE(queue.push(p * per_producer + i));
+      }
+    });
+  }
+
+  for (int c = 0; c < consumers_count; ++c) {
+    threads.emplace_back([&]() {
+      int value = 0;
+      while (queue.pop(value)) {
+        sum += value;
+        ++popped;
+      }
+    });
+  }
+
+  for (int p = 0; p < producers_count; ++p) {
+    threads[p].join();
+  }
+  queue.close();
+  for (int c = 0; c < consumers_count; ++c) {
+    threads[producers_count + c].join();
+  }
 
-  EXPECT_EQ(array.at(0), 1);
-  EXPECT_EQ(array.at(1), 2);
-  EXPECT_EQ(array.at(2), 3);
-  EXPECT_EQ(array.at(3), 4);
-  EXPECT_EQ(array.at(4), 5);
+  const long long total = producers_count * per_producer;
+  EXPECT_EQ(popped, total);
+  EXPECT_EQ(sum, total * (total - 1) / 2);
+  EXPECT_TRUE(queue.empty());
+}
 
-  EXPECT_THROW(array.at(-1), s21::ArrayException);
-  EXPECT_THROW(array.at(5), s21::ArrayException);
+
+/* ========================================================================= */
+/*                            Work-Stealing Deque                            */
+/* ========================================================================= */
+
+TEST(WorkStealingDeque, owner_pops_lifo_thieves_steal_fifo) {
+  s21::WorkStealingDeque<int> deque(2);
+  int out = 0;
+
+  EXPECT_FALSE(deque.pop(out));
+  EXPECT_FALSE(deque.steal(out));
+
+  for (int i = 0; i < 10; ++i) {
+    deque.push(i); // grows twice on the way
+  }
+  EXPECT_EQ(deque.size(), 10);
+  EXPECT_GE(deque.capacity(), 10);
+
+  EXPECT_TRUE(deque.pop(out));
+  EXPECT_EQ(out, 9);
+  EXPECT_TRUE(deque.steal(out));
+  EXPECT_EQ(out, 0);
+  EXPECT_TRUE(deque.steal(out));
+  EXPECT_EQ(out, 1);
+  EXPECT_TRUE(deque.pop(out));
+  EXPECT_EQ(out, 8);
+  EXPECT_EQ(deque.size(), 6);
+
+  for (int expected = 7; expected >= 2; --expected) {
+    EXPECT_TRUE(deque.pop(out));
+    EXPECT_EQ(out, expected);
+  }
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop(out));
+
+  EXPECT_THROW(s21::WorkStealingDeque<int> bad(0), s21::ArrayException);
+}
+
+TEST(WorkStealingDeque, every_element_is_taken_once) {
+  const int count = 50000;
+  const int thieves_count = 3;
+  s21::WorkStealingDeque<int> deque(4);
+  std::vector<std::atomic<int>> taken(count);
+  std::atomic<bool> done{ false };
+  std::vector<std::thread> thieves;
+
+  for (int t = 0; t < thieves_count; ++t) {
+    thieves.emplace_back([&]() {
+      int value = 0;
+      while (!done || !deque.empty()) {
+        if (deque.steal(value)) {
+          ++taken[value];
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  // owner keeps pushing and popping at the same time, deque grows under thieves.
+  // A pop that lost the last element to a thief leaves its out as it was
+  int value = 0;
+  bool untouched = true;
+  for (int i = 0; i < count; ++i) {
+    deque.push(i);
+    if (i % 3 == 0) {
+      value = -1;
+      if (deque.pop(value)) {
+        ++taken[value];
+      } else {
+        untouched = untouched && value == -1;
+      }
+    }
+  }
+  while (deque.pop(value)) {
+    ++taken[value];
+  }
+  done = true;
+
+  for (std::thread &thief : thieves) {
+    thief.join();
+  }
+
+  int wrong = 0;
+  for (int i = 0; i < count; ++i) {
+    wrong += taken[i] != 1;
+  }
+  EXPECT_EQ(wrong, 0);
+  EXPECT_TRUE(untouched);
 }
 
-TEST(Array, testing_const_access_methods) {
-  const s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
 
-  EXPECT_EQ(array.size(), 5);
+/* ========================================================================= */
+/*                                Thread Pool                                */
+/* ========================================================================= */
 
-  EXPECT_EQ(array[0], 1);
-  EXPECT_EQ(array[1], 2);
-  EXPECT_EQ(array[2], 3);
-  EXPECT_EQ(array[3], 4);
-  EXPECT_EQ(array[4], 5);
+TEST(ThreadPool, submit_and_wait) {
+  s21::ThreadPool pool(3);
+  std::atomic<int> counter{ 0 };
 
-  EXPECT_EQ(array.at(0), 1);
-  EXPECT_EQ(array.at(1), 2);
-  EXPECT_EQ(array.at(2), 3);
-  EXPECT_EQ(array.at(3), 4);
-  EXPECT_EQ(array.at(4), 5);
+  EXPECT_EQ(pool.size(), 3);
 
-  EXPECT_THROW(array.at(-1), s21::ArrayException);
-  EXPECT_THROW(array.at(5), s21::ArrayException);
+  for (int i = 0; i < 2000; ++i) {
+    pool.submit([&counter]() { ++counter; });
+  }
+  pool.wait();
+  EXPECT_EQ(counter, 2000);
+
+  // tasks submitted from tasks go to the worker's own deque
+  for (int i = 0; i < 10; ++i) {
+    pool.submit([&pool, &counter]() {
+      for (int j = 0; j < 10; ++j) {
+        pool.submit([&counter]() { ++counter; });
+      }
+    });
+  }
+  pool.wait();
+  EXPECT_EQ(counter, 2100);
+
+  std::atomic<bool> thrown{ false };
+  pool.submit([&]() {
+    try {
+      pool.wait();
+    } catch (const s21::ArrayException&) {
+      thrown = true;
+    }
+  });
+  pool.wait();
+  EXPECT_TRUE(thrown);
+}
+
+TEST(ThreadPool, parallel_for_builds_containers) {
+  s21::ThreadPool pool(4);
+  const size_t maps_count = 64;
+  s21::Map<int, int> maps[maps_count];
+
+  // container-heavy batch job: every index fills its own map
+  pool.parallel_for(0, maps_count, [&maps](size_t i) {
+    for (int j = 0; j < 200; ++j) {
+      maps[i].insert(static_cast<int>((j * 7919 + i) % 200), j);
+    }
+  });
+
+  for (size_t i = 0; i < maps_count; ++i) {
+    ASSERT_EQ(maps[i].size(), 200);
+    EXPECT_TRUE(maps[i].contains(0));
+    EXPECT_TRUE(maps[i].contains(199));
+  }
+
+  // nested parallel_for, inner loops run on the same workers
+  std::vector<std::atomic<int>> cells(100 * 100);
+  pool.parallel_for(0, 100, [&](size_t row) {
+    pool.parallel_for(0, 100, [&](size_t column) { ++cells[row * 100 + column]; }, 10);
+  });
+
+  int wrong = 0;
+  for (std::atomic<int> &cell : cells) {
+    wrong += cell != 1;
+  }
+  EXPECT_EQ(wrong, 0);
+
+  pool.parallel_for(5, 5, [](size_t) { FAIL(); });
 }
 
-TEST(Array, testing_other_access_methods) {
-  const s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+TEST(ThreadPool, parallel_for_rethrows_exception) {
+  s21::ThreadPool pool(2);
+  std::atomic<int> calls{ 0 };
 
-  EXPECT_EQ(array.size(), 5);
+  EXPECT_THROW(pool.parallel_for(0, 100, [&calls](size_t i) {
+    ++calls;
+    if (i == 42) {
+      throw std::runtime_error("bad index");
+    }
+  }, 10), std::runtime_error);
 
-  EXPECT_EQ(array.front(), 1);
-  EXPECT_EQ(array.back(), 5);
+  // chunk with the bad index stops, all others run to the end
+  EXPECT_EQ(calls, 100 - 7);
 }
 
-TEST(Array, getting_access_to_the_underlying_data) {
-  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
 
-  EXPECT_EQ(array.size(), 5);
+/* ========================================================================= */
+/*                           Concurrent Hash Map                             */
+/* ========================================================================= */
 
-  int* data = array.data();
+TEST(ConcurrentHashMap, single_threaded_operations) {
+  s21::ConcurrentHashMap<int, std::string> map(5);
+  std::string value;
 
-  EXPECT_EQ(data[0], 1);
-  EXPECT_EQ(data[1], 2);
-  EXPECT_EQ(data[2], 3);
-  EXPECT_EQ(data[3], 4);
-  EXPECT_EQ(data[4], 5);
+  EXPECT_EQ(map.shard_count(), 8U);
+  EXPECT_TRUE(map.empty());
+  EXPECT_THROW((s21::ConcurrentHashMap<int, int>(0)), s21::ArrayException);
 
-  data[2] = 9;
-  EXPECT_EQ(data[2], 9);
+  EXPECT_TRUE(map.insert_or_assign(1, "one"));
+  EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+  EXPECT_TRUE(map.insert(2, "two"));
+  EXPECT_FALSE(map.insert(2, "dos"));
+
+  EXPECT_TRUE(map.find(1, value));
+  EXPECT_EQ(value, "uno");
+  EXPECT_FALSE(map.find(3, value));
+  EXPECT_EQ(value, "uno");
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_EQ(map.size(), 2U);
+
+  int calls = 0;
+  auto make = [&calls](int key) {
+    ++calls;
+    return std::to_string(key);
+  };
+  EXPECT_EQ(map.compute_if_absent(3, make), "3");
+  EXPECT_EQ(map.compute_if_absent(3, make), "3");
+  EXPECT_EQ(map.compute_if_absent(1, make), "uno");
+  EXPECT_EQ(calls, 1);
+
+  EXPECT_TRUE(map.erase(1));
+  EXPECT_FALSE(map.erase(1));
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.size(), 2U);
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
 }
 
-TEST(Array, getting_access_to_the_underlying_data_const) {
-  const s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+TEST(ConcurrentHashMap, shards_are_visited_once) {
+  s21::ConcurrentHashMap<int, int> map;
 
-  EXPECT_EQ(array.size(), 5);
+  for (int key = 0; key < 10000; ++key) {
+    map.insert(key, key * 2);
+  }
 
-  const int* data = array.data();
+  size_t visited = 0;
+  size_t used_shards = 0;
+  map.for_each_shard([&](const s21::ConcurrentHashMap<int, int>::Shard &shard) {
+    visited += shard.size();
+    used_shards += !shard.empty();
+  });
+  EXPECT_EQ(visited, 10000U);
+  // keys spread over all shards
+  EXPECT_EQ(used_shards, map.shard_count());
+
+  s21::ThreadPool pool(4);
+  std::atomic<long long> sum{ 0 };
+  std::atomic<size_t> shards{ 0 };
+  map.for_each_shard(pool, [&](const s21::ConcurrentHashMap<int, int>::Shard &shard) {
+    long long local = 0;
+    for (auto it = shard.cbegin(); it != shard.cend(); ++it) {
+      EXPECT_EQ(*it, it->first * 2);
+      local += *it;
+    }
+    sum += local;
+    ++shards;
+  });
+  EXPECT_EQ(shards, map.shard_count());
+  EXPECT_EQ(sum, 10000LL * 9999);
+}
+
+TEST(ConcurrentHashMap, stress_ingest_threads) {
+  s21::ConcurrentHashMap<int, int> map(16);
+  const int threads_count = 8;
+  const int keys_per_thread = 5000;
+  std::vector<std::thread> threads;
+
+  // every thread writes its own keys, reads everyone's and counts a shared
+  // key through compute_if_absent
+  std::atomic<int> made{ 0 };
+  for (int t = 0; t < threads_count; ++t) {
+    threads.emplace_back([&map, &made, t]() {
+      for (int i = 0; i < keys_per_thread; ++i) {
+        const int key = i * threads_count + t;
+        map.insert_or_assign(key, key);
+        map.insert_or_assign(key, key + 1);
+
+        int value = 0;
+        if (map.find(key, value)) {
+          EXPECT_EQ(value, key + 1);
+        }
+        map.find((key * 7) % (threads_count * keys_per_thread), value);
+
+        map.compute_if_absent(-1 - i % 100, [&made](int k) {
+          ++made;
+          return k;
+        });
+
+        if (i % 3 == 0) {
+          map.erase(key);
+        }
+      }
+    });
+  }
 
-  EXPECT_EQ(data[0], 1);
-  EXPECT_EQ(data[1], 2);
-  EXPECT_EQ(data[2], 3);
-  EXPECT_EQ(data[3], 4);
-  EXPECT_EQ(data[4], 5);
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(made, 100);
+
+  int expected = 100;
+  for (int key = 0; key < threads_count * keys_per_thread; ++key) {
+    const bool erased = (key / threads_count) % 3 == 0;
+    int value = 0;
+
+    EXPECT_EQ(map.find(key, value), !erased);
+    if (!erased) {
+      EXPECT_EQ(value, key + 1);
+      ++expected;
+    }
+  }
+
+  EXPECT_EQ(map.size(), static_cast<size_t>(expected));
 }
 
-TEST(Array, testing_iterators) {
-  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
 
-  EXPECT_EQ(array.size(), 5);
+/* ========================================================================= */
+/*                              Priority Queue                               */
+/* ========================================================================= */
 
-  int* it = array.begin();
-  int count = 0;
-  while (it != array.end()) {
-    EXPECT_EQ(*it, ++count);
-    ++it;
+TEST(PriorityQueue, push_pop_top) {
+  s21::PriorityQueue<int> queue;
+
+  EXPECT_TRUE(queue.empty());
+  EXPECT_THROW(queue.top(), s21::ArrayException);
+  queue.pop(); // nothing happens
+
+  int values[] = { 5, 1, 9, 3, 7, 9, 0, 4, 8, 2, 6 };
+  for (int value : values) {
+    queue.push(value);
+  }
+  EXPECT_EQ(queue.size(), 11);
+
+  int expected[] = { 9, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+  for (int value : expected) {
+    EXPECT_EQ(queue.top(), value);
+    queue.pop();
   }
+  EXPECT_TRUE(queue.empty());
 }
 
-TEST(Array, testing_const_iterators) {
-  const s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
+struct CountedCopies {
+  static int copies;
+  int value = 0;
 
-  EXPECT_EQ(array.size(), 5);
+  CountedCopies(int v = 0) : value{ v } {}
+  CountedCopies(const CountedCopies &other) : value{ other.value } { ++copies; }
+  CountedCopies(CountedCopies &&other) = default;
+  CountedCopies& operator=(const CountedCopies &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  CountedCopies& operator=(CountedCopies &&other) = default;
+  bool operator<(const CountedCopies &other) const { return value < other.value; }
+};
 
-  const int* it = array.cbegin();
-  int count = 0;
-  while (it != array.cend()) {
-    EXPECT_EQ(*it, ++count);
-    ++it;
+int CountedCopies::copies = 0;
+
+TEST(PriorityQueue, sifting_moves_elements) {
+  s21::PriorityQueue<CountedCopies> queue;
+  for (int i = 0; i < 100; ++i) {
+    queue.push(CountedCopies((i * 37) % 100));
+  }
+
+  // copied once into the queue, sifting and pops only move them
+  CountedCopies::copies = 0;
+  for (int expected = 99; expected >= 0; --expected) {
+    EXPECT_EQ(queue.top().value, expected);
+    queue.pop();
   }
+  EXPECT_EQ(CountedCopies::copies, 0);
 }
 
-TEST(Array, swapping_two_array) {
-  s21::Array<int, 5> array{ 1, 2, 3, 4, 5 };
-  s21::Array<int, 5> array2{ 5, 4, 3, 2, 1 };
+TEST(PriorityQueue, compare_and_arity) {
+  s21::PriorityQueue<std::string, std::greater<std::string>> words{ "pear", "apple", "fig", "kiwi" };
 
-  EXPECT_EQ(array.size(), 5);
-  EXPECT_EQ(array2.size(), 5);
+  EXPECT_EQ(words.top(), "apple");
+  words.pop();
+  EXPECT_EQ(words.top(), "fig");
 
-  array.swap(array2);
+  s21::PriorityQueue<int, std::less<int>, 2> binary;
+  s21::PriorityQueue<int, std::less<int>, 8> wide;
+  unsigned state = 17;
+  for (int i = 0; i < 1000; ++i) {
+    state = state * 1103515245u + 12345u;
+    binary.push(static_cast<int>(state >> 8) % 500);
+    wide.push(static_cast<int>(state >> 8) % 500);
+  }
 
-  EXPECT_EQ(array.size(), 5);
-  EXPECT_EQ(array2.size(), 5);
+  int previous = binary.top();
+  while (!binary.empty()) {
+    EXPECT_LE(binary.top(), previous);
+    EXPECT_EQ(binary.top(), wide.top());
+    previous = binary.top();
+    binary.pop();
+    wide.pop();
+  }
+  EXPECT_TRUE(wide.empty());
+}
 
-  EXPECT_EQ(array[0], 5);
-  EXPECT_EQ(array[1], 4);
-  EXPECT_EQ(array[2], 3);
-  EXPECT_EQ(array[3], 2);
-  EXPECT_EQ(array[4], 1);
+TEST(PriorityQueue, heapify_and_push_many) {
+  s21::Vector<int> values;
+  for (int i = 0; i < 100; ++i) {
+    values.push_back((i * 37) % 100);
+  }
 
-  EXPECT_EQ(array2[0], 1);
-  EXPECT_EQ(array2[1], 2);
-  EXPECT_EQ(array2[2], 3);
-  EXPECT_EQ(array2[3], 4);
-  EXPECT_EQ(array2[4], 5);
+  s21::PriorityQueue<int, std::greater<int>> queue(values.begin(), values.end());
+  EXPECT_EQ(queue.size(), 100);
+  EXPECT_EQ(queue.top(), 0);
+
+  // few elements are sifted up one by one, many cause a rebuild
+  queue.push_many({ -1, 150 });
+  EXPECT_EQ(queue.top(), -1);
+
+  s21::Vector<int> more;
+  for (int i = 0; i < 300; ++i) {
+    more.push_back(200 + i);
+  }
+  queue.push_many(more.begin(), more.end());
+  EXPECT_EQ(queue.size(), 402);
+
+  int previous = queue.top();
+  size_t popped = 0;
+  while (!queue.empty()) {
+    EXPECT_GE(queue.top(), previous);
+    previous = queue.top();
+    queue.pop();
+    ++popped;
+  }
+  EXPECT_EQ(popped, 402);
 }
 
-TEST(Array, autofilling_array) {
-  s21::Array<int, 5> array;
+TEST(PriorityQueue, small_batches_grow_capacity_geometrically) {
+  s21::PriorityQueue<int> queue;
 
-  EXPECT_EQ(array.size(), 5);
+  size_t before = allocations_count;
+  for (int i = 0; i < 20000; ++i) {
+    queue.push_many({ i, -i });
+  }
 
-  array.fill(999);
+  // two vectors doubled up to 40000 elements, not a reallocation per batch
+  EXPECT_LT(allocations_count - before, 64U);
+  EXPECT_EQ(queue.size(), 40000);
+  EXPECT_EQ(queue.top(), 19999);
+}
 
-  EXPECT_EQ(array.size(), 5);
+TEST(PriorityQueue, handles) {
+  s21::PriorityQueue<int, std::greater<int>> queue;
 
-  EXPECT_EQ(array[0], 999);
-  EXPECT_EQ(array[1], 999);
-  EXPECT_EQ(array[2], 999);
-  EXPECT_EQ(array[3], 999);
-  EXPECT_EQ(array[4], 999);
+  auto a = queue.push(50);
+  auto b = queue.push(40);
+  auto c = queue.push(30);
+  queue.push(20);
+  auto e = queue.push(60);
+
+  EXPECT_EQ(queue.top(), 20);
+  EXPECT_EQ(queue.get(e), 60);
+
+  queue.decrease_key(e, 10);
+  EXPECT_EQ(queue.top(), 10);
+  EXPECT_THROW(queue.decrease_key(a, 70), s21::ArrayException);
+
+  queue.update(e, 45); // moves down
+  EXPECT_EQ(queue.top(), 20);
+  EXPECT_EQ(queue.get(e), 45);
+
+  queue.remove(c);
+  EXPECT_FALSE(queue.contains(c));
+  EXPECT_THROW(queue.remove(c), s21::ArrayException);
+  EXPECT_THROW(queue.get(c), s21::ArrayException);
+  EXPECT_EQ(queue.size(), 4);
+
+  int expected[] = { 20, 40, 45, 50 };
+  for (int value : expected) {
+    EXPECT_EQ(queue.top(), value);
+    queue.pop();
+  }
+  EXPECT_FALSE(queue.contains(a));
+  EXPECT_FALSE(queue.contains(b));
+
+  // ids of popped elements are reused
+  auto f = queue.push(1);
+  EXPECT_TRUE(queue.contains(f));
+  EXPECT_EQ(queue.get(f), 1);
+
+  queue.clear();
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.contains(f));
+  EXPECT_FALSE(queue.contains(decltype(f)()));
+}
+
+
+/* ========================================================================= */
+/*                               Pairing Heap                                */
+/* ========================================================================= */
+
+TEST(PairingHeap, push_pop_top) {
+  s21::PairingHeap<int, std::greater<int>> heap;
+
+  EXPECT_TRUE(heap.empty());
+  EXPECT_THROW(heap.top(), s21::ArrayException);
+  heap.pop(); // nothing happens
+
+  unsigned state = 5;
+  for (int i = 0; i < 1000; ++i) {
+    state = state * 1103515245u + 12345u;
+    heap.push(static_cast<int>(state >> 8) % 300);
+  }
+  EXPECT_EQ(heap.size(), 1000);
+
+  int previous = heap.top();
+  while (!heap.empty()) {
+    EXPECT_GE(heap.top(), previous);
+    previous = heap.top();
+    heap.pop();
+  }
+
+  s21::PairingHeap<std::string> words{ "pear", "apple", "fig" };
+  EXPECT_EQ(words.top(), "pear");
+}
+
+TEST(PairingHeap, decrease_key) {
+  s21::PairingHeap<int, std::greater<int>> heap;
+
+  auto a = heap.push(50);
+  auto b = heap.push(40);
+  heap.push(30);
+  auto d = heap.push(20);
+  heap.pop(); // 20 goes, children of the root get paired
+
+  EXPECT_THROW(heap.get(d), s21::ArrayException);
+  EXPECT_THROW(heap.decrease_key(s21::PairingHeap<int, std::greater<int>>::Handle(), 1),
+               s21::ArrayException);
+  EXPECT_THROW(heap.decrease_key(b, 45), s21::ArrayException);
+
+  heap.decrease_key(a, 10);
+  EXPECT_EQ(heap.top(), 10);
+  EXPECT_EQ(heap.get(a), 10);
+
+  heap.decrease_key(b, 35);
+  heap.pop();
+  EXPECT_EQ(heap.top(), 30);
+  heap.pop();
+  EXPECT_EQ(heap.top(), 35);
+  EXPECT_EQ(heap.size(), 1);
+
+  heap.clear();
+  EXPECT_TRUE(heap.empty());
+  heap.push(7);
+  EXPECT_EQ(heap.top(), 7);
+}
+
+
+/* ========================================================================= */
+/*                                Radix Heap                                 */
+/* ========================================================================= */
+
+TEST(RadixHeap, monotone_push_pop) {
+  s21::RadixHeap<int> heap;
+
+  EXPECT_TRUE(heap.empty());
+  EXPECT_THROW(heap.top(), s21::ArrayException);
+  heap.pop(); // nothing happens
+
+  // timer-like workload: new keys are always at or after the current time
+  unsigned state = 11;
+  uint64_t now = 0;
+  size_t popped = 0;
+  for (int i = 0; i < 2000; ++i) {
+    state = state * 1103515245u + 12345u;
+    heap.push(now + (state >> 8) % 1000, i);
+
+    if (i % 3 == 2) {
+      EXPECT_GE(heap.top_key(), now);
+      now = heap.top_key();
+      heap.pop();
+      ++popped;
+    }
+  }
+  EXPECT_EQ(heap.size(), 2000 - popped);
+
+  EXPECT_THROW(heap.push(now - 1, 0), s21::ArrayException);
+
+  while (!heap.empty()) {
+    EXPECT_GE(heap.top_key(), now);
+    now = heap.top_key();
+    heap.pop();
+  }
+
+  s21::RadixHeap<std::string, uint8_t> small;
+  small.push(200, "late");
+  small.push(3, "early");
+  small.push(255, "last");
+  EXPECT_EQ(small.top(), "early");
+  small.pop();
+  EXPECT_EQ(small.top(), "late");
+}
+
+TEST(RadixHeap, decrease_key) {
+  s21::RadixHeap<char> heap;
+
+  auto a = heap.push(100, 'a');
+  auto b = heap.push(60, 'b');
+  auto c = heap.push(5, 'c');
+
+  EXPECT_EQ(heap.top(), 'c');
+  heap.pop(); // last popped key is 5 now
+
+  EXPECT_THROW(heap.get(c), s21::ArrayException);
+  EXPECT_THROW(heap.decrease_key(a, 101), s21::ArrayException);
+  EXPECT_THROW(heap.decrease_key(a, 4), s21::ArrayException);
+
+  heap.decrease_key(a, 5);
+  EXPECT_EQ(heap.key(a), 5);
+  EXPECT_EQ(heap.top(), 'a');
+  heap.pop();
+
+  heap.decrease_key(b, 7);
+  heap.push(6, 'd');
+  EXPECT_EQ(heap.top(), 'd');
+  heap.pop();
+  EXPECT_EQ(heap.top(), 'b');
+  EXPECT_EQ(heap.top_key(), 7);
+
+  heap.clear();
+  EXPECT_TRUE(heap.empty());
+  heap.push(1, 'e'); // keys start from zero again
+  EXPECT_EQ(heap.top(), 'e');
+}
+
+
+/* ========================================================================= */
+/*                               Timing Wheel                                */
+/* ========================================================================= */
+
+TEST(TimingWheel, schedule_advance) {
+  s21::TimingWheel<int> wheel;
+  s21::Vector<int> fired;
+  auto record = [&fired](int value) { fired.push_back(value); };
+
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.advance(100, record), 0);
+  EXPECT_EQ(wheel.now(), 100);
+
+  // deadlines on different levels of the wheel
+  wheel.schedule(100 + 5000000, 4);
+  wheel.schedule(100 + 70, 2);
+  wheel.schedule(100 + 3, 1);
+  wheel.schedule(100 + 4500, 3);
+  wheel.schedule(100 + 70, 5);
+  wheel.schedule(50, 0); // in the past, due right away
+  EXPECT_EQ(wheel.size(), 6);
+
+  EXPECT_EQ(wheel.advance(170, record), 4);
+  EXPECT_EQ(wheel.now(), 170);
+  EXPECT_EQ(wheel.size(), 2);
+
+  EXPECT_EQ(wheel.advance(100 + 4499, record), 0);
+  EXPECT_EQ(wheel.advance(100 + 4500, record), 1);
+  EXPECT_EQ(wheel.advance(~uint64_t(0), record), 1);
+  EXPECT_TRUE(wheel.empty());
+
+  int expected[] = { 0, 1, 2, 5, 3, 4 };
+  ASSERT_EQ(fired.size(), 6);
+  for (size_t i = 0; i < 6; ++i) {
+    EXPECT_EQ(fired[i], expected[i]);
+  }
+}
+
+TEST(TimingWheel, cancel_reschedule) {
+  s21::TimingWheel<std::string> wheel(1000);
+  s21::Vector<std::string> fired;
+  auto record = [&fired](const std::string &value) { fired.push_back(value); };
+
+  auto a = wheel.schedule(1010, "a");
+  auto b = wheel.schedule(2000, "b");
+  auto c = wheel.schedule(900000, "c");
+
+  EXPECT_TRUE(wheel.cancel(a));
+  EXPECT_FALSE(wheel.cancel(a));
+  EXPECT_FALSE(wheel.cancel(s21::TimingWheel<std::string>::Handle()));
+  EXPECT_THROW(wheel.deadline(a), s21::ArrayException);
+
+  EXPECT_TRUE(wheel.reschedule(c, 1500));
+  EXPECT_EQ(wheel.deadline(c), 1500);
+
+  EXPECT_EQ(wheel.advance(1999, record), 1);
+  EXPECT_FALSE(wheel.reschedule(c, 5000)); // already fired
+  EXPECT_TRUE(wheel.reschedule(b, 1999));  // due now, fires on the next advance
+  EXPECT_EQ(wheel.advance(1999, record), 1);
+
+  ASSERT_EQ(fired.size(), 2);
+  EXPECT_EQ(fired[0], "c");
+  EXPECT_EQ(fired[1], "b");
+
+  wheel.schedule(3000, "d");
+  wheel.clear();
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.advance(4000, record), 0);
+}
+
+TEST(TimingWheel, random_against_sorted) {
+  s21::TimingWheel<uint64_t> wheel;
+  s21::Vector<s21::TimingWheel<uint64_t>::Handle> handles;
+
+  unsigned state = 3;
+  uint64_t expected_sum = 0;
+  size_t expected_count = 0;
+  for (int i = 0; i < 3000; ++i) {
+    state = state * 1103515245u + 12345u;
+    uint64_t deadline = (state >> 4) % 200000;
+    handles.push_back(wheel.schedule(deadline, deadline));
+    expected_sum += deadline;
+    ++expected_count;
+  }
+
+  // cancel every third timer
+  for (size_t i = 0; i < handles.size(); i += 3) {
+    expected_sum -= wheel.deadline(handles[i]);
+    --expected_count;
+    EXPECT_TRUE(wheel.cancel(handles[i]));
+  }
+
+  // timers never fire early and come in order of deadlines
+  uint64_t sum = 0;
+  size_t count = 0;
+  uint64_t previous = 0;
+  for (uint64_t now = 0; now < 200000 + 997; now += 997) {
+    wheel.advance(now, [&](uint64_t deadline) {
+      EXPECT_LE(deadline, now);
+      EXPECT_GE(deadline, previous);
+      previous = deadline;
+      sum += deadline;
+      ++count;
+    });
+  }
+
+  EXPECT_EQ(count, expected_count);
+  EXPECT_EQ(sum, expected_sum);
+  EXPECT_TRUE(wheel.empty());
+}
+
+
+/* ========================================================================= */
+/*                           Channel (C++20 only)                            */
+/* ========================================================================= */
+
+#if __cplusplus >= 202002L && __has_include(<coroutine>)
+
+static s21::Task produce(s21::Channel<int> &channel, int count) {
+  for (int i = 0; i < count; ++i) {
+    co_await channel.send(i);
+  }
+  channel.close();
+}
+
+static s21::Task consume(s21::Channel<int> &channel, s21::Vector<int> &received) {
+  while (std::optional<int> value = co_await channel.recv()) {
+    received.push_back(*value);
+  }
+}
+
+TEST(Channel, producer_consumer) {
+  for (size_t capacity : { 0, 1, 4 }) {
+    s21::Executor executor;
+    s21::Channel<int> channel(executor, capacity);
+    s21::Vector<int> received;
+
+    executor.spawn(consume(channel, received));
+    executor.spawn(produce(channel, 100));
+    executor.run();
+
+    EXPECT_EQ(executor.pending(), 0);
+    ASSERT_EQ(received.size(), 100);
+    for (int i = 0; i < 100; ++i) {
+      EXPECT_EQ(received[i], i);
+    }
+  }
+}
+
+static s21::Task sendOne(s21::Channel<std::string> &channel, std::string value, int &failed) {
+  bool sent = co_await channel.send(value); // not inside the if, see Task
+  if (!sent) {
+    ++failed;
+  }
+}
+
+static s21::Task fail() {
+  throw s21::ArrayException("failed inside a coroutine");
+  co_return;
+}
+
+TEST(Channel, close_try_and_errors) {
+  s21::Executor executor;
+  s21::Channel<std::string> channel(executor, 2);
+  int failed = 0;
+
+  EXPECT_TRUE(channel.try_send("a"));
+  EXPECT_TRUE(channel.try_send("b"));
+  EXPECT_FALSE(channel.try_send("c"));
+
+  // both senders wait for room, close makes them fail
+  executor.spawn(sendOne(channel, "d", failed));
+  executor.spawn(sendOne(channel, "e", failed));
+  executor.run();
+  EXPECT_EQ(executor.pending(), 2);
+
+  EXPECT_EQ(*channel.try_recv(), "a"); // "d" takes the free slot
+  channel.close();
+  executor.run();
+  EXPECT_EQ(failed, 1);
+  EXPECT_EQ(executor.pending(), 0);
+
+  EXPECT_EQ(*channel.try_recv(), "b");
+  EXPECT_EQ(*channel.try_recv(), "d");
+  EXPECT_FALSE(channel.try_recv().has_value());
+  EXPECT_FALSE(channel.try_send("f"));
+
+  executor.spawn(fail());
+  EXPECT_THROW(executor.run(), s21::ArrayException);
+
+  // a coroutine waiting on a channel is destroyed together with the executor
+  s21::Executor other;
+  s21::Channel<int> empty(other, 1);
+  s21::Vector<int> received;
+  other.spawn(consume(empty, received));
+  other.run();
+  EXPECT_EQ(other.pending(), 1);
 }
 
+#endif
+
 
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);